@@ -28,6 +28,7 @@
 //#define AVEL_NEON
 
 #include <avel/Avel.hpp>
+#include <avel/Algorithms.hpp>
 
 #include <cstdint>
 #include <bit>
@@ -73,6 +74,7 @@
 //#include "Popcount_16u.hpp"
 //#include "Popcount_32u.hpp"
 //#include "Popcount_64u.hpp"
+//#include "Popcount_bulk.hpp"
 
 //#include "scalbn_32f.hpp"
 
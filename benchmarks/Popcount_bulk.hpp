@@ -0,0 +1,109 @@
+#ifndef AVEL_POPCOUNT_BULK_HPP
+#define AVEL_POPCOUNT_BULK_HPP
+
+namespace avel::benchmarks::popcount_bulk {
+
+    // Unlike the per-element popcount benchmarks, these measure throughput
+    // over bitmaps much larger than the L1 cache
+
+    constexpr std::size_t bitmap_size = 1024 * 1024;
+
+    template<std::uint64_t(*Func)(const std::vector<std::uint64_t>&, const std::vector<std::uint64_t>&)>
+    void bitmap_test_bench(benchmark::State& state) {
+        auto inputs0 = random_values<std::uint64_t>(bitmap_size / sizeof(std::uint64_t));
+        auto inputs1 = random_values<std::uint64_t>(bitmap_size / sizeof(std::uint64_t));
+
+        for (auto _ : state) {
+            auto tmp = Func(inputs0, inputs1);
+            benchmark::DoNotOptimize(tmp);
+        }
+
+        state.SetBytesProcessed(state.iterations() * bitmap_size);
+    }
+
+    //=====================================================
+    // popcount benchmarks
+    //=====================================================
+
+    std::uint64_t scalar_popcount_impl(const std::vector<std::uint64_t>& a, const std::vector<std::uint64_t>&) {
+        std::uint64_t ret = 0;
+        for (auto x : a) {
+            ret += avel::popcount(x);
+        }
+
+        return ret;
+    }
+
+    auto scalar_popcount = bitmap_test_bench<scalar_popcount_impl>;
+
+    BENCHMARK(popcount_bulk::scalar_popcount);
+
+
+
+    std::uint64_t vector_accumulate_impl(const std::vector<std::uint64_t>& a, const std::vector<std::uint64_t>&) {
+        vecNx64u total{0x00};
+
+        std::size_t i = 0;
+        for (; i + vecNx64u::width <= a.size(); i += vecNx64u::width) {
+            total += avel::popcount(avel::load<vecNx64u>(a.data() + i));
+        }
+
+        std::uint64_t ret = 0;
+        for (auto x : avel::to_array(total)) {
+            ret += x;
+        }
+
+        for (; i < a.size(); ++i) {
+            ret += avel::popcount(a[i]);
+        }
+
+        return ret;
+    }
+
+    auto vector_accumulate = bitmap_test_bench<vector_accumulate_impl>;
+
+    BENCHMARK(popcount_bulk::vector_accumulate);
+
+
+
+    std::uint64_t avel_popcount_impl(const std::vector<std::uint64_t>& a, const std::vector<std::uint64_t>&) {
+        return avel::popcount(Vectorized_view<const std::uint64_t>{a.data(), a.size()});
+    }
+
+    auto avel_popcount = bitmap_test_bench<avel_popcount_impl>;
+
+    BENCHMARK(popcount_bulk::avel_popcount);
+
+    //=====================================================
+    // and_count benchmarks
+    //=====================================================
+
+    std::uint64_t scalar_and_count_impl(const std::vector<std::uint64_t>& a, const std::vector<std::uint64_t>& b) {
+        std::uint64_t ret = 0;
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            ret += avel::popcount(a[i] & b[i]);
+        }
+
+        return ret;
+    }
+
+    auto scalar_and_count = bitmap_test_bench<scalar_and_count_impl>;
+
+    BENCHMARK(popcount_bulk::scalar_and_count);
+
+
+
+    std::uint64_t avel_and_count_impl(const std::vector<std::uint64_t>& a, const std::vector<std::uint64_t>& b) {
+        return avel::and_count(
+            Vectorized_view<const std::uint64_t>{a.data(), a.size()},
+            Vectorized_view<const std::uint64_t>{b.data(), b.size()}
+        );
+    }
+
+    auto avel_and_count = bitmap_test_bench<avel_and_count_impl>;
+
+    BENCHMARK(popcount_bulk::avel_and_count);
+
+}
+
+#endif //AVEL_POPCOUNT_BULK_HPP
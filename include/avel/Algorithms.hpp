@@ -0,0 +1,10 @@
+#ifndef AVEL_ALGORITHMS_HPP
+#define AVEL_ALGORITHMS_HPP
+
+#include "Vector.hpp"
+#include "Vectorized_view.hpp"
+#include "Vector_denominator.hpp"
+
+#include "impl/algorithms/Algorithms.hpp"
+
+#endif //AVEL_ALGORITHMS_HPP
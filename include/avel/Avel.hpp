@@ -7,5 +7,6 @@
 #include "Vector.hpp"
 #include "Scalar_denominator.hpp"
 #include "Vector_denominator.hpp"
+#include "Vectorized_view.hpp"
 
 #endif
@@ -0,0 +1,8 @@
+#ifndef AVEL_RANDOM_HPP
+#define AVEL_RANDOM_HPP
+
+#include "Vector.hpp"
+
+#include "impl/random/Random.hpp"
+
+#endif //AVEL_RANDOM_HPP
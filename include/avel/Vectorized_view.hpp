@@ -0,0 +1,8 @@
+#ifndef AVEL_VECTORIZED_VIEW_HPP
+#define AVEL_VECTORIZED_VIEW_HPP
+
+#include "Vector.hpp"
+
+#include "impl/vectorized_view/Vectorized_views.hpp"
+
+#endif //AVEL_VECTORIZED_VIEW_HPP
@@ -91,6 +91,11 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
     #define AVEL_AVX512F
 #endif
 
+#if defined(AVEL_VPCLMULQDQ)
+    #define AVEL_AVX2
+    #define AVEL_PCLMUL
+#endif
+
 #if defined(AVEL_AVX512VBMI2)
     #define AVEL_AVX512F
 #endif
@@ -157,6 +162,10 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
     #define AVEL_SSE2
 #endif
 
+#if defined(AVEL_PCLMUL)
+    #define AVEL_SSE2
+#endif
+
 #if defined(AVEL_SSE2)
     #define AVEL_SSE
 #endif
@@ -238,6 +247,12 @@ static_assert(sizeof(double) == 8, "Size of doubles should be 64 bits");
     #define AVEL_L3_CACHE_LINE_SIZE 64
 #endif
 
+// Size in bytes above which algorithms which support it write their output
+// using non-temporal stores. Should be comparable to the size of the LLC
+#ifndef AVEL_STREAMING_THRESHOLD
+    #define AVEL_STREAMING_THRESHOLD (8 * 1024 * 1024)
+#endif
+
 //=========================================================
 // Intrinsic headers
 //=========================================================
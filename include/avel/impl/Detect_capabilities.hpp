@@ -26,7 +26,7 @@
 #endif
 
 #ifdef __SSE4_2__
-    #define AVEL_SSE4_1
+    #define AVEL_SSE4_2
 #endif
 
 #ifdef __AVX__
@@ -81,6 +81,14 @@
     #define AVEL_GFNI
 #endif
 
+#ifdef __PCLMUL__
+    #define AVEL_PCLMUL
+#endif
+
+#ifdef __VPCLMULQDQ__
+    #define AVEL_VPCLMULQDQ
+#endif
+
 #ifdef __AVX10_1__
     #define AVEL_AVX10_1
 #endif
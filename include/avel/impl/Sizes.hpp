@@ -278,10 +278,22 @@ namespace avel {
 
 
 
+    template<>
+    struct natural_vector_width<float> {
+        static constexpr std::uint32_t value = natural_width_32f;
+    };
+
+    template<>
+    struct natural_vector_width<double> {
+        static constexpr std::uint32_t value = natural_width_64f;
+    };
+
+
+
     #if 201402L <= __cplusplus
 
     template<class T>
-    constexpr bool natural_vector_width_v = natural_vector_width<T>::value;
+    constexpr std::uint32_t natural_vector_width_v = natural_vector_width<T>::value;
 
     #endif
 
@@ -341,10 +353,22 @@ namespace avel {
 
 
 
+    template<>
+    struct maximum_vector_width<float> {
+        static constexpr std::uint32_t value = max_width_32f;
+    };
+
+    template<>
+    struct maximum_vector_width<double> {
+        static constexpr std::uint32_t value = max_width_64f;
+    };
+
+
+
     #if 201402L <= __cplusplus
 
     template<class T>
-    constexpr bool maximum_vector_width_v = maximum_vector_width<T>::value;
+    constexpr std::uint32_t maximum_vector_width_v = maximum_vector_width<T>::value;
 
     #endif
 
@@ -15,6 +15,33 @@ namespace avel {
         using type = void;
     };
 
+    // Narrow indices are unsigned so that they may address every element
+    // of a table with as many entries as the index type can distinguish
+
+    template<>
+    struct to_index_type<std::uint8_t> {
+        using type = std::uint8_t;
+    };
+
+    template<>
+    struct to_index_type<std::int8_t> {
+        using type = std::uint8_t;
+    };
+
+
+
+    template<>
+    struct to_index_type<std::uint16_t> {
+        using type = std::uint16_t;
+    };
+
+    template<>
+    struct to_index_type<std::int16_t> {
+        using type = std::uint16_t;
+    };
+
+
+
     template<>
     struct to_index_type<std::uint32_t> {
         using type = std::int32_t;
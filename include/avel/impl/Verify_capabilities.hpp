@@ -5,6 +5,14 @@
 static_assert(false, "GFNI feature flag was not passed to compiler");
 #endif
 
+#if defined(AVEL_VPCLMULQDQ) && !defined(__VPCLMULQDQ__)
+static_assert(false, "VPCLMULQDQ feature flag was not passed to compiler");
+#endif
+
+#if defined(AVEL_PCLMUL) && !defined(__PCLMUL__)
+static_assert(false, "PCLMUL feature flag was not passed to compiler");
+#endif
+
 #if defined(AVEL_AVX512VMI2) && !defined(__AVX512VBMI2__)
 static_assert(false, "AVX-512VBMI2 feature flag was not passed to compiler");
 #endif
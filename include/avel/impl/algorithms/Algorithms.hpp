@@ -0,0 +1,41 @@
+#ifndef AVEL_IMPL_ALGORITHMS_HPP
+#define AVEL_IMPL_ALGORITHMS_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+#include "../Capabilities.hpp"
+#include "../../Aligned_allocator.hpp"
+
+#include "Alignment.hpp"
+#include "Scan.hpp"
+#include "Reduce.hpp"
+#include "Transform.hpp"
+#include "Find.hpp"
+#include "Search.hpp"
+#include "Partition.hpp"
+#include "Sort.hpp"
+#include "Set_operations.hpp"
+#include "Histogram.hpp"
+#include "Extrema.hpp"
+#include "Unicode.hpp"
+#include "Base64.hpp"
+#include "Decimal.hpp"
+#include "Hex.hpp"
+#include "Crc.hpp"
+#include "Bitmap.hpp"
+#include "Parallel.hpp"
+
+#endif //AVEL_IMPL_ALGORITHMS_HPP
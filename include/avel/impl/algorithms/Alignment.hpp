@@ -0,0 +1,87 @@
+#ifndef AVEL_ALIGNMENT_HPP
+#define AVEL_ALIGNMENT_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // Alignment peeling
+    //=====================================================
+
+    /// Views shorter than this many vectors are not worth peeling
+    constexpr std::size_t peel_min_vectors = 4;
+
+    ///
+    /// Division of a loop over a view into a head, which is handled using
+    /// partial loads and stores, followed by a body whose vectors may be
+    /// accessed using aligned loads and stores
+    ///
+    struct Peel {
+
+        /// Number of leading elements to handle before the body. Always less
+        /// than the width of the vector type used by the loop
+        std::size_t head;
+
+        /// Whether the elements following the head are aligned for the vector
+        /// type used by the loop
+        bool aligned;
+
+    };
+
+    ///
+    /// Computes how many leading elements must be handled separately before
+    /// ptr reaches an address that is aligned to alignof(V). Loops over the
+    /// remaining elements may then use aligned loads and stores, which avoids
+    /// loads and stores that are split across cache lines.
+    ///
+    /// \tparam V Vector type used by the loop
+    /// \tparam A Alignment already guaranteed for ptr
+    /// \param ptr Pointer to the first element
+    /// \param n Number of elements following ptr
+    /// \return Peel for the loop. Nothing is peeled if n is too small for
+    ///     peeling to pay off, or if ptr can never become aligned
+    template<class V, std::size_t A>
+    AVEL_FINL Peel peel(const typename V::scalar* ptr, std::size_t n) {
+        using scalar = typename V::scalar;
+
+        if (alignof(V) <= A) {
+            return Peel{0, true};
+        }
+
+        auto misalignment = reinterpret_cast<std::uintptr_t>(ptr) % alignof(V);
+        if (misalignment == 0) {
+            return Peel{0, true};
+        }
+
+        if (n < peel_min_vectors * V::width || misalignment % sizeof(scalar) != 0) {
+            return Peel{0, false};
+        }
+
+        return Peel{(alignof(V) - misalignment) / sizeof(scalar), true};
+    }
+
+    // Loads and stores used in the bodies of peeled loops, where the tag
+    // indicates whether the body is aligned
+
+    template<class V>
+    AVEL_FINL V body_load(const typename V::scalar* ptr, std::true_type) {
+        return avel::aligned_load<V>(ptr);
+    }
+
+    template<class V>
+    AVEL_FINL V body_load(const typename V::scalar* ptr, std::false_type) {
+        return avel::load<V>(ptr);
+    }
+
+    template<class V>
+    AVEL_FINL void body_store(typename V::scalar* ptr, V v, std::true_type) {
+        avel::aligned_store(ptr, v);
+    }
+
+    template<class V>
+    AVEL_FINL void body_store(typename V::scalar* ptr, V v, std::false_type) {
+        avel::store(ptr, v);
+    }
+
+}
+
+#endif //AVEL_ALIGNMENT_HPP
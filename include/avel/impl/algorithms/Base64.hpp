@@ -0,0 +1,606 @@
+#ifndef AVEL_BASE64_HPP
+#define AVEL_BASE64_HPP
+
+namespace avel {
+
+    ///
+    /// Alphabets defined by RFC 4648
+    ///
+    enum class Base64_alphabet {
+        /// Uses '+' and '/' for the last two digits
+        standard,
+
+        /// Uses '-' and '_' for the last two digits
+        url_safe
+    };
+
+}
+
+namespace avel_impl {
+
+    //=====================================================
+    // Base64 tables
+    //=====================================================
+
+    /// Value in Base64_tables::decode for characters outside the alphabet
+    constexpr std::uint8_t base64_invalid = 0x80;
+
+    ///
+    /// Lookup tables for a particular base64 alphabet. These are derived from
+    /// the alphabet itself so that both alphabets share a single set of
+    /// kernels
+    ///
+    struct Base64_tables {
+
+        /// Character for each 6-bit value
+        alignas(64) std::uint8_t encode[64];
+
+        /// 6-bit value of each character, or base64_invalid
+        alignas(64) std::uint8_t decode[256];
+
+        /// Offsets added to 6-bit values to produce characters, indexed as
+        /// described in encode_characters()
+        alignas(16) std::uint8_t encode_offsets[16];
+
+        // The decoder classifies characters by nibble. A character is invalid
+        // if the bitmasks looked up using its high and low nibbles share a bit.
+        // High nibbles 2 through 7 each receive their own bit. All characters
+        // with other high nibbles are invalid, and share the remaining bit
+
+        alignas(16) std::uint8_t decode_low_classes[16];
+
+        alignas(16) std::uint8_t decode_high_classes[16];
+
+        /// Offsets added to characters to produce 6-bit values, indexed by high
+        /// nibble. Within one nibble, the offset for at most one character may
+        /// differ from the others
+        alignas(16) std::uint8_t decode_offsets[16];
+
+        /// The character whose offset differs from the rest of its nibble
+        std::uint8_t special_character = 0;
+
+        std::uint8_t special_offset = 0;
+
+        /// Indices which gather the three decoded bytes of each 32-bit lane
+        /// into a contiguous sequence
+        alignas(64) std::uint8_t pack_indices[64];
+
+        explicit Base64_tables(const char* alphabet) {
+            for (std::size_t i = 0; i < 256; ++i) {
+                decode[i] = base64_invalid;
+            }
+
+            for (std::size_t i = 0; i < 64; ++i) {
+                encode[i] = static_cast<std::uint8_t>(alphabet[i]);
+                decode[encode[i]] = static_cast<std::uint8_t>(i);
+            }
+
+            encode_offsets[0] = static_cast<std::uint8_t>('a' - 26);
+            for (std::size_t i = 1; i < 11; ++i) {
+                encode_offsets[i] = static_cast<std::uint8_t>('0' - 52);
+            }
+            encode_offsets[11] = static_cast<std::uint8_t>(encode[62] - 62);
+            encode_offsets[12] = static_cast<std::uint8_t>(encode[63] - 63);
+            encode_offsets[13] = static_cast<std::uint8_t>('A');
+            encode_offsets[14] = 0;
+            encode_offsets[15] = 0;
+
+            const std::uint8_t shared_class = 1 << 6;
+            for (std::size_t hi = 0; hi < 16; ++hi) {
+                bool has_own_class = (2 <= hi && hi <= 7);
+                decode_high_classes[hi] = has_own_class ? std::uint8_t(1 << (hi - 2)) : shared_class;
+                decode_offsets[hi] = 0;
+            }
+
+            for (std::size_t lo = 0; lo < 16; ++lo) {
+                decode_low_classes[lo] = shared_class;
+                for (std::size_t hi = 2; hi <= 7; ++hi) {
+                    if (decode[hi * 16 + lo] == base64_invalid) {
+                        decode_low_classes[lo] |= decode_high_classes[hi];
+                    }
+                }
+            }
+
+            bool has_offset[16]{};
+            for (std::size_t c = 0; c < 128; ++c) {
+                if (decode[c] == base64_invalid) {
+                    continue;
+                }
+
+                auto offset = static_cast<std::uint8_t>(decode[c] - c);
+                if (!has_offset[c >> 4]) {
+                    decode_offsets[c >> 4] = offset;
+                    has_offset[c >> 4] = true;
+                } else if (decode_offsets[c >> 4] != offset) {
+                    special_character = static_cast<std::uint8_t>(c);
+                    special_offset = offset;
+                }
+            }
+
+            for (std::size_t i = 0; i < 64; ++i) {
+                pack_indices[i] = static_cast<std::uint8_t>(4 * (i / 3) + (2 - i % 3));
+            }
+        }
+
+    };
+
+    inline const Base64_tables& base64_tables(avel::Base64_alphabet alphabet) {
+        static const Base64_tables standard{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+        static const Base64_tables url_safe{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"};
+
+        return (alphabet == avel::Base64_alphabet::url_safe) ? url_safe : standard;
+    }
+
+    //=====================================================
+    // Vectorized base64 kernels
+    //=====================================================
+
+    #if defined(AVEL_SSSE3)
+
+    ///
+    /// Splits each group of three bytes in the low 12 bytes of v into four
+    /// 6-bit values, one per byte
+    ///
+    AVEL_FINL __m128i encode_split(__m128i v) {
+        v = _mm_shuffle_epi8(v, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+        // Move each 6-bit field into its own byte using multiplications as
+        // shifts which differ between 16-bit lanes
+        auto t0 = _mm_and_si128(v, _mm_set1_epi32(0x0fc0fc00));
+        auto t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        auto t2 = _mm_and_si128(v, _mm_set1_epi32(0x003f03f0));
+        auto t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+        return _mm_or_si128(t1, t3);
+    }
+
+    ///
+    /// Maps 6-bit values to characters by adding an offset which is selected
+    /// according to the range the value falls into
+    ///
+    AVEL_FINL __m128i encode_characters(__m128i values, __m128i offsets) {
+        // 0 for values in [26, 51], 1 through 12 for values in [52, 63], and
+        // 13 for values in [0, 25]
+        auto ranges = _mm_subs_epu8(values, _mm_set1_epi8(51));
+        auto is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+        ranges = _mm_or_si128(ranges, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+
+        return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, ranges));
+    }
+
+    ///
+    /// Maps characters to 6-bit values
+    ///
+    /// \return False if any character is outside of the alphabet
+    AVEL_FINL bool decode_characters(__m128i chars, const Base64_tables& tables, __m128i& values) {
+        const auto nibble_mask = _mm_set1_epi8(0x0F);
+
+        auto lo = _mm_and_si128(chars, nibble_mask);
+        auto hi = _mm_and_si128(_mm_srli_epi16(chars, 4), nibble_mask);
+
+        auto lo_classes = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.decode_low_classes)), lo);
+        auto hi_classes = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.decode_high_classes)), hi);
+
+        auto is_valid = _mm_cmpeq_epi8(_mm_and_si128(lo_classes, hi_classes), _mm_setzero_si128());
+        if (_mm_movemask_epi8(is_valid) != 0xFFFF) {
+            return false;
+        }
+
+        auto offsets = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.decode_offsets)), hi);
+
+        auto is_special = _mm_cmpeq_epi8(chars, _mm_set1_epi8(static_cast<char>(tables.special_character)));
+        offsets = _mm_or_si128(
+            _mm_andnot_si128(is_special, offsets),
+            _mm_and_si128(is_special, _mm_set1_epi8(static_cast<char>(tables.special_offset)))
+        );
+
+        values = _mm_add_epi8(chars, offsets);
+        return true;
+    }
+
+    ///
+    /// Combines each group of four 6-bit values into three bytes, leaving
+    /// them in the low three bytes of each 32-bit lane in big-endian order
+    ///
+    AVEL_FINL __m128i decode_merge(__m128i values) {
+        auto pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        return _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX2)
+
+    AVEL_FINL __m256i encode_split(__m256i v) {
+        v = _mm256_shuffle_epi8(v, _mm256_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1
+        ));
+
+        auto t0 = _mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00));
+        auto t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        auto t2 = _mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0));
+        auto t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+
+        return _mm256_or_si256(t1, t3);
+    }
+
+    AVEL_FINL __m256i encode_characters(__m256i values, __m256i offsets) {
+        auto ranges = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+        auto is_upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+        ranges = _mm256_or_si256(ranges, _mm256_and_si256(is_upper, _mm256_set1_epi8(13)));
+
+        return _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, ranges));
+    }
+
+    AVEL_FINL bool decode_characters(__m256i chars, const Base64_tables& tables, __m256i& values) {
+        const auto nibble_mask = _mm256_set1_epi8(0x0F);
+
+        auto lo = _mm256_and_si256(chars, nibble_mask);
+        auto hi = _mm256_and_si256(_mm256_srli_epi16(chars, 4), nibble_mask);
+
+        auto lo_classes = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.decode_low_classes))), lo);
+        auto hi_classes = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.decode_high_classes))), hi);
+
+        if (!_mm256_testz_si256(lo_classes, hi_classes)) {
+            return false;
+        }
+
+        auto offsets = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.decode_offsets))), hi);
+
+        auto is_special = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(static_cast<char>(tables.special_character)));
+        offsets = _mm256_blendv_epi8(offsets, _mm256_set1_epi8(static_cast<char>(tables.special_offset)), is_special);
+
+        values = _mm256_add_epi8(chars, offsets);
+        return true;
+    }
+
+    AVEL_FINL __m256i decode_merge(__m256i values) {
+        auto pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        return _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    }
+
+    #endif
+
+    ///
+    /// Encodes as many whole blocks of input as the available kernels allow
+    ///
+    /// \return Number of input bytes consumed. Always a multiple of three. The
+    ///     number of characters written is 4/3 of this
+    inline std::size_t base64_encode_blocks(const std::uint8_t* in, std::size_t n, std::uint8_t* out, const Base64_tables& tables) {
+        std::size_t i = 0;
+        std::size_t o = 0;
+
+        #if defined(AVEL_AVX512VBMI) && defined(AVEL_AVX512BW)
+        {
+            // Arrange each group of three bytes so that a single multishift
+            // can extract all four 6-bit fields, which are then used to
+            // permute the alphabet directly
+            const auto shuffle = _mm512_setr_epi32(
+                0x01020001, 0x04050304, 0x07080607, 0x0a0b090a,
+                0x0d0e0c0d, 0x10110f10, 0x13141213, 0x16171516,
+                0x191a1819, 0x1c1d1b1c, 0x1f201e1f, 0x22232122,
+                0x25262425, 0x28292728, 0x2b2c2a2b, 0x2e2f2d2e
+            );
+            const auto shifts = _mm512_set1_epi64(0x3036242a1016040a);
+            const auto alphabet = _mm512_load_si512(tables.encode);
+
+            for (; i + 48 <= n; i += 48, o += 64) {
+                auto v = _mm512_maskz_loadu_epi8(0x0000FFFFFFFFFFFFull, in + i);
+                v = _mm512_permutexvar_epi8(shuffle, v);
+                auto values = _mm512_multishift_epi64_epi8(shifts, v);
+                _mm512_storeu_si512(out + o, _mm512_permutexvar_epi8(values, alphabet));
+            }
+        }
+        #endif
+
+        #if defined(AVEL_AVX2)
+        {
+            const auto offsets = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.encode_offsets)));
+
+            for (; i + 28 <= n; i += 24, o += 32) {
+                auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 0));
+                auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12));
+                auto v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+                auto chars = encode_characters(encode_split(v), offsets);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + o), chars);
+            }
+        }
+        #endif
+
+        #if defined(AVEL_SSSE3)
+        {
+            const auto offsets = _mm_load_si128(reinterpret_cast<const __m128i*>(tables.encode_offsets));
+
+            for (; i + 16 <= n; i += 12, o += 16) {
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+                auto chars = encode_characters(encode_split(v), offsets);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + o), chars);
+            }
+        }
+        #endif
+
+        (void)in;
+        (void)n;
+        (void)out;
+        (void)tables;
+        (void)o;
+
+        return i;
+    }
+
+    ///
+    /// Decodes as many whole blocks of characters as the available kernels
+    /// allow. Invalid characters are detected as part of each block's
+    /// translation, and stop decoding before the block containing them
+    ///
+    /// \return Number of characters consumed. Always a multiple of four. The
+    ///     number of bytes written is 3/4 of this
+    inline std::size_t base64_decode_blocks(const std::uint8_t* in, std::size_t n, std::uint8_t* out, const Base64_tables& tables) {
+        std::size_t i = 0;
+        std::size_t o = 0;
+
+        #if defined(AVEL_AVX512VBMI) && defined(AVEL_AVX512BW)
+        {
+            // The low seven bits of each character select from a 128-entry
+            // table. Characters outside of the alphabet, including those with
+            // the high bit set, are caught by a single test of the sign bits
+            const auto table_lo = _mm512_load_si512(tables.decode + 0);
+            const auto table_hi = _mm512_load_si512(tables.decode + 64);
+            const auto pack = _mm512_load_si512(tables.pack_indices);
+
+            for (; i + 64 <= n; i += 64, o += 48) {
+                auto chars = _mm512_loadu_si512(in + i);
+                auto values = _mm512_permutex2var_epi8(table_lo, chars, table_hi);
+
+                if (_mm512_movepi8_mask(_mm512_or_si512(values, chars)) != 0) {
+                    return i;
+                }
+
+                auto pairs = _mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140));
+                auto merged = _mm512_madd_epi16(pairs, _mm512_set1_epi32(0x00011000));
+
+                _mm512_mask_storeu_epi8(out + o, 0x0000FFFFFFFFFFFFull, _mm512_permutexvar_epi8(pack, merged));
+            }
+        }
+        #endif
+
+        #if defined(AVEL_AVX2)
+        {
+            const auto pack = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tables.pack_indices)));
+
+            for (; i + 32 <= n; i += 32, o += 24) {
+                auto chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+
+                __m256i values;
+                if (!decode_characters(chars, tables, values)) {
+                    return i;
+                }
+
+                // Pack each half's 12 bytes, then bring the halves together
+                auto bytes = _mm256_shuffle_epi8(decode_merge(values), pack);
+                bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + o), _mm256_castsi256_si128(bytes));
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + o + 16), _mm256_extracti128_si256(bytes, 1));
+            }
+        }
+        #endif
+
+        #if defined(AVEL_SSSE3)
+        {
+            const auto pack = _mm_load_si128(reinterpret_cast<const __m128i*>(tables.pack_indices));
+
+            for (; i + 16 <= n; i += 16, o += 12) {
+                auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+                __m128i values;
+                if (!decode_characters(chars, tables, values)) {
+                    return i;
+                }
+
+                auto bytes = _mm_shuffle_epi8(decode_merge(values), pack);
+
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + o), bytes);
+                std::uint32_t last = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(bytes, 8)));
+                std::memcpy(out + o + 8, &last, sizeof(last));
+            }
+        }
+        #endif
+
+        (void)in;
+        (void)n;
+        (void)out;
+        (void)tables;
+        (void)o;
+
+        return i;
+    }
+
+    ///
+    /// \return Number of characters which encode data in a base64 string of
+    ///     length n, excluding any padding
+    inline std::size_t base64_data_length(const std::uint8_t* in, std::size_t n) {
+        std::size_t m = n;
+        if (n != 0 && n % 4 == 0) {
+            m -= (in[n - 1] == '=');
+            m -= (in[n - 1] == '=' && in[n - 2] == '=');
+        }
+
+        return m;
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Base64 encoding
+    //=====================================================
+
+    ///
+    /// \param n Number of bytes to encode
+    /// \param padding Whether the output is padded to a multiple of four
+    ///     characters using '='
+    /// \return Number of characters produced by encoding n bytes
+    inline std::size_t base64_encoded_size(std::size_t n, bool padding = true) {
+        if (padding) {
+            return (n + 2) / 3 * 4;
+        }
+
+        return n / 3 * 4 + (n % 3 == 0 ? 0 : n % 3 + 1);
+    }
+
+    ///
+    /// Encodes bytes as base64.
+    ///
+    /// Blocks of bytes are split into 6-bit values and mapped to characters
+    /// using vector byte shuffles. With AVX-512 VBMI, each 48-byte block is
+    /// handled using vpermb and vpmultishiftqb.
+    ///
+    /// \param in View over bytes to encode
+    /// \param out View to write characters to. Must have room for at least
+    ///     base64_encoded_size(in.size(), padding) characters
+    /// \param alphabet Alphabet to encode with
+    /// \param padding Whether the output is padded to a multiple of four
+    ///     characters using '='
+    /// \return Number of characters written
+    template<std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    std::size_t base64_encode(
+        Vectorized_view<const std::uint8_t, E0, A0> in,
+        Vectorized_view<std::uint8_t, E1, A1> out,
+        Base64_alphabet alphabet = Base64_alphabet::standard,
+        bool padding = true
+    ) {
+        const auto& tables = avel_impl::base64_tables(alphabet);
+
+        const std::uint8_t* src = in.data();
+        std::uint8_t* dst = out.data();
+        const std::size_t n = in.size();
+
+        std::size_t i = avel_impl::base64_encode_blocks(src, n, dst, tables);
+        std::size_t o = i / 3 * 4;
+
+        for (; i + 3 <= n; i += 3, o += 4) {
+            std::uint32_t bits = (std::uint32_t(src[i]) << 16) | (std::uint32_t(src[i + 1]) << 8) | src[i + 2];
+            dst[o + 0] = tables.encode[(bits >> 18) & 0x3F];
+            dst[o + 1] = tables.encode[(bits >> 12) & 0x3F];
+            dst[o + 2] = tables.encode[(bits >>  6) & 0x3F];
+            dst[o + 3] = tables.encode[(bits >>  0) & 0x3F];
+        }
+
+        if (i < n) {
+            std::uint32_t bits = std::uint32_t(src[i]) << 16;
+            if (i + 1 < n) {
+                bits |= std::uint32_t(src[i + 1]) << 8;
+            }
+
+            dst[o++] = tables.encode[(bits >> 18) & 0x3F];
+            dst[o++] = tables.encode[(bits >> 12) & 0x3F];
+            if (i + 1 < n) {
+                dst[o++] = tables.encode[(bits >> 6) & 0x3F];
+            } else if (padding) {
+                dst[o++] = '=';
+            }
+
+            if (padding) {
+                dst[o++] = '=';
+            }
+        }
+
+        return o;
+    }
+
+    //=====================================================
+    // Base64 decoding
+    //=====================================================
+
+    ///
+    /// \param in View over base64 characters
+    /// \return Number of bytes that in decodes to, assuming it's valid
+    template<std::size_t E, std::size_t A>
+    std::size_t base64_decoded_size(Vectorized_view<const std::uint8_t, E, A> in) {
+        std::size_t m = avel_impl::base64_data_length(in.data(), in.size());
+        return m / 4 * 3 + (m % 4 == 0 ? 0 : m % 4 - 1);
+    }
+
+    ///
+    /// Decodes base64 characters into bytes.
+    ///
+    /// The input may be padded to a multiple of four characters using '=', or
+    /// unpadded. Whitespace is not accepted.
+    ///
+    /// Characters are translated to 6-bit values and merged into bytes using
+    /// vector instructions. Characters outside of the alphabet are detected
+    /// while translating each block, so no separate validation pass is made.
+    /// With AVX-512 VBMI, translation is a single two-table vpermi2b lookup.
+    ///
+    /// \param in View over characters to decode
+    /// \param out View to write bytes to. Must have room for at least
+    ///     base64_decoded_size(in) bytes
+    /// \param alphabet Alphabet to decode with
+    /// \return Transcode_result describing how much of in was decoded. If in
+    ///     is invalid, read is the offset of the first invalid character, or
+    ///     of the final character if in has an impossible length
+    template<std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    Transcode_result base64_decode(
+        Vectorized_view<const std::uint8_t, E0, A0> in,
+        Vectorized_view<std::uint8_t, E1, A1> out,
+        Base64_alphabet alphabet = Base64_alphabet::standard
+    ) {
+        const auto& tables = avel_impl::base64_tables(alphabet);
+
+        const std::uint8_t* src = in.data();
+        std::uint8_t* dst = out.data();
+        const std::size_t n = in.size();
+        const std::size_t m = avel_impl::base64_data_length(src, n);
+
+        std::size_t i = avel_impl::base64_decode_blocks(src, m, dst, tables);
+        std::size_t o = i / 4 * 3;
+
+        // Handles the remaining characters, including any block rejected by
+        // the kernels, which locates the exact position of the invalid
+        // character
+        std::uint32_t bits = 0;
+        std::size_t pending = 0;
+        for (; i < m; ++i) {
+            std::uint8_t value = tables.decode[src[i]];
+            if (value == avel_impl::base64_invalid) {
+                return {i, o};
+            }
+
+            bits = (bits << 6) | value;
+            if (++pending == 4) {
+                dst[o + 0] = static_cast<std::uint8_t>(bits >> 16);
+                dst[o + 1] = static_cast<std::uint8_t>(bits >>  8);
+                dst[o + 2] = static_cast<std::uint8_t>(bits >>  0);
+                o += 3;
+
+                bits = 0;
+                pending = 0;
+            }
+        }
+
+        switch (pending) {
+            case 1:
+                // A single trailing character can't encode a whole byte
+                return {m - 1, o};
+            case 2:
+                dst[o++] = static_cast<std::uint8_t>(bits >> 4);
+                break;
+            case 3:
+                dst[o++] = static_cast<std::uint8_t>(bits >> 10);
+                dst[o++] = static_cast<std::uint8_t>(bits >> 2);
+                break;
+            default:
+                break;
+        }
+
+        return {n, o};
+    }
+
+}
+
+#endif //AVEL_BASE64_HPP
@@ -0,0 +1,212 @@
+#ifndef AVEL_BITMAP_HPP
+#define AVEL_BITMAP_HPP
+
+namespace avel_impl {
+
+    using Bitmap_vector = avel::Vector<std::uint64_t, avel::natural_width_64u>;
+
+    ///
+    /// Reads the words of a single bitmap
+    ///
+    struct Bitmap_source {
+
+        const std::uint64_t* ptr;
+
+        AVEL_FINL Bitmap_vector operator()(std::size_t i) const {
+            return avel::load<Bitmap_vector>(ptr + i);
+        }
+
+        AVEL_FINL Bitmap_vector operator()(std::size_t i, std::uint32_t n) const {
+            return avel::load<Bitmap_vector>(ptr + i, n);
+        }
+
+    };
+
+    ///
+    /// Reads the words of two bitmaps, combining them using Op
+    ///
+    template<class Op>
+    struct Bitmap_pair_source {
+
+        const std::uint64_t* a;
+        const std::uint64_t* b;
+
+        AVEL_FINL Bitmap_vector operator()(std::size_t i) const {
+            return Op{}(avel::load<Bitmap_vector>(a + i), avel::load<Bitmap_vector>(b + i));
+        }
+
+        AVEL_FINL Bitmap_vector operator()(std::size_t i, std::uint32_t n) const {
+            return Op{}(avel::load<Bitmap_vector>(a + i, n), avel::load<Bitmap_vector>(b + i, n));
+        }
+
+    };
+
+    ///
+    /// Carry-save adder. Adds the bits of a, b, and c position-wise, placing
+    /// the two-bit sums' high bits in high and low bits in low
+    ///
+    template<class V>
+    AVEL_FINL void carry_save_add(V& high, V& low, V a, V b, V c) {
+        auto u = a ^ b;
+        high = (a & b) | (u & c);
+        low = u ^ c;
+    }
+
+    ///
+    /// \param source Function object producing the vectors of words to count
+    /// \param n Number of words to count
+    /// \return Number of set bits in the first n words produced by source
+    ///
+    template<class Source>
+    std::uint64_t bitmap_popcount(Source source, std::size_t n) {
+        using vec = Bitmap_vector;
+        constexpr std::size_t width = vec::width;
+
+        vec total{0x00};
+        std::size_t i = 0;
+
+        #if defined(AVEL_AVX512VPOPCNTDQ)
+        // Population counts are a single instruction, so the only concern is
+        // keeping several of them in flight
+        vec total1{0x00};
+        vec total2{0x00};
+        vec total3{0x00};
+        for (; i + 4 * width <= n; i += 4 * width) {
+            total  += popcount(source(i + 0 * width));
+            total1 += popcount(source(i + 1 * width));
+            total2 += popcount(source(i + 2 * width));
+            total3 += popcount(source(i + 3 * width));
+        }
+
+        total = (total + total1) + (total2 + total3);
+
+        #else
+        // Harley-Seal: a tree of carry-save adders reduces sixteen vectors to
+        // one vector of bits with weight sixteen, so only one population
+        // count is performed per sixteen vectors. The partial sums of lower
+        // weight are carried between iterations and counted at the end
+        vec ones{0x00};
+        vec twos{0x00};
+        vec fours{0x00};
+        vec eights{0x00};
+
+        for (; i + 16 * width <= n; i += 16 * width) {
+            vec twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens;
+
+            carry_save_add(twos_a, ones, ones, source(i + 0x0 * width), source(i + 0x1 * width));
+            carry_save_add(twos_b, ones, ones, source(i + 0x2 * width), source(i + 0x3 * width));
+            carry_save_add(fours_a, twos, twos, twos_a, twos_b);
+            carry_save_add(twos_a, ones, ones, source(i + 0x4 * width), source(i + 0x5 * width));
+            carry_save_add(twos_b, ones, ones, source(i + 0x6 * width), source(i + 0x7 * width));
+            carry_save_add(fours_b, twos, twos, twos_a, twos_b);
+            carry_save_add(eights_a, fours, fours, fours_a, fours_b);
+
+            carry_save_add(twos_a, ones, ones, source(i + 0x8 * width), source(i + 0x9 * width));
+            carry_save_add(twos_b, ones, ones, source(i + 0xA * width), source(i + 0xB * width));
+            carry_save_add(fours_a, twos, twos, twos_a, twos_b);
+            carry_save_add(twos_a, ones, ones, source(i + 0xC * width), source(i + 0xD * width));
+            carry_save_add(twos_b, ones, ones, source(i + 0xE * width), source(i + 0xF * width));
+            carry_save_add(fours_b, twos, twos, twos_a, twos_b);
+            carry_save_add(eights_b, fours, fours, fours_a, fours_b);
+
+            carry_save_add(sixteens, eights, eights, eights_a, eights_b);
+
+            total += popcount(sixteens);
+        }
+
+        total = (total << 4) + (popcount(eights) << 3) + (popcount(fours) << 2) + (popcount(twos) << 1) + popcount(ones);
+
+        #endif
+
+        for (; i + width <= n; i += width) {
+            total += popcount(source(i));
+        }
+
+        if (i < n) {
+            // Lanes past the end are loaded as zeros
+            total += popcount(source(i, static_cast<std::uint32_t>(n - i)));
+        }
+
+        std::uint64_t ret = 0;
+        for (auto x : avel::to_array(total)) {
+            ret += x;
+        }
+
+        return ret;
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Bitmaps
+    //=====================================================
+
+    ///
+    /// Counts the set bits in a bitmap.
+    ///
+    /// If AVX-512 VPOPCNTDQ is available, each vector is counted directly.
+    /// Otherwise, the Harley-Seal method is used, which combines sixteen
+    /// vectors using carry-save adders before counting, so that only one
+    /// vector population count is performed per sixteen vectors of input.
+    ///
+    /// \param bits View over the words of the bitmap
+    /// \return Number of set bits in bits
+    ///
+    template<std::size_t E, std::size_t A>
+    std::uint64_t popcount(Vectorized_view<const std::uint64_t, E, A> bits) {
+        return avel_impl::bitmap_popcount(avel_impl::Bitmap_source{bits.data()}, bits.size());
+    }
+
+    ///
+    /// Counts the set bits in the intersection of two bitmaps without
+    /// materializing it.
+    ///
+    /// \param a View over the words of the first bitmap
+    /// \param b View over the words of the second bitmap
+    /// \return Number of set bits in a & b. If the views differ in size, only
+    ///     the words of the shorter one and the corresponding words of the
+    ///     longer one are considered
+    ///
+    template<std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    std::uint64_t and_count(Vectorized_view<const std::uint64_t, E0, A0> a, Vectorized_view<const std::uint64_t, E1, A1> b) {
+        avel_impl::Bitmap_pair_source<std::bit_and<avel_impl::Bitmap_vector>> source{a.data(), b.data()};
+        return avel_impl::bitmap_popcount(source, std::min(a.size(), b.size()));
+    }
+
+    ///
+    /// Counts the set bits in the union of two bitmaps without materializing
+    /// it.
+    ///
+    /// \param a View over the words of the first bitmap
+    /// \param b View over the words of the second bitmap
+    /// \return Number of set bits in a | b. If the views differ in size, only
+    ///     the words of the shorter one and the corresponding words of the
+    ///     longer one are considered
+    ///
+    template<std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    std::uint64_t or_count(Vectorized_view<const std::uint64_t, E0, A0> a, Vectorized_view<const std::uint64_t, E1, A1> b) {
+        avel_impl::Bitmap_pair_source<std::bit_or<avel_impl::Bitmap_vector>> source{a.data(), b.data()};
+        return avel_impl::bitmap_popcount(source, std::min(a.size(), b.size()));
+    }
+
+    ///
+    /// Counts the bits which differ between two bitmaps, i.e. their Hamming
+    /// distance.
+    ///
+    /// \param a View over the words of the first bitmap
+    /// \param b View over the words of the second bitmap
+    /// \return Number of set bits in a ^ b. If the views differ in size, only
+    ///     the words of the shorter one and the corresponding words of the
+    ///     longer one are considered
+    ///
+    template<std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    std::uint64_t xor_count(Vectorized_view<const std::uint64_t, E0, A0> a, Vectorized_view<const std::uint64_t, E1, A1> b) {
+        avel_impl::Bitmap_pair_source<std::bit_xor<avel_impl::Bitmap_vector>> source{a.data(), b.data()};
+        return avel_impl::bitmap_popcount(source, std::min(a.size(), b.size()));
+    }
+
+}
+
+#endif //AVEL_BITMAP_HPP
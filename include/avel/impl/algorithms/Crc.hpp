@@ -0,0 +1,518 @@
+#ifndef AVEL_CRC_HPP
+#define AVEL_CRC_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // CRC tables
+    //=====================================================
+
+    // All CRCs here are reflected, meaning that the first bit of the input is
+    // the least significant bit of its first byte, and that it corresponds to
+    // the highest power of x. The running state of a CRC is likewise stored
+    // with the highest power of x in its least significant bit
+
+    /// Reflected CRC-32C (Castagnoli) polynomial
+    constexpr std::uint32_t crc32c_polynomial = 0x82F63B78;
+
+    /// Reflected CRC-32 (IEEE 802.3) polynomial
+    constexpr std::uint32_t crc32_polynomial = 0xEDB88320;
+
+    /// Number of bytes processed by each of the three interleaved streams of
+    /// crc32 instructions
+    constexpr std::size_t crc_short_stream = 256;
+    constexpr std::size_t crc_long_stream = 4096;
+
+    AVEL_FINL std::uint32_t reflect32(std::uint32_t x) {
+        std::uint32_t ret = 0;
+        for (std::size_t i = 0; i < 32; ++i) {
+            ret |= ((x >> i) & 1) << (31 - i);
+        }
+
+        return ret;
+    }
+
+    ///
+    /// Lookup tables and constants for a particular CRC polynomial. These are
+    /// derived from the polynomial itself so that both CRCs share a single
+    /// set of kernels
+    ///
+    struct Crc32_tables {
+
+        std::uint32_t polynomial;
+
+        /// Tables for processing eight bytes at a time, where slices[k]
+        /// accounts for a byte followed by k others
+        std::uint32_t slices[8][256];
+
+        // Constants which fold a 128-bit block onto the block a given number
+        // of bits ahead of it. The first of each pair multiplies the low
+        // 64 bits of the block, the second multiplies the high 64 bits
+
+        alignas(16) std::uint64_t fold_128[2];
+        alignas(16) std::uint64_t fold_256[2];
+        alignas(16) std::uint64_t fold_384[2];
+        alignas(16) std::uint64_t fold_512[2];
+        alignas(16) std::uint64_t fold_1024[2];
+        alignas(16) std::uint64_t fold_1536[2];
+        alignas(16) std::uint64_t fold_2048[2];
+
+        // Constants which advance a CRC state past a run of zero bytes one,
+        // or two times the length of a stream. The first of each pair is
+        // used with carry-less multiplication, the second with multiply()
+
+        std::uint32_t shift_short[2][2];
+        std::uint32_t shift_long[2][2];
+
+        explicit Crc32_tables(std::uint32_t p):
+            polynomial(p) {
+
+            for (std::uint32_t i = 0; i < 256; ++i) {
+                std::uint32_t crc = i;
+                for (std::size_t j = 0; j < 8; ++j) {
+                    crc = (crc >> 1) ^ ((crc & 1) ? p : 0);
+                }
+
+                slices[0][i] = crc;
+            }
+
+            for (std::size_t k = 1; k < 8; ++k) {
+                for (std::size_t i = 0; i < 256; ++i) {
+                    std::uint32_t prev = slices[k - 1][i];
+                    slices[k][i] = (prev >> 8) ^ slices[0][prev & 0xFF];
+                }
+            }
+
+            set_fold(fold_128, 128);
+            set_fold(fold_256, 256);
+            set_fold(fold_384, 384);
+            set_fold(fold_512, 512);
+            set_fold(fold_1024, 1024);
+            set_fold(fold_1536, 1536);
+            set_fold(fold_2048, 2048);
+
+            set_shift(shift_short[0], crc_short_stream);
+            set_shift(shift_short[1], 2 * crc_short_stream);
+            set_shift(shift_long[0], crc_long_stream);
+            set_shift(shift_long[1], 2 * crc_long_stream);
+        }
+
+        ///
+        /// \return The product of a and b modulo the polynomial, where all
+        ///     three are reflected
+        std::uint32_t multiply(std::uint32_t a, std::uint32_t b) const {
+            std::uint32_t ret = 0;
+            for (std::size_t i = 0; i < 32; ++i) {
+                if (a & (std::uint32_t(1) << (31 - i))) {
+                    ret ^= b;
+                }
+
+                b = (b >> 1) ^ ((b & 1) ? polynomial : 0);
+            }
+
+            return ret;
+        }
+
+    private:
+
+        ///
+        /// \return x^n modulo the polynomial, reflected
+        std::uint32_t power_of_x(std::size_t n) const {
+            // x^0
+            std::uint32_t ret = 0x80000000;
+            for (std::size_t i = 0; i < n; ++i) {
+                ret = (ret >> 1) ^ ((ret & 1) ? polynomial : 0);
+            }
+
+            return ret;
+        }
+
+        void set_fold(std::uint64_t* fold, std::size_t bits) const {
+            // Carry-less multiplication of reflected operands produces a
+            // product multiplied by an extra factor of x, hence the -1
+            fold[0] = std::uint64_t(power_of_x(bits + 64 - 1)) << 32;
+            fold[1] = std::uint64_t(power_of_x(bits - 1)) << 32;
+        }
+
+        void set_shift(std::uint32_t* shift, std::size_t bytes) const {
+            // The carry-less product gains a factor of x, and reducing it with
+            // the crc32 instruction another x^32
+            shift[0] = power_of_x(8 * bytes - 33);
+            shift[1] = power_of_x(8 * bytes);
+        }
+
+    };
+
+    inline const Crc32_tables& crc32c_tables() {
+        static const Crc32_tables tables{crc32c_polynomial};
+        return tables;
+    }
+
+    inline const Crc32_tables& crc32_tables() {
+        static const Crc32_tables tables{crc32_polynomial};
+        return tables;
+    }
+
+    //=====================================================
+    // Table driven CRC
+    //=====================================================
+
+    ///
+    /// \return state after processing n bytes of ptr eight at a time
+    inline std::uint32_t crc_table_update(std::uint32_t state, const std::uint8_t* ptr, std::size_t n, const Crc32_tables& tables) {
+        const auto& t = tables.slices;
+
+        std::size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            std::uint32_t lo;
+            std::uint32_t hi;
+            std::memcpy(&lo, ptr + i + 0, sizeof(lo));
+            std::memcpy(&hi, ptr + i + 4, sizeof(hi));
+            lo ^= state;
+
+            state =
+                t[7][(lo >>  0) & 0xFF] ^ t[6][(lo >>  8) & 0xFF] ^
+                t[5][(lo >> 16) & 0xFF] ^ t[4][(lo >> 24) & 0xFF] ^
+                t[3][(hi >>  0) & 0xFF] ^ t[2][(hi >>  8) & 0xFF] ^
+                t[1][(hi >> 16) & 0xFF] ^ t[0][(hi >> 24) & 0xFF];
+        }
+
+        for (; i < n; ++i) {
+            state = (state >> 8) ^ t[0][(state ^ ptr[i]) & 0xFF];
+        }
+
+        return state;
+    }
+
+    //=====================================================
+    // Carry-less multiplication folding
+    //=====================================================
+
+    // The input is split into 128-bit blocks which are repeatedly folded onto
+    // blocks further ahead, preserving their value modulo the polynomial.
+    // Once a single block remains, it's reduced using the tables
+
+    /// Number of bytes below which folding is not used
+    constexpr std::size_t crc_fold_threshold = 128;
+
+    #if defined(AVEL_PCLMUL)
+
+    AVEL_FINL __m128i crc_fold(__m128i x, __m128i k) {
+        return _mm_xor_si128(
+            _mm_clmulepi64_si128(x, k, 0x00),
+            _mm_clmulepi64_si128(x, k, 0x11)
+        );
+    }
+
+    AVEL_FINL __m128i crc_fold_constant(const std::uint64_t* fold) {
+        return _mm_load_si128(reinterpret_cast<const __m128i*>(fold));
+    }
+
+    ///
+    /// Folds any remaining 16-byte blocks into x, then reduces it
+    ///
+    /// \return Number of bytes processed
+    AVEL_FINL std::size_t crc_fold_finish(__m128i x, std::size_t i, std::uint32_t& state, const std::uint8_t* ptr, std::size_t n, const Crc32_tables& tables) {
+        const __m128i k128 = crc_fold_constant(tables.fold_128);
+        for (; i + 16 <= n; i += 16) {
+            x = _mm_xor_si128(crc_fold(x, k128), _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + i)));
+        }
+
+        alignas(16) std::uint8_t block[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(block), x);
+        state = crc_table_update(0, block, sizeof(block), tables);
+
+        return i;
+    }
+
+    ///
+    /// Folds 64 bytes per iteration using four 128-bit accumulators
+    ///
+    /// \return Number of bytes processed
+    inline std::size_t crc_fold_128(std::uint32_t& state, const std::uint8_t* ptr, std::size_t n, const Crc32_tables& tables) {
+        if (n < crc_fold_threshold) {
+            return 0;
+        }
+
+        auto load = [ptr] (std::size_t i) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + i));
+        };
+
+        // The initial state is equivalent to XORing it into the first bytes
+        __m128i x0 = _mm_xor_si128(load(0x00), _mm_cvtsi32_si128(static_cast<int>(state)));
+        __m128i x1 = load(0x10);
+        __m128i x2 = load(0x20);
+        __m128i x3 = load(0x30);
+
+        const __m128i k512 = crc_fold_constant(tables.fold_512);
+
+        std::size_t i = 64;
+        for (; i + 64 <= n; i += 64) {
+            x0 = _mm_xor_si128(crc_fold(x0, k512), load(i + 0x00));
+            x1 = _mm_xor_si128(crc_fold(x1, k512), load(i + 0x10));
+            x2 = _mm_xor_si128(crc_fold(x2, k512), load(i + 0x20));
+            x3 = _mm_xor_si128(crc_fold(x3, k512), load(i + 0x30));
+        }
+
+        __m128i x = _mm_xor_si128(
+            _mm_xor_si128(crc_fold(x0, crc_fold_constant(tables.fold_384)), crc_fold(x1, crc_fold_constant(tables.fold_256))),
+            _mm_xor_si128(crc_fold(x2, crc_fold_constant(tables.fold_128)), x3)
+        );
+
+        return crc_fold_finish(x, i, state, ptr, n, tables);
+    }
+
+    #endif
+
+    #if defined(AVEL_VPCLMULQDQ) && defined(AVEL_AVX512F)
+
+    AVEL_FINL __m512i crc_fold(__m512i x, __m512i k) {
+        return _mm512_xor_si512(
+            _mm512_clmulepi64_epi128(x, k, 0x00),
+            _mm512_clmulepi64_epi128(x, k, 0x11)
+        );
+    }
+
+    ///
+    /// Folds 256 bytes per iteration using four 512-bit accumulators
+    ///
+    /// \return Number of bytes processed
+    inline std::size_t crc_fold_512(std::uint32_t& state, const std::uint8_t* ptr, std::size_t n, const Crc32_tables& tables) {
+        if (n < 2 * 256) {
+            return crc_fold_128(state, ptr, n, tables);
+        }
+
+        auto load = [ptr] (std::size_t i) {
+            return _mm512_loadu_si512(ptr + i);
+        };
+
+        auto broadcast = [] (const std::uint64_t* fold) {
+            return _mm512_broadcast_i32x4(crc_fold_constant(fold));
+        };
+
+        __m512i initial = _mm512_inserti32x4(_mm512_setzero_si512(), _mm_cvtsi32_si128(static_cast<int>(state)), 0);
+        __m512i z0 = _mm512_xor_si512(load(0x00), initial);
+        __m512i z1 = load(0x40);
+        __m512i z2 = load(0x80);
+        __m512i z3 = load(0xC0);
+
+        const __m512i k2048 = broadcast(tables.fold_2048);
+
+        std::size_t i = 256;
+        for (; i + 256 <= n; i += 256) {
+            z0 = _mm512_xor_si512(crc_fold(z0, k2048), load(i + 0x00));
+            z1 = _mm512_xor_si512(crc_fold(z1, k2048), load(i + 0x40));
+            z2 = _mm512_xor_si512(crc_fold(z2, k2048), load(i + 0x80));
+            z3 = _mm512_xor_si512(crc_fold(z3, k2048), load(i + 0xC0));
+        }
+
+        __m512i z = _mm512_xor_si512(
+            _mm512_xor_si512(crc_fold(z0, broadcast(tables.fold_1536)), crc_fold(z1, broadcast(tables.fold_1024))),
+            _mm512_xor_si512(crc_fold(z2, broadcast(tables.fold_512)), z3)
+        );
+
+        const __m512i k512 = broadcast(tables.fold_512);
+        for (; i + 64 <= n; i += 64) {
+            z = _mm512_xor_si512(crc_fold(z, k512), load(i));
+        }
+
+        // Fold the four 128-bit lanes of z onto its last
+        __m128i x0 = _mm512_extracti32x4_epi32(z, 0);
+        __m128i x1 = _mm512_extracti32x4_epi32(z, 1);
+        __m128i x2 = _mm512_extracti32x4_epi32(z, 2);
+        __m128i x3 = _mm512_extracti32x4_epi32(z, 3);
+
+        __m128i x = _mm_xor_si128(
+            _mm_xor_si128(crc_fold(x0, crc_fold_constant(tables.fold_384)), crc_fold(x1, crc_fold_constant(tables.fold_256))),
+            _mm_xor_si128(crc_fold(x2, crc_fold_constant(tables.fold_128)), x3)
+        );
+
+        return crc_fold_finish(x, i, state, ptr, n, tables);
+    }
+
+    #endif
+
+    ///
+    /// Processes a prefix of ptr using the widest available carry-less
+    /// multiplication
+    ///
+    /// \return Number of bytes processed
+    AVEL_FINL std::size_t crc_fold_blocks(std::uint32_t& state, const std::uint8_t* ptr, std::size_t n, const Crc32_tables& tables) {
+        #if defined(AVEL_VPCLMULQDQ) && defined(AVEL_AVX512F)
+        return crc_fold_512(state, ptr, n, tables);
+
+        #elif defined(AVEL_PCLMUL)
+        return crc_fold_128(state, ptr, n, tables);
+
+        #else
+        (void)state;
+        (void)ptr;
+        (void)n;
+        (void)tables;
+        return 0;
+
+        #endif
+    }
+
+    //=====================================================
+    // Hardware CRC-32C
+    //=====================================================
+
+    #if defined(AVEL_SSE4_2)
+
+    ///
+    /// \return state advanced past a number of zero bytes described by
+    ///     shift, one of the pairs in Crc32_tables
+    AVEL_FINL std::uint32_t crc32c_shift(std::uint32_t state, const std::uint32_t* shift, const Crc32_tables& tables) {
+        #if defined(AVEL_PCLMUL)
+        (void)tables;
+        __m128i product = _mm_clmulepi64_si128(
+            _mm_cvtsi32_si128(static_cast<int>(state)),
+            _mm_cvtsi32_si128(static_cast<int>(shift[0])),
+            0x00
+        );
+
+        return static_cast<std::uint32_t>(_mm_crc32_u64(0, static_cast<std::uint64_t>(_mm_cvtsi128_si64(product))));
+
+        #else
+        return tables.multiply(shift[1], state);
+
+        #endif
+    }
+
+    ///
+    /// Processes blocks of three streams of the given length. The crc32
+    /// instruction has a latency of three cycles but a throughput of one per
+    /// cycle, so three independent streams keep it busy. The streams are
+    /// combined by advancing the earlier ones past the bytes that follow them
+    ///
+    /// \return Number of bytes processed
+    template<std::size_t L>
+    AVEL_FINL std::size_t crc32c_streams(std::uint32_t& state, const std::uint8_t* ptr, std::size_t n, const std::uint32_t (&shift)[2][2], const Crc32_tables& tables) {
+        auto load = [] (const std::uint8_t* p) {
+            std::uint64_t ret;
+            std::memcpy(&ret, p, sizeof(ret));
+            return ret;
+        };
+
+        std::size_t i = 0;
+        for (; i + 3 * L <= n; i += 3 * L) {
+            std::uint64_t a = state;
+            std::uint64_t b = 0;
+            std::uint64_t c = 0;
+
+            const std::uint8_t* p = ptr + i;
+            for (std::size_t j = 0; j < L; j += 8) {
+                a = _mm_crc32_u64(a, load(p + 0 * L + j));
+                b = _mm_crc32_u64(b, load(p + 1 * L + j));
+                c = _mm_crc32_u64(c, load(p + 2 * L + j));
+            }
+
+            state =
+                crc32c_shift(static_cast<std::uint32_t>(a), shift[1], tables) ^
+                crc32c_shift(static_cast<std::uint32_t>(b), shift[0], tables) ^
+                static_cast<std::uint32_t>(c);
+        }
+
+        return i;
+    }
+
+    inline std::uint32_t crc32c_hardware(std::uint32_t state, const std::uint8_t* ptr, std::size_t n, const Crc32_tables& tables) {
+        std::size_t i = 0;
+        i += crc32c_streams<crc_long_stream>(state, ptr + i, n - i, tables.shift_long, tables);
+        i += crc32c_streams<crc_short_stream>(state, ptr + i, n - i, tables.shift_short, tables);
+
+        std::uint64_t s = state;
+        for (; i + 8 <= n; i += 8) {
+            std::uint64_t block;
+            std::memcpy(&block, ptr + i, sizeof(block));
+            s = _mm_crc32_u64(s, block);
+        }
+
+        state = static_cast<std::uint32_t>(s);
+        for (; i < n; ++i) {
+            state = _mm_crc32_u8(state, ptr[i]);
+        }
+
+        return state;
+    }
+
+    #endif
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // CRC
+    //=====================================================
+
+    ///
+    /// Computes the CRC-32C (Castagnoli) checksum of data, as used by iSCSI,
+    /// ext4, and many storage formats.
+    ///
+    /// On targets supporting SSE4.2, the crc32 instruction is used, with
+    /// long inputs split into three interleaved streams. When VPCLMULQDQ and
+    /// AVX-512 are available, long inputs are instead reduced by carry-less
+    /// multiplication, 256 bytes at a time. Other targets use carry-less
+    /// multiplication where available, and eight-byte table lookups otherwise.
+    ///
+    /// \param data View over bytes to checksum
+    /// \param crc The checksum of preceding data, allowing a checksum to be
+    ///     computed incrementally
+    /// \return Checksum of the preceding data followed by data
+    template<std::size_t E, std::size_t A>
+    std::uint32_t crc32c(Vectorized_view<const std::uint8_t, E, A> data, std::uint32_t crc = 0) {
+        const auto& tables = avel_impl::crc32c_tables();
+
+        const std::uint8_t* ptr = data.data();
+        std::size_t n = data.size();
+        std::uint32_t state = ~crc;
+
+        #if defined(AVEL_SSE4_2)
+        #if defined(AVEL_VPCLMULQDQ) && defined(AVEL_AVX512F)
+        std::size_t i = avel_impl::crc_fold_512(state, ptr, n, tables);
+        ptr += i;
+        n -= i;
+        #endif
+
+        state = avel_impl::crc32c_hardware(state, ptr, n, tables);
+
+        #else
+        std::size_t i = avel_impl::crc_fold_blocks(state, ptr, n, tables);
+        state = avel_impl::crc_table_update(state, ptr + i, n - i, tables);
+
+        #endif
+
+        return ~state;
+    }
+
+    ///
+    /// Computes the CRC-32 checksum of data, as used by Ethernet, zlib, and
+    /// PNG.
+    ///
+    /// Long inputs are reduced by carry-less multiplication where available,
+    /// using 512-bit vectors if VPCLMULQDQ and AVX-512 are supported. The
+    /// remainder is processed using eight-byte table lookups.
+    ///
+    /// \param data View over bytes to checksum
+    /// \param crc The checksum of preceding data, allowing a checksum to be
+    ///     computed incrementally
+    /// \return Checksum of the preceding data followed by data
+    template<std::size_t E, std::size_t A>
+    std::uint32_t crc32(Vectorized_view<const std::uint8_t, E, A> data, std::uint32_t crc = 0) {
+        const auto& tables = avel_impl::crc32_tables();
+
+        const std::uint8_t* ptr = data.data();
+        const std::size_t n = data.size();
+        std::uint32_t state = ~crc;
+
+        std::size_t i = avel_impl::crc_fold_blocks(state, ptr, n, tables);
+        state = avel_impl::crc_table_update(state, ptr + i, n - i, tables);
+
+        return ~state;
+    }
+
+}
+
+#endif //AVEL_CRC_HPP
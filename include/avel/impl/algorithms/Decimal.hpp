@@ -0,0 +1,365 @@
+#ifndef AVEL_DECIMAL_HPP
+#define AVEL_DECIMAL_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // Formatting
+    //=====================================================
+
+    template<class T>
+    using Decimal_vector = avel::Vector<T, avel::natural_vector_width<T>::value>;
+
+    ///
+    /// Number of bytes in the right-aligned digit strings produced by
+    /// decimal_strings(). This is the number of digits in the largest value of
+    /// T, rounded up to a multiple of four
+    ///
+    template<class T>
+    constexpr std::size_t decimal_string_width() {
+        return (sizeof(T) == sizeof(std::uint32_t)) ? 12 : 20;
+    }
+
+    template<class V>
+    struct Decimal_denominators {
+        using scalar = typename V::scalar;
+
+        avel::Denominator<V> d10;
+        avel::Denominator<V> d100;
+        avel::Denominator<V> d10000;
+        avel::Denominator<V> d100000000;
+
+        Decimal_denominators():
+            d10(V{scalar(10)}),
+            d100(V{scalar(100)}),
+            d10000(V{scalar(10000)}),
+            d100000000(V{scalar(100000000)}) {}
+    };
+
+    ///
+    /// Converts each lane holding a value less than 10000 into four ASCII
+    /// digits stored in the lane's low bytes, most significant digit first
+    ///
+    template<class V>
+    AVEL_FINL V pack_4_digits(V v, const Decimal_denominators<V>& d) {
+        auto ab_cd = div(v, d.d100);
+        auto a_b = div(ab_cd.quot, d.d10);
+        auto c_d = div(ab_cd.rem, d.d10);
+
+        V digits = a_b.quot | (a_b.rem << 8) | (c_d.quot << 16) | (c_d.rem << 24);
+        return digits | V{typename V::scalar(0x30303030)};
+    }
+
+    ///
+    /// \return Number of decimal digits in each lane of v
+    ///
+    template<class V>
+    AVEL_FINL V decimal_digit_counts(V v) {
+        using scalar = typename V::scalar;
+
+        V counts{scalar(1)};
+        scalar power = 10;
+        for (std::size_t i = 1; i < std::numeric_limits<scalar>::digits10 + 1; ++i) {
+            counts += V{v >= V{power}};
+            power = scalar(power * 10);
+        }
+
+        return counts;
+    }
+
+    ///
+    /// Writes the twelve digit representation of each lane of v, padded with
+    /// leading zeros, to consecutive rows of strings
+    ///
+    template<std::uint32_t N>
+    AVEL_FINL void decimal_strings(
+        avel::Vector<std::uint32_t, N> v,
+        const Decimal_denominators<avel::Vector<std::uint32_t, N>>& d,
+        std::uint8_t (*strings)[decimal_string_width<std::uint32_t>()]
+    ) {
+        auto high_low = div(v, d.d100000000);
+        auto mid_low = div(high_low.rem, d.d10000);
+
+        auto high = to_array(pack_4_digits(high_low.quot, d));
+        auto mid  = to_array(pack_4_digits(mid_low.quot, d));
+        auto low  = to_array(pack_4_digits(mid_low.rem, d));
+
+        for (std::size_t i = 0; i < N; ++i) {
+            std::memcpy(strings[i] + 0, &high[i], 4);
+            std::memcpy(strings[i] + 4, &mid[i],  4);
+            std::memcpy(strings[i] + 8, &low[i],  4);
+        }
+    }
+
+    ///
+    /// Writes the twenty digit representation of each lane of v, padded with
+    /// leading zeros, to consecutive rows of strings
+    ///
+    template<std::uint32_t N>
+    AVEL_FINL void decimal_strings(
+        avel::Vector<std::uint64_t, N> v,
+        const Decimal_denominators<avel::Vector<std::uint64_t, N>>& d,
+        std::uint8_t (*strings)[decimal_string_width<std::uint64_t>()]
+    ) {
+        // Splits v into a value less than 10^4 and two less than 10^8. The
+        // 64-bit lanes then hold eight digits each, the low four in the
+        // upper half
+        auto upper_r0 = div(v, d.d100000000);
+        auto q2_r1 = div(upper_r0.quot, d.d100000000);
+
+        auto r1 = div(q2_r1.rem, d.d10000);
+        auto r0 = div(upper_r0.rem, d.d10000);
+
+        auto top = to_array(pack_4_digits(q2_r1.quot, d));
+        auto mid = to_array(pack_4_digits(r1.quot, d) | (pack_4_digits(r1.rem, d) << 32));
+        auto low = to_array(pack_4_digits(r0.quot, d) | (pack_4_digits(r0.rem, d) << 32));
+
+        for (std::size_t i = 0; i < N; ++i) {
+            std::memcpy(strings[i] + 0,  &top[i], 4);
+            std::memcpy(strings[i] + 4,  &mid[i], 8);
+            std::memcpy(strings[i] + 12, &low[i], 8);
+        }
+    }
+
+    //=====================================================
+    // Parsing
+    //=====================================================
+
+    ///
+    /// Parses a run of decimal digits using scalar arithmetic
+    ///
+    /// \param ptr Pointer to first character
+    /// \param n Number of readable characters
+    /// \param value Set to the value of the digits, if it fits in 64 bits
+    /// \return Number of digits read, or n + 1 if the value overflowed
+    ///
+    AVEL_FINL std::size_t parse_digits_scalar(const std::uint8_t* ptr, std::size_t n, std::uint64_t& value) {
+        constexpr std::uint64_t max = std::numeric_limits<std::uint64_t>::max();
+
+        std::uint64_t v = 0;
+        bool overflow = false;
+
+        std::size_t i = 0;
+        for (; i < n; ++i) {
+            std::uint32_t d = std::uint32_t(ptr[i]) - '0';
+            if (d > 9) {
+                break;
+            }
+
+            if (v > (max - d) / 10) {
+                overflow = true;
+            }
+
+            v = v * 10 + d;
+        }
+
+        value = v;
+        return overflow ? n + 1 : i;
+    }
+
+    #if defined(AVEL_SSSE3)
+
+    ///
+    /// Parses a run of up to sixteen decimal digits. Pairs of digits are
+    /// combined with pmaddubsw, then pairs of those with pmaddwd, producing
+    /// two eight digit halves that are combined in scalar code.
+    ///
+    /// \param ptr Pointer to first character. Sixteen bytes must be readable
+    /// \param value Set to the value of the digits if fewer than sixteen were
+    ///     found
+    /// \return Number of leading digits, up to sixteen
+    ///
+    AVEL_FINL std::uint32_t parse_16_digits(const std::uint8_t* ptr, std::uint64_t& value) {
+        // Loading 16 bytes from shift_indices + n produces indices which move
+        // the first n bytes of a vector to its end, zeroing the rest
+        alignas(32) static constexpr std::uint8_t shift_indices[32] {
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+        };
+
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+        __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+
+        auto bits = static_cast<std::uint32_t>(_mm_movemask_epi8(is_digit));
+        auto length = avel::countr_one(bits);
+        if (length == 0 || length == 16) {
+            return length;
+        }
+
+        __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(shift_indices + length));
+        digits = _mm_shuffle_epi8(digits, indices);
+
+        __m128i pairs = _mm_maddubs_epi16(digits, _mm_set1_epi16(0x010a));
+        __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010064));
+        __m128i octs = _mm_madd_epi16(_mm_packs_epi32(quads, quads), _mm_set1_epi32(0x00012710));
+
+        auto high = static_cast<std::uint32_t>(_mm_cvtsi128_si32(octs));
+        auto low  = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(octs, 4)));
+        value = std::uint64_t(high) * 100000000 + low;
+        return length;
+    }
+
+    #endif
+
+    ///
+    /// Parses a run of decimal digits
+    ///
+    /// \param ptr Pointer to first character
+    /// \param n Number of readable characters
+    /// \param value Set to the value of the digits, if it fits in 64 bits
+    /// \return Number of digits read, or n + 1 if the value overflowed
+    ///
+    AVEL_FINL std::size_t parse_digits(const std::uint8_t* ptr, std::size_t n, std::uint64_t& value) {
+        #if defined(AVEL_SSSE3)
+        if (16 <= n) {
+            auto length = parse_16_digits(ptr, value);
+            if (length < 16) {
+                return length;
+            }
+        }
+        #endif
+
+        return parse_digits_scalar(ptr, n, value);
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Decimal conversion
+    //=====================================================
+
+    ///
+    /// \param n Number of values to format
+    /// \return Upper bound on the number of bytes written by to_decimal when
+    ///     formatting n values of type T
+    ///
+    template<class T>
+    constexpr std::size_t decimal_size_bound(std::size_t n) {
+        return n * (std::numeric_limits<T>::digits10 + 2);
+    }
+
+    ///
+    /// Writes the decimal representation of each value, separated by
+    /// delimiter. No delimiter follows the last value.
+    ///
+    /// A full vector of values is converted at once. Each value is split into
+    /// groups of four digits using division by constant powers of ten, which
+    /// are then separated into bytes and stored as ASCII digits, leading zeros
+    /// included. The leading zeros of each value are skipped when the digits
+    /// are copied out.
+    ///
+    /// \param values View over std::uint32_t or std::uint64_t values to format
+    /// \param out Destination for the formatted values. Must be at least
+    ///     decimal_size_bound<T>(values.size()) bytes long
+    /// \param delimiter Character written between consecutive values
+    /// \return Number of bytes written to out
+    ///
+    template<class T, std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    std::size_t to_decimal(
+        Vectorized_view<T, E0, A0> values,
+        Vectorized_view<std::uint8_t, E1, A1> out,
+        std::uint8_t delimiter = ' '
+    ) {
+        using scalar = typename std::remove_cv<T>::type;
+        static_assert(
+            std::is_same<scalar, std::uint32_t>::value || std::is_same<scalar, std::uint64_t>::value,
+            "Only std::uint32_t and std::uint64_t values may be formatted"
+        );
+
+        using vec = avel_impl::Decimal_vector<scalar>;
+        constexpr std::size_t width = vec::width;
+        constexpr std::size_t string_width = avel_impl::decimal_string_width<scalar>();
+
+        const avel_impl::Decimal_denominators<vec> denominators{};
+
+        const scalar* src = values.data();
+        std::uint8_t* dst = out.data();
+        const std::size_t n = values.size();
+
+        std::uint8_t strings[width][string_width];
+
+        std::size_t o = 0;
+        for (std::size_t i = 0; i < n; i += width) {
+            auto block_size = static_cast<std::uint32_t>(std::min(width, n - i));
+
+            vec v = load<vec>(src + i, block_size);
+            avel_impl::decimal_strings(v, denominators, strings);
+            auto counts = to_array(avel_impl::decimal_digit_counts(v));
+
+            for (std::size_t j = 0; j < block_size; ++j) {
+                if (i + j != 0) {
+                    dst[o++] = delimiter;
+                }
+
+                std::memcpy(dst + o, strings[j] + string_width - counts[j], counts[j]);
+                o += counts[j];
+            }
+        }
+
+        return o;
+    }
+
+    ///
+    /// Parses a sequence of unsigned decimal values separated by delimiter.
+    /// Each field must consist of at least one digit, and its value must be
+    /// representable by T. A single delimiter may follow the last field.
+    ///
+    /// Fields with fewer than sixteen digits are parsed with a single 128-bit
+    /// vector on targets supporting SSSE3. Longer fields, and all fields on
+    /// other targets, are parsed one digit at a time.
+    ///
+    /// \param text View over characters to parse
+    /// \param out Destination for parsed values. Parsing stops once it is full
+    /// \param delimiter Character separating consecutive values
+    /// \return read is the number of characters consumed. It is less than
+    ///     text.size() if out filled up, in which case written is out.size(),
+    ///     or if text was malformed, in which case it is the offset of the
+    ///     first field which could not be parsed or of the first unexpected
+    ///     character following a field. written is the number of values
+    ///     written to out
+    ///
+    template<class T, std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    Transcode_result from_decimal(
+        Vectorized_view<const std::uint8_t, E0, A0> text,
+        Vectorized_view<T, E1, A1> out,
+        std::uint8_t delimiter = ' '
+    ) {
+        static_assert(
+            std::is_same<T, std::uint32_t>::value || std::is_same<T, std::uint64_t>::value,
+            "Only std::uint32_t and std::uint64_t values may be parsed"
+        );
+
+        const std::uint8_t* src = text.data();
+        T* dst = out.data();
+        const std::size_t n = text.size();
+        const std::size_t m = out.size();
+
+        std::size_t i = 0;
+        std::size_t o = 0;
+        while (i < n && o < m) {
+            std::uint64_t value = 0;
+            std::size_t length = avel_impl::parse_digits(src + i, n - i, value);
+
+            if (length == 0 || length > n - i || value > std::numeric_limits<T>::max()) {
+                return {i, o};
+            }
+
+            if (i + length < n && src[i + length] != delimiter) {
+                return {i + length, o};
+            }
+
+            dst[o++] = static_cast<T>(value);
+            i = std::min(n, i + length + 1);
+        }
+
+        return {i, o};
+    }
+
+}
+
+#endif //AVEL_DECIMAL_HPP
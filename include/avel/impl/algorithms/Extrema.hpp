@@ -0,0 +1,169 @@
+#ifndef AVEL_EXTREMA_HPP
+#define AVEL_EXTREMA_HPP
+
+namespace avel {
+
+    ///
+    /// An element of a view along with its position
+    ///
+    template<class T>
+    struct Indexed_value {
+        T value;
+        std::size_t index;
+    };
+
+}
+
+namespace avel_impl {
+
+    //=====================================================
+    // Extremum search
+    //=====================================================
+
+    // The chunk in which each lane's current candidate was found is tracked in
+    // a vector of the same type as the elements, so that it can be updated
+    // using the same mask as the candidates. These functions return how many
+    // chunks such a counter can number before it overflows or, in the case of
+    // floats, stops being exact
+
+    template<class T>
+    constexpr std::size_t lane_counter_limit(std::true_type) {
+        return static_cast<std::size_t>(std::numeric_limits<T>::max());
+    }
+
+    template<class T>
+    constexpr std::size_t lane_counter_limit(std::false_type) {
+        return std::size_t(1) << std::numeric_limits<T>::digits;
+    }
+
+    template<class T>
+    constexpr std::size_t lane_counter_limit() {
+        return lane_counter_limit<T>(std::is_integral<T>{});
+    }
+
+    struct Less_than {
+        template<class U>
+        AVEL_FINL auto operator()(U x, U y) const -> decltype(x < y) {
+            return x < y;
+        }
+    };
+
+    struct Greater_than {
+        template<class U>
+        AVEL_FINL auto operator()(U x, U y) const -> decltype(y < x) {
+            return y < x;
+        }
+    };
+
+    ///
+    /// Finds the first element of view which no other element is better than
+    ///
+    /// \tparam C Callable where C(x, y) is true if x is strictly better than y.
+    ///     Must accept both scalars and vectors
+    template<class C, class T, std::size_t E, std::size_t A>
+    avel::Indexed_value<typename std::remove_cv<T>::type> arg_extremum(avel::Vectorized_view<T, E, A> view) {
+        using scalar = typename std::remove_cv<T>::type;
+        using vec = typename avel::Vectorized_view<T, E, A>::vector_type;
+        constexpr std::size_t width = vec::width;
+
+        const C better{};
+
+        const scalar* ptr = view.data();
+        const std::size_t n = view.size();
+
+        if (n == 0) {
+            return {scalar{}, 0};
+        }
+
+        avel::Indexed_value<scalar> ret{ptr[0], 0};
+
+        const vec one{scalar(1)};
+
+        // Elements are processed in blocks short enough for the chunk counters
+        // not to overflow, each of which is reduced to a single candidate
+        std::size_t i = 0;
+        while (n - i >= width) {
+            const std::size_t chunks = std::min((n - i) / width, lane_counter_limit<scalar>());
+            const scalar* block = ptr + i;
+
+            vec best = avel::load<vec>(block);
+            vec best_chunk{scalar(0)};
+            vec chunk{scalar(0)};
+
+            for (std::size_t c = 1; c < chunks; ++c) {
+                chunk += one;
+
+                auto x = avel::load<vec>(block + c * width);
+                auto m = better(x, best);
+
+                best = avel::blend(m, x, best);
+                best_chunk = avel::blend(m, chunk, best_chunk);
+            }
+
+            auto values = avel::to_array(best);
+            auto lane_chunks = avel::to_array(best_chunk);
+
+            // Equally good candidates are resolved in favor of the lowest index
+            for (std::size_t j = 0; j < width; ++j) {
+                auto value = values[j];
+                auto index = i + static_cast<std::size_t>(lane_chunks[j]) * width + j;
+
+                if (better(value, ret.value) || (!better(ret.value, value) && index < ret.index)) {
+                    ret = {value, index};
+                }
+            }
+
+            i += chunks * width;
+        }
+
+        for (; i < n; ++i) {
+            if (better(ptr[i], ret.value)) {
+                ret = {ptr[i], i};
+            }
+        }
+
+        return ret;
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Extrema
+    //=====================================================
+
+    ///
+    /// Finds the smallest element in view. Each lane tracks its own candidate
+    /// along with the chunk it was found in, and the candidates are reduced to
+    /// a single result at the end.
+    ///
+    /// If several elements are equally small, the one with the lowest index is
+    /// returned, as with std::min_element. If view contains NaNs, which
+    /// element is returned is unspecified.
+    ///
+    /// \param view View over elements to search
+    /// \return Smallest element and its index, or a value-initialized element
+    ///     and an index of 0 if view is empty
+    template<class T, std::size_t E, std::size_t A>
+    Indexed_value<typename std::remove_cv<T>::type> argmin(Vectorized_view<T, E, A> view) {
+        return avel_impl::arg_extremum<avel_impl::Less_than>(view);
+    }
+
+    ///
+    /// Finds the largest element in view. If several elements are equally
+    /// large, the one with the lowest index is returned, as with
+    /// std::max_element. If view contains NaNs, which element is returned is
+    /// unspecified.
+    ///
+    /// \param view View over elements to search
+    /// \return Largest element and its index, or a value-initialized element
+    ///     and an index of 0 if view is empty
+    template<class T, std::size_t E, std::size_t A>
+    Indexed_value<typename std::remove_cv<T>::type> argmax(Vectorized_view<T, E, A> view) {
+        return avel_impl::arg_extremum<avel_impl::Greater_than>(view);
+    }
+
+}
+
+#endif //AVEL_EXTREMA_HPP
@@ -0,0 +1,211 @@
+#ifndef AVEL_FIND_HPP
+#define AVEL_FIND_HPP
+
+namespace avel_impl {
+
+    ///
+    /// \return Index of first element satisfying pred, or n if no such
+    ///     element exists
+    template<class V, class P, bool Aligned>
+    std::size_t find_if_body(const typename V::scalar* ptr, std::size_t n, P& pred, std::integral_constant<bool, Aligned> aligned) {
+        constexpr std::size_t width = V::width;
+        constexpr std::size_t block_size = 4 * width;
+
+        std::size_t i = 0;
+        for (; i + block_size <= n; i += block_size) {
+            auto m0 = pred(body_load<V>(ptr + i + 0 * width, aligned));
+            auto m1 = pred(body_load<V>(ptr + i + 1 * width, aligned));
+            auto m2 = pred(body_load<V>(ptr + i + 2 * width, aligned));
+            auto m3 = pred(body_load<V>(ptr + i + 3 * width, aligned));
+
+            if (any((m0 | m1) | (m2 | m3))) {
+                if (any(m0)) {
+                    return i + 0 * width + find_first(m0);
+                }
+
+                if (any(m1)) {
+                    return i + 1 * width + find_first(m1);
+                }
+
+                if (any(m2)) {
+                    return i + 2 * width + find_first(m2);
+                }
+
+                return i + 3 * width + find_first(m3);
+            }
+        }
+
+        for (; i + width <= n; i += width) {
+            auto m = pred(body_load<V>(ptr + i, aligned));
+            if (any(m)) {
+                return i + find_first(m);
+            }
+        }
+
+        if (i < n) {
+            auto tail_size = static_cast<std::uint32_t>(n - i);
+
+            // Lanes past tail_size hold zeros which may satisfy pred
+            auto j = find_first(pred(avel::load<V>(ptr + i, tail_size)));
+            if (j < tail_size) {
+                return i + j;
+            }
+        }
+
+        return n;
+    }
+
+    ///
+    /// \return Number of elements for which pred returns true
+    template<class V, class P, bool Aligned>
+    std::size_t count_if_body(const typename V::scalar* ptr, std::size_t n, P& pred, std::integral_constant<bool, Aligned> aligned) {
+        constexpr std::size_t width = V::width;
+        constexpr std::size_t block_size = 4 * width;
+
+        std::size_t total = 0;
+
+        std::size_t i = 0;
+        for (; i + block_size <= n; i += block_size) {
+            auto c0 = count(pred(body_load<V>(ptr + i + 0 * width, aligned)));
+            auto c1 = count(pred(body_load<V>(ptr + i + 1 * width, aligned)));
+            auto c2 = count(pred(body_load<V>(ptr + i + 2 * width, aligned)));
+            auto c3 = count(pred(body_load<V>(ptr + i + 3 * width, aligned)));
+
+            total += (c0 + c1) + (c2 + c3);
+        }
+
+        for (; i + width <= n; i += width) {
+            total += count(pred(body_load<V>(ptr + i, aligned)));
+        }
+
+        if (i < n) {
+            auto tail_size = static_cast<std::uint32_t>(n - i);
+
+            // Lanes past tail_size hold zeros which may satisfy pred
+            auto bits = to_bits(pred(avel::load<V>(ptr + i, tail_size)));
+            total += avel::popcount(bits & ((std::uint64_t(1) << tail_size) - 1));
+        }
+
+        return total;
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Searching
+    //=====================================================
+
+    ///
+    /// Finds the index of the first element in view for which pred returns
+    /// true.
+    ///
+    /// Leading elements are peeled off so that the remainder of view may be
+    /// read using aligned loads. Four vectors are tested per iteration and
+    /// their masks are ORed together, so that only a single branch is taken
+    /// per block of elements that contains no matches.
+    ///
+    /// \param view View over elements to search
+    /// \param pred Callable which takes view's vector_type and returns the
+    ///     corresponding mask type
+    /// \return Index of first element satisfying pred, or view.size() if no
+    ///     such element exists
+    template<class T, std::size_t E, std::size_t A, class P>
+    std::size_t find_if(Vectorized_view<T, E, A> view, P pred) {
+        using vec = typename Vectorized_view<T, E, A>::vector_type;
+
+        const typename vec::scalar* ptr = view.data();
+        const std::size_t n = view.size();
+
+        auto peel = avel_impl::peel<vec, A>(ptr, n);
+        if (!peel.aligned) {
+            return avel_impl::find_if_body<vec>(ptr, n, pred, std::false_type{});
+        }
+
+        if (peel.head != 0) {
+            // Lanes past the head hold zeros which may satisfy pred
+            auto j = find_first(pred(load<vec>(ptr, static_cast<std::uint32_t>(peel.head))));
+            if (j < peel.head) {
+                return j;
+            }
+        }
+
+        return peel.head + avel_impl::find_if_body<vec>(ptr + peel.head, n - peel.head, pred, std::true_type{});
+    }
+
+    ///
+    /// \param view View over elements to search
+    /// \param value Value to search for
+    /// \return Index of first element equal to value, or view.size() if no
+    ///     such element exists
+    template<class T, std::size_t E, std::size_t A>
+    std::size_t find(Vectorized_view<T, E, A> view, typename std::remove_cv<T>::type value) {
+        using vec = typename Vectorized_view<T, E, A>::vector_type;
+
+        const vec v{value};
+        return find_if(view, [v] (vec x) {
+            return x == v;
+        });
+    }
+
+    ///
+    /// \param view View over elements to search
+    /// \param value Value to search for
+    /// \return True if any element in view is equal to value
+    template<class T, std::size_t E, std::size_t A>
+    bool contains(Vectorized_view<T, E, A> view, typename std::remove_cv<T>::type value) {
+        return find(view, value) != view.size();
+    }
+
+    //=====================================================
+    // Counting
+    //=====================================================
+
+    ///
+    /// Leading elements are peeled off so that the remainder of view may be
+    /// read using aligned loads.
+    ///
+    /// \param view View over elements to search
+    /// \param pred Callable which takes view's vector_type and returns the
+    ///     corresponding mask type
+    /// \return Number of elements in view for which pred returns true
+    template<class T, std::size_t E, std::size_t A, class P>
+    std::size_t count_if(Vectorized_view<T, E, A> view, P pred) {
+        using vec = typename Vectorized_view<T, E, A>::vector_type;
+
+        const typename vec::scalar* ptr = view.data();
+        const std::size_t n = view.size();
+
+        auto peel = avel_impl::peel<vec, A>(ptr, n);
+        if (!peel.aligned) {
+            return avel_impl::count_if_body<vec>(ptr, n, pred, std::false_type{});
+        }
+
+        std::size_t total = 0;
+        if (peel.head != 0) {
+            // Lanes past the head hold zeros which may satisfy pred
+            auto bits = to_bits(pred(load<vec>(ptr, static_cast<std::uint32_t>(peel.head))));
+            total += popcount(bits & ((std::uint64_t(1) << peel.head) - 1));
+        }
+
+        return total + avel_impl::count_if_body<vec>(ptr + peel.head, n - peel.head, pred, std::true_type{});
+    }
+
+    ///
+    /// \param view View over elements to search
+    /// \param value Value to count occurrences of
+    /// \return Number of elements in view equal to value
+    template<class T, std::size_t E, std::size_t A>
+    std::size_t count(Vectorized_view<T, E, A> view, typename std::remove_cv<T>::type value) {
+        using vec = typename Vectorized_view<T, E, A>::vector_type;
+
+        const vec v{value};
+        return count_if(view, [v] (vec x) {
+            return x == v;
+        });
+    }
+
+}
+
+#endif //AVEL_FIND_HPP
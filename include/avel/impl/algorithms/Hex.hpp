@@ -0,0 +1,293 @@
+#ifndef AVEL_HEX_HPP
+#define AVEL_HEX_HPP
+
+namespace avel {
+
+    ///
+    /// Case of the letters used for the hexadecimal digits 10 through 15
+    ///
+    enum class Hex_case {
+        lower,
+        upper
+    };
+
+}
+
+namespace avel_impl {
+
+    using Hex_vector = avel::Vector<std::uint8_t, avel::natural_width_8u>;
+
+    /// Value returned by hex_nibble for characters which are not hex digits
+    constexpr std::uint8_t hex_invalid = 0xFF;
+
+    AVEL_FINL const char* hex_digits(avel::Hex_case letter_case) {
+        return (letter_case == avel::Hex_case::lower) ? "0123456789abcdef" : "0123456789ABCDEF";
+    }
+
+    AVEL_FINL std::uint8_t hex_nibble(std::uint8_t c) {
+        std::uint8_t d = static_cast<std::uint8_t>(c - '0');
+        if (d < 10) {
+            return d;
+        }
+
+        std::uint8_t l = static_cast<std::uint8_t>((c | 0x20) - 'a');
+        if (l < 6) {
+            return static_cast<std::uint8_t>(l + 10);
+        }
+
+        return hex_invalid;
+    }
+
+    //=====================================================
+    // Interleaving
+    //=====================================================
+
+    ///
+    /// Stores the lanes of a and b alternately, starting with a's first lane
+    ///
+    template<std::uint32_t N>
+    AVEL_FINL void interleave_store(std::uint8_t* out, avel::Vector<std::uint8_t, N> a, avel::Vector<std::uint8_t, N> b) {
+        auto a_lanes = avel::to_array(a);
+        auto b_lanes = avel::to_array(b);
+        for (std::size_t i = 0; i < N; ++i) {
+            out[2 * i + 0] = a_lanes[i];
+            out[2 * i + 1] = b_lanes[i];
+        }
+    }
+
+    ///
+    /// Reinterprets each pair of adjacent bytes in v as a 16-bit lane
+    ///
+    template<std::uint32_t N>
+    AVEL_FINL avel::Vector<std::uint16_t, N / 2> as_byte_pairs(avel::Vector<std::uint8_t, N> v) {
+        #if defined(AVEL_NEON)
+        return avel::Vector<std::uint16_t, N / 2>{vreinterpretq_u16_u8(decay(v))};
+
+        #else
+        return avel::Vector<std::uint16_t, N / 2>{decay(v)};
+
+        #endif
+    }
+
+    #if defined(AVEL_SSE2)
+
+    AVEL_FINL void interleave_store(std::uint8_t* out, avel::vec16x8u a, avel::vec16x8u b) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0x00), _mm_unpacklo_epi8(decay(a), decay(b)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0x10), _mm_unpackhi_epi8(decay(a), decay(b)));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX2)
+
+    AVEL_FINL void interleave_store(std::uint8_t* out, avel::vec32x8u a, avel::vec32x8u b) {
+        // Unpacking operates within 128-bit lanes, so the halves of the
+        // results are reassembled in order
+        auto lo = _mm256_unpacklo_epi8(decay(a), decay(b));
+        auto hi = _mm256_unpackhi_epi8(decay(a), decay(b));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x00), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x20), _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX512BW)
+
+    AVEL_FINL void interleave_store(std::uint8_t* out, avel::vec64x8u a, avel::vec64x8u b) {
+        auto lo = _mm512_unpacklo_epi8(decay(a), decay(b));
+        auto hi = _mm512_unpackhi_epi8(decay(a), decay(b));
+
+        auto first  = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+        auto second = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+        _mm512_storeu_si512(out + 0x00, _mm512_permutex2var_epi64(lo, first, hi));
+        _mm512_storeu_si512(out + 0x40, _mm512_permutex2var_epi64(lo, second, hi));
+    }
+
+    #endif
+
+    #if defined(AVEL_NEON)
+
+    AVEL_FINL void interleave_store(std::uint8_t* out, avel::vec16x8u a, avel::vec16x8u b) {
+        uint8x16x2_t pairs{{decay(a), decay(b)}};
+        vst2q_u8(out, pairs);
+    }
+
+    #endif
+
+    //=====================================================
+    // Nibble conversion
+    //=====================================================
+
+    ///
+    /// \param table Vector holding the sixteen hex digits
+    /// \param nibbles Vector of values less than 16
+    /// \return The hex digit for each lane of nibbles
+    ///
+    #if defined(AVEL_SSE2) || defined(AVEL_NEON)
+
+    template<class V>
+    AVEL_FINL V nibbles_to_hex(avel::vec16x8u table, V nibbles) {
+        #if defined(AVEL_SSSE3) || defined(AVEL_NEON)
+        return lookup16(table, nibbles);
+
+        #else
+        // Without a byte shuffle, a table lookup is performed one lane at a
+        // time, so the digits are instead computed arithmetically
+        auto letter_offset = V{std::uint8_t(avel::extract<10>(table) - '0' - 10)};
+        return nibbles + V{std::uint8_t('0')} + keep(nibbles > V{9}, letter_offset);
+
+        #endif
+    }
+
+    #endif
+
+    ///
+    /// \param chars Vector of characters
+    /// \param nibbles Set to the value of each hex digit in chars
+    /// \return True if all lanes of chars held hex digits
+    ///
+    template<class V>
+    AVEL_FINL bool hex_to_nibbles(V chars, V& nibbles) {
+        auto d = chars - V{std::uint8_t('0')};
+        auto l = (chars | V{0x20}) - V{std::uint8_t('a')};
+
+        auto is_decimal = d < V{10};
+        auto is_letter = l < V{6};
+
+        nibbles = blend(is_decimal, d, l + V{10});
+        return all(is_decimal | is_letter);
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Hex
+    //=====================================================
+
+    ///
+    /// Encodes each byte of in as two hex digits, most significant nibble
+    /// first.
+    ///
+    /// The nibbles of a full vector of bytes are converted to digits using
+    /// 16-entry table lookups, and the two vectors of digits are then
+    /// interleaved as they're stored.
+    ///
+    /// \param in View over bytes to encode
+    /// \param out Destination for hex digits. Must be at least 2 * in.size()
+    ///     bytes long
+    /// \param letter_case Case of the digits a through f
+    /// \return Number of characters written to out
+    ///
+    template<std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    std::size_t hex_encode(
+        Vectorized_view<const std::uint8_t, E0, A0> in,
+        Vectorized_view<std::uint8_t, E1, A1> out,
+        Hex_case letter_case = Hex_case::lower
+    ) {
+        const char* digits = avel_impl::hex_digits(letter_case);
+
+        const std::uint8_t* src = in.data();
+        std::uint8_t* dst = out.data();
+        const std::size_t n = in.size();
+
+        std::size_t i = 0;
+
+        #if defined(AVEL_SSE2) || defined(AVEL_NEON)
+        using vec = avel_impl::Hex_vector;
+        constexpr std::size_t width = vec::width;
+
+        const vec16x8u table = load<vec16x8u>(reinterpret_cast<const std::uint8_t*>(digits));
+
+        for (; i + width <= n; i += width) {
+            auto v = load<vec>(src + i);
+            auto high = avel_impl::nibbles_to_hex(table, v >> 4);
+            auto low = avel_impl::nibbles_to_hex(table, v & vec{0x0F});
+            avel_impl::interleave_store(dst + 2 * i, high, low);
+        }
+        #endif
+
+        for (; i < n; ++i) {
+            dst[2 * i + 0] = static_cast<std::uint8_t>(digits[src[i] >> 4]);
+            dst[2 * i + 1] = static_cast<std::uint8_t>(digits[src[i] & 0x0F]);
+        }
+
+        return 2 * n;
+    }
+
+    ///
+    /// Decodes pairs of hex digits into bytes. Both upper and lowercase
+    /// letters are accepted.
+    ///
+    /// Two vectors of characters are validated and converted to nibbles per
+    /// iteration. Adjacent nibbles are then combined within 16-bit lanes
+    /// and narrowed to bytes.
+    ///
+    /// \param in View over hex digits to decode
+    /// \param out Destination for decoded bytes. Must be at least
+    ///     in.size() / 2 bytes long
+    /// \return read is the number of characters consumed. It is less than
+    ///     in.size() only if in was invalid, in which case it is the offset of
+    ///     the first character which is not a hex digit, or of the final
+    ///     character if in.size() is odd. written is the number of bytes
+    ///     written to out
+    ///
+    template<std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    Transcode_result hex_decode(
+        Vectorized_view<const std::uint8_t, E0, A0> in,
+        Vectorized_view<std::uint8_t, E1, A1> out
+    ) {
+        const std::uint8_t* src = in.data();
+        std::uint8_t* dst = out.data();
+        const std::size_t n = in.size();
+
+        std::size_t i = 0;
+
+        #if defined(AVEL_SSE2) || defined(AVEL_NEON)
+        using vec = avel_impl::Hex_vector;
+        using pair_vec = Vector<std::uint16_t, vec::width / 2>;
+        constexpr std::size_t width = vec::width;
+
+        for (; i + 2 * width <= n; i += 2 * width) {
+            vec nibbles0;
+            vec nibbles1;
+            bool valid0 = avel_impl::hex_to_nibbles(load<vec>(src + i + 0 * width), nibbles0);
+            bool valid1 = avel_impl::hex_to_nibbles(load<vec>(src + i + 1 * width), nibbles1);
+
+            // The scalar loop below locates the invalid character
+            if (!(valid0 && valid1)) {
+                break;
+            }
+
+            auto pairs0 = avel_impl::as_byte_pairs(nibbles0);
+            auto pairs1 = avel_impl::as_byte_pairs(nibbles1);
+
+            auto bytes0 = ((pairs0 << 4) | (pairs0 >> 8)) & pair_vec{0x00FF};
+            auto bytes1 = ((pairs1 << 4) | (pairs1 >> 8)) & pair_vec{0x00FF};
+
+            avel_impl::narrow_store(dst + i / 2 + 0 * width / 2, bytes0);
+            avel_impl::narrow_store(dst + i / 2 + 1 * width / 2, bytes1);
+        }
+        #endif
+
+        for (; i + 2 <= n; i += 2) {
+            std::uint8_t high = avel_impl::hex_nibble(src[i + 0]);
+            if (high == avel_impl::hex_invalid) {
+                return {i, i / 2};
+            }
+
+            std::uint8_t low = avel_impl::hex_nibble(src[i + 1]);
+            if (low == avel_impl::hex_invalid) {
+                return {i + 1, i / 2};
+            }
+
+            dst[i / 2] = static_cast<std::uint8_t>((high << 4) | low);
+        }
+
+        return {i, i / 2};
+    }
+
+}
+
+#endif //AVEL_HEX_HPP
@@ -0,0 +1,204 @@
+#ifndef AVEL_HISTOGRAM_HPP
+#define AVEL_HISTOGRAM_HPP
+
+namespace avel {
+
+    ///
+    /// Container of bin counts produced by histogram(). Aligned to a cache line
+    /// so that it can be further processed using aligned vector loads
+    ///
+    using Histogram = std::vector<std::uint32_t, Aligned_allocator<std::uint32_t, AVEL_L1_CACHE_LINE_SIZE>>;
+
+}
+
+namespace avel_impl {
+
+    //=====================================================
+    // Histogram kernels
+    //=====================================================
+
+    /// Number of sub-histograms which consecutive elements are spread across.
+    /// Runs of equal elements would otherwise create a chain of loads which
+    /// each depend on the previous store to the same counter
+    constexpr std::size_t histogram_sub_count = 4;
+
+    /// Largest number of bins for which the sub-histograms fit in L1 cache
+    constexpr std::size_t histogram_sub_bin_limit = 2048;
+
+    template<class T>
+    void histogram_sub(const T* ptr, std::size_t n, T limit, std::uint32_t* counts, std::size_t stride, std::true_type) {
+        using vec = avel::Natural_width_vector<T>;
+        constexpr std::size_t width = vec::width;
+
+        std::uint32_t* c0 = counts + 0 * stride;
+        std::uint32_t* c1 = counts + 1 * stride;
+        std::uint32_t* c2 = counts + 2 * stride;
+        std::uint32_t* c3 = counts + 3 * stride;
+
+        const vec l{limit};
+
+        std::size_t i = 0;
+        for (; i + width <= n; i += width) {
+            auto indices = avel::to_array(avel::min(avel::load<vec>(ptr + i), l));
+
+            for (std::size_t j = 0; j < width; j += 4) {
+                ++c0[indices[j + 0]];
+                ++c1[indices[j + 1]];
+                ++c2[indices[j + 2]];
+                ++c3[indices[j + 3]];
+            }
+        }
+
+        for (; i < n; ++i) {
+            ++c0[std::min(ptr[i], limit)];
+        }
+    }
+
+    template<class T>
+    void histogram_sub(const T* ptr, std::size_t n, T limit, std::uint32_t* counts, std::size_t stride, std::false_type) {
+        std::uint32_t* c0 = counts + 0 * stride;
+        std::uint32_t* c1 = counts + 1 * stride;
+        std::uint32_t* c2 = counts + 2 * stride;
+        std::uint32_t* c3 = counts + 3 * stride;
+
+        // Vectors are too narrow to cover every sub-histogram, so consecutive
+        // elements are spread across them directly
+        std::size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            ++c0[std::min(ptr[i + 0], limit)];
+            ++c1[std::min(ptr[i + 1], limit)];
+            ++c2[std::min(ptr[i + 2], limit)];
+            ++c3[std::min(ptr[i + 3], limit)];
+        }
+
+        for (; i < n; ++i) {
+            ++c0[std::min(ptr[i], limit)];
+        }
+    }
+
+    template<class T>
+    void histogram_sub(const T* ptr, std::size_t n, T limit, std::uint32_t* counts, std::size_t stride) {
+        constexpr std::size_t width = avel::Natural_width_vector<T>::width;
+        histogram_sub(ptr, n, limit, counts, stride, std::integral_constant<bool, (width % histogram_sub_count == 0)>{});
+    }
+
+    #if defined(AVEL_AVX512CD)
+
+    ///
+    /// Accumulates a histogram into a single set of counters using gathers and
+    /// scatters. Lanes which fall into the same bin are detected using
+    /// vpconflictd. Each lane adds the number of preceding lanes in its bin to
+    /// its increment, so that the store from the last such lane, which is the
+    /// one that lands, carries the count for the entire group.
+    ///
+    inline void histogram_conflict(const std::uint16_t* ptr, std::size_t n, std::uint16_t limit, std::uint32_t* counts) {
+        const avel::vec16x32i l{std::int32_t(limit)};
+        const avel::vec16x32u one{1};
+
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            auto x = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + i)));
+            auto indices = avel::min(avel::vec16x32i{x}, l);
+
+            auto conflicts = avel::vec16x32u{_mm512_conflict_epi32(decay(indices))};
+            auto c = avel::gather<avel::vec16x32u>(counts, indices);
+            avel::scatter(counts, c + avel::popcount(conflicts) + one, indices);
+        }
+
+        for (; i < n; ++i) {
+            ++counts[std::min(ptr[i], limit)];
+        }
+    }
+
+    inline bool try_histogram_conflict(const std::uint16_t* ptr, std::size_t n, std::uint16_t limit, avel::Histogram& counts) {
+        if (counts.size() > histogram_sub_bin_limit) {
+            histogram_conflict(ptr, n, limit, counts.data());
+            return true;
+        }
+
+        return false;
+    }
+
+    #endif
+
+    template<class T>
+    bool try_histogram_conflict(const T*, std::size_t, T, avel::Histogram&) {
+        return false;
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Histograms
+    //=====================================================
+
+    ///
+    /// Counts the number of elements in view that are equal to each of the
+    /// values in [0, bins). Elements which are not less than bins are not
+    /// counted.
+    ///
+    /// Elements are counted into several sub-histograms which are summed at the
+    /// end. When AVX-512CD is available and there are too many bins for the
+    /// sub-histograms to fit in L1 cache, a single histogram is instead updated
+    /// with conflict-free gathers and scatters.
+    ///
+    /// \param view View over 8-bit or 16-bit unsigned integers to count
+    /// \param bins Number of bins in the histogram
+    /// \return Histogram with bins entries, where the i-th entry holds the
+    ///     number of elements equal to i
+    template<class T, std::size_t E, std::size_t A>
+    Histogram histogram(Vectorized_view<T, E, A> view, std::size_t bins) {
+        using scalar = typename std::remove_cv<T>::type;
+
+        static_assert(
+            std::is_same<scalar, std::uint8_t>::value || std::is_same<scalar, std::uint16_t>::value,
+            "histogram() only supports 8-bit and 16-bit unsigned integers"
+        );
+
+        Histogram ret;
+        if (bins == 0) {
+            return ret;
+        }
+
+        // Out-of-range elements are redirected to an extra trailing bin which
+        // is discarded at the end
+        const scalar limit = scalar(std::min<std::size_t>(bins, std::numeric_limits<scalar>::max()));
+        ret.resize(bins + 1);
+
+        const scalar* data = view.data();
+        if (avel_impl::try_histogram_conflict(data, view.size(), limit, ret)) {
+            ret.resize(bins);
+            return ret;
+        }
+
+        using vec32u = Natural_width_vector<std::uint32_t>;
+        constexpr std::size_t width = vec32u::width;
+        constexpr std::size_t line_width = AVEL_L1_CACHE_LINE_SIZE / sizeof(std::uint32_t);
+        constexpr std::size_t granularity = (width < line_width) ? line_width : width;
+
+        // Each sub-histogram starts on its own cache line
+        const std::size_t stride = (bins + granularity) / granularity * granularity;
+
+        Histogram sub(avel_impl::histogram_sub_count * stride, 0);
+        avel_impl::histogram_sub(data, view.size(), limit, sub.data(), stride);
+
+        std::uint32_t* counts = sub.data();
+        for (std::size_t i = 0; i < stride; i += width) {
+            auto c0 = aligned_load<vec32u>(counts + i + 0 * stride);
+            auto c1 = aligned_load<vec32u>(counts + i + 1 * stride);
+            auto c2 = aligned_load<vec32u>(counts + i + 2 * stride);
+            auto c3 = aligned_load<vec32u>(counts + i + 3 * stride);
+
+            aligned_store(counts + i, (c0 + c1) + (c2 + c3));
+        }
+
+        std::copy(counts, counts + bins, ret.data());
+        ret.resize(bins);
+        return ret;
+    }
+
+}
+
+#endif //AVEL_HISTOGRAM_HPP
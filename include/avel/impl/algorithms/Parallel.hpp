@@ -0,0 +1,584 @@
+#ifndef AVEL_PARALLEL_HPP
+#define AVEL_PARALLEL_HPP
+
+namespace avel {
+
+    ///
+    /// Execution policy which requests that an algorithm be split across
+    /// several threads. Passed as the first argument to an algorithm.
+    ///
+    struct Parallel_policy {
+
+        /// Number of threads to use, including the calling thread. Zero
+        /// selects the number of hardware threads
+        std::size_t threads;
+
+        constexpr explicit Parallel_policy(std::size_t threads = 0):
+            threads(threads) {}
+
+    };
+
+    ///
+    /// Execution policy which uses all hardware threads
+    ///
+    constexpr Parallel_policy par{};
+
+}
+
+namespace avel_impl {
+
+    //=====================================================
+    // Thread pool
+    //=====================================================
+
+    ///
+    /// A minimal fork-join thread pool. The thread which submits a job
+    /// participates in executing it, and does not return until all of the
+    /// job's tasks are complete.
+    ///
+    class Thread_pool {
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Thread_pool() = default;
+        Thread_pool(const Thread_pool&) = delete;
+        Thread_pool(Thread_pool&&) = delete;
+
+        ~Thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                stopping = true;
+            }
+
+            work_available.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Thread_pool& operator=(const Thread_pool&) = delete;
+        Thread_pool& operator=(Thread_pool&&) = delete;
+
+        //=================================================
+        // Mutators
+        //=================================================
+
+        ///
+        /// Invokes f(i) for each i in [0, task_count) using up to thread_count
+        /// threads, including the calling thread. If any invocation throws,
+        /// the remaining tasks are abandoned and the first exception is
+        /// rethrown once all running tasks have finished.
+        ///
+        template<class F>
+        void run(std::size_t thread_count, std::size_t task_count, F f) {
+            if (task_count == 0) {
+                return;
+            }
+
+            Job job{task_count, &invoke<F>, &f};
+
+            std::size_t helpers = std::min(thread_count, task_count) - 1;
+            if (helpers != 0) {
+                std::lock_guard<std::mutex> lock{mutex};
+
+                while (workers.size() < helpers) {
+                    workers.emplace_back([this] { work(); });
+                }
+
+                job.helpers = helpers;
+                for (std::size_t i = 0; i < helpers; ++i) {
+                    queue.push_back(&job);
+                }
+            }
+
+            work_available.notify_all();
+
+            execute(job);
+
+            std::unique_lock<std::mutex> lock{mutex};
+
+            // References to the job which no worker picked up are withdrawn,
+            // as all of its tasks have already been claimed
+            auto it = std::remove(queue.begin(), queue.end(), &job);
+            job.helpers -= static_cast<std::size_t>(queue.end() - it);
+            queue.erase(it, queue.end());
+
+            job_finished.wait(lock, [&job] { return job.helpers == 0; });
+
+            if (job.error) {
+                std::rethrow_exception(job.error);
+            }
+        }
+
+    private:
+
+        struct Job {
+            Job(std::size_t task_count, void (*f)(void*, std::size_t), void* data):
+                task_count(task_count),
+                f(f),
+                data(data) {}
+
+            std::size_t task_count;
+            void (*f)(void*, std::size_t);
+            void* data;
+
+            std::atomic<std::size_t> next{0};
+
+            // Guarded by the pool's mutex
+            std::size_t helpers = 0;
+            std::exception_ptr error;
+        };
+
+        template<class F>
+        static void invoke(void* f, std::size_t i) {
+            (*static_cast<F*>(f))(i);
+        }
+
+        void execute(Job& job) {
+            for (std::size_t i; (i = job.next.fetch_add(1)) < job.task_count;) {
+                try {
+                    job.f(job.data, i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    if (!job.error) {
+                        job.error = std::current_exception();
+                    }
+                    job.next = job.task_count;
+                }
+            }
+        }
+
+        void work() {
+            std::unique_lock<std::mutex> lock{mutex};
+            while (true) {
+                work_available.wait(lock, [this] { return stopping || !queue.empty(); });
+                if (queue.empty()) {
+                    return;
+                }
+
+                Job* job = queue.front();
+                queue.pop_front();
+
+                lock.unlock();
+                execute(*job);
+                lock.lock();
+
+                if (--job->helpers == 0) {
+                    job_finished.notify_all();
+                }
+            }
+        }
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        std::mutex mutex;
+        std::condition_variable work_available;
+        std::condition_variable job_finished;
+
+        std::vector<std::thread> workers;
+        std::deque<Job*> queue;
+        bool stopping = false;
+
+    };
+
+    ///
+    /// \return Pool shared by all parallel algorithms. Its worker threads are
+    ///     created as they are first needed
+    inline Thread_pool& thread_pool() {
+        static Thread_pool pool;
+        return pool;
+    }
+
+    //=====================================================
+    // Work partitioning
+    //=====================================================
+
+    /// Smallest number of bytes worth handing to a separate thread
+    constexpr std::size_t parallel_min_chunk_bytes = 64 * 1024;
+
+    /// Number of elements searched between checks for whether an earlier chunk
+    /// has already found a match
+    constexpr std::size_t parallel_find_block_size = 16 * 1024;
+
+    ///
+    /// Division of a range of elements into contiguous chunks, one per task.
+    /// All chunk boundaries after the first lie on cache line boundaries, so
+    /// no two tasks write to the same cache line.
+    ///
+    struct Parallel_partition {
+        std::size_t threads;
+        std::size_t count;
+        std::size_t lead;
+        std::size_t grain;
+        std::size_t n;
+
+        std::size_t begin(std::size_t k) const {
+            return (k == 0) ? 0 : std::min(lead + k * grain, n);
+        }
+
+        std::size_t end(std::size_t k) const {
+            return (k + 1 == count) ? n : begin(k + 1);
+        }
+
+        std::size_t size(std::size_t k) const {
+            return end(k) - begin(k);
+        }
+
+        template<class F>
+        void run(F f) const {
+            thread_pool().run(threads, count, f);
+        }
+    };
+
+    inline std::size_t resolve_thread_count(avel::Parallel_policy policy) {
+        if (policy.threads != 0) {
+            return policy.threads;
+        }
+
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    ///
+    /// \param ptr Pointer to the elements whose writes must not share cache
+    ///     lines across chunks
+    template<class T>
+    Parallel_partition parallel_partition(avel::Parallel_policy policy, const T* ptr, std::size_t n) {
+        constexpr std::size_t line_size = AVEL_L1_CACHE_LINE_SIZE;
+        constexpr std::size_t line_width = (sizeof(T) < line_size) ? line_size / sizeof(T) : 1;
+
+        const std::size_t threads = resolve_thread_count(policy);
+        const std::size_t chunks = std::min(threads, n * sizeof(T) / parallel_min_chunk_bytes);
+        if (chunks <= 1) {
+            return Parallel_partition{1, 1, 0, n, n};
+        }
+
+        // Elements before the first cache line boundary join the first chunk
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        std::size_t lead = 0;
+        if (address % line_size != 0 && address % sizeof(T) == 0) {
+            lead = std::min((line_size - address % line_size) / sizeof(T), n);
+        }
+
+        std::size_t grain = (n - lead + chunks - 1) / chunks;
+        grain = (grain + line_width - 1) / line_width * line_width;
+
+        const std::size_t count = (n - lead + grain - 1) / grain;
+        return Parallel_partition{threads, count, lead, grain, n};
+    }
+
+    //=====================================================
+    // Merge path
+    //=====================================================
+
+    ///
+    /// Finds where the first d elements of the merge of the sorted ranges
+    /// a[0, na) and b[0, nb) come from. Splitting a merge at several values of
+    /// d yields pieces which may be merged independently.
+    ///
+    /// \return Number of the first d elements of the merge taken from a. The
+    ///     remainder are taken from b
+    template<class T>
+    std::size_t merge_path_split(const T* a, std::size_t na, const T* b, std::size_t nb, std::size_t d) {
+        std::size_t lo = (d > nb) ? d - nb : 0;
+        std::size_t hi = std::min(d, na);
+
+        // Finds the fewest elements of a such that the next element of a
+        // follows the last element taken from b
+        while (lo < hi) {
+            std::size_t i = lo + (hi - lo) / 2;
+            if (b[d - i - 1] < a[i]) {
+                hi = i;
+            } else {
+                lo = i + 1;
+            }
+        }
+
+        return lo;
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Parallel transform
+    //=====================================================
+
+    ///
+    /// Parallel version of transform(input, output, f). Chunks are aligned to
+    /// cache line boundaries of output.
+    ///
+    /// \param policy Execution policy specifying the number of threads to use
+    template<
+        std::uint32_t Unroll = 4,
+        class T0, std::size_t E0, std::size_t A0,
+        class T1, std::size_t E1, std::size_t A1,
+        class F
+    >
+    void transform(
+        Parallel_policy policy,
+        Vectorized_view<T0, E0, A0> input,
+        Vectorized_view<T1, E1, A1> output,
+        F f
+    ) {
+        auto parts = avel_impl::parallel_partition(policy, output.data(), input.size());
+
+        parts.run([&] (std::size_t k) {
+            auto b = parts.begin(k);
+            auto n = parts.size(k);
+            transform<Unroll>(input.subview(b, n), output.subview(b, n), f);
+        });
+    }
+
+    ///
+    /// Parallel version of transform(input0, input1, output, f). Chunks are
+    /// aligned to cache line boundaries of output.
+    ///
+    /// \param policy Execution policy specifying the number of threads to use
+    template<
+        std::uint32_t Unroll = 4,
+        class T0, std::size_t E0, std::size_t A0,
+        class T1, std::size_t E1, std::size_t A1,
+        class T2, std::size_t E2, std::size_t A2,
+        class F
+    >
+    void transform(
+        Parallel_policy policy,
+        Vectorized_view<T0, E0, A0> input0,
+        Vectorized_view<T1, E1, A1> input1,
+        Vectorized_view<T2, E2, A2> output,
+        F f
+    ) {
+        auto parts = avel_impl::parallel_partition(policy, output.data(), input0.size());
+
+        parts.run([&] (std::size_t k) {
+            auto b = parts.begin(k);
+            auto n = parts.size(k);
+            transform<Unroll>(input0.subview(b, n), input1.subview(b, n), output.subview(b, n), f);
+        });
+    }
+
+    //=====================================================
+    // Parallel reductions
+    //=====================================================
+
+    ///
+    /// Parallel version of reduce(view, init). Each thread sums its chunk
+    /// independently and the partial sums are added in order.
+    ///
+    /// \param policy Execution policy specifying the number of threads to use
+    template<class T, std::size_t E, std::size_t A>
+    typename std::remove_cv<T>::type reduce(
+        Parallel_policy policy,
+        Vectorized_view<T, E, A> view,
+        typename std::remove_cv<T>::type init = 0
+    ) {
+        using scalar = typename std::remove_cv<T>::type;
+
+        auto parts = avel_impl::parallel_partition(policy, view.data(), view.size());
+
+        std::vector<scalar> partial(parts.count);
+        parts.run([&] (std::size_t k) {
+            partial[k] = reduce(view.subview(parts.begin(k), parts.size(k)));
+        });
+
+        scalar total = init;
+        for (auto x : partial) {
+            total = scalar(total + x);
+        }
+
+        return total;
+    }
+
+    //=====================================================
+    // Parallel searching
+    //=====================================================
+
+    ///
+    /// Parallel version of find_if(view, pred). Threads stop searching once
+    /// an earlier chunk is known to contain a match.
+    ///
+    /// \param policy Execution policy specifying the number of threads to use
+    template<class T, std::size_t E, std::size_t A, class P>
+    std::size_t find_if(Parallel_policy policy, Vectorized_view<T, E, A> view, P pred) {
+        auto parts = avel_impl::parallel_partition(policy, view.data(), view.size());
+
+        std::atomic<std::size_t> result{view.size()};
+        parts.run([&] (std::size_t k) {
+            const auto end = parts.end(k);
+
+            for (auto b = parts.begin(k); b < end; b += avel_impl::parallel_find_block_size) {
+                if (result.load(std::memory_order_relaxed) < b) {
+                    return;
+                }
+
+                auto n = std::min(end - b, avel_impl::parallel_find_block_size);
+                auto i = find_if(view.subview(b, n), pred);
+                if (i != n) {
+                    auto current = result.load(std::memory_order_relaxed);
+                    while (b + i < current && !result.compare_exchange_weak(current, b + i)) {}
+                    return;
+                }
+            }
+        });
+
+        return result.load();
+    }
+
+    ///
+    /// Parallel version of find(view, value)
+    ///
+    /// \param policy Execution policy specifying the number of threads to use
+    template<class T, std::size_t E, std::size_t A>
+    std::size_t find(Parallel_policy policy, Vectorized_view<T, E, A> view, typename std::remove_cv<T>::type value) {
+        using vec = typename Vectorized_view<T, E, A>::vector_type;
+
+        const vec v{value};
+        return find_if(policy, view, [v] (vec x) {
+            return x == v;
+        });
+    }
+
+    ///
+    /// Parallel version of count_if(view, pred)
+    ///
+    /// \param policy Execution policy specifying the number of threads to use
+    template<class T, std::size_t E, std::size_t A, class P>
+    std::size_t count_if(Parallel_policy policy, Vectorized_view<T, E, A> view, P pred) {
+        auto parts = avel_impl::parallel_partition(policy, view.data(), view.size());
+
+        std::vector<std::size_t> partial(parts.count);
+        parts.run([&] (std::size_t k) {
+            partial[k] = count_if(view.subview(parts.begin(k), parts.size(k)), pred);
+        });
+
+        return std::accumulate(partial.begin(), partial.end(), std::size_t(0));
+    }
+
+    ///
+    /// Parallel version of count(view, value)
+    ///
+    /// \param policy Execution policy specifying the number of threads to use
+    template<class T, std::size_t E, std::size_t A>
+    std::size_t count(Parallel_policy policy, Vectorized_view<T, E, A> view, typename std::remove_cv<T>::type value) {
+        using vec = typename Vectorized_view<T, E, A>::vector_type;
+
+        const vec v{value};
+        return count_if(policy, view, [v] (vec x) {
+            return x == v;
+        });
+    }
+
+    //=====================================================
+    // Parallel histograms
+    //=====================================================
+
+    ///
+    /// Parallel version of histogram(view, bins). Each thread counts its chunk
+    /// into a private histogram, and these are summed at the end.
+    ///
+    /// \param policy Execution policy specifying the number of threads to use
+    template<class T, std::size_t E, std::size_t A>
+    Histogram histogram(Parallel_policy policy, Vectorized_view<T, E, A> view, std::size_t bins) {
+        auto parts = avel_impl::parallel_partition(policy, view.data(), view.size());
+
+        std::vector<Histogram> partial(parts.count);
+        parts.run([&] (std::size_t k) {
+            partial[k] = histogram(view.subview(parts.begin(k), parts.size(k)), bins);
+        });
+
+        using vec = Natural_width_vector<std::uint32_t>;
+
+        Vectorized_view<std::uint32_t> total{partial[0].data(), bins};
+        for (std::size_t k = 1; k < partial.size(); ++k) {
+            Vectorized_view<const std::uint32_t> counts{partial[k].data(), bins};
+            transform(total, counts, total, [] (vec x, vec y) {
+                return x + y;
+            });
+        }
+
+        return std::move(partial[0]);
+    }
+
+    //=====================================================
+    // Parallel sorting
+    //=====================================================
+
+    ///
+    /// Parallel version of sort(view). Each thread sorts its chunk, after which
+    /// pairs of sorted chunks are merged until a single run remains. Each merge
+    /// is split into independent pieces along its merge path, so that every
+    /// round of merging, including the last, keeps all threads busy.
+    ///
+    /// \param policy Execution policy specifying the number of threads to use
+    template<class T, std::size_t E, std::size_t A>
+    void sort(Parallel_policy policy, Vectorized_view<T, E, A> view) {
+        static_assert(!std::is_const<T>::value, "Cannot sort view over const elements");
+
+        auto parts = avel_impl::parallel_partition(policy, view.data(), view.size());
+        if (parts.count == 1) {
+            sort(view);
+            return;
+        }
+
+        parts.run([&] (std::size_t k) {
+            sort(view.subview(parts.begin(k), parts.size(k)));
+        });
+
+        const std::size_t n = view.size();
+        std::unique_ptr<T[]> buffer{new T[n]};
+
+        T* src = view.data();
+        T* dst = buffer.get();
+
+        for (std::size_t w = 1; w < parts.count; w *= 2) {
+            const std::size_t merges = (parts.count + 2 * w - 1) / (2 * w);
+            const std::size_t pieces = (parts.threads + merges - 1) / merges;
+
+            avel_impl::thread_pool().run(parts.threads, merges * pieces, [&] (std::size_t t) {
+                const std::size_t j = t / pieces;
+                const std::size_t p = t % pieces;
+
+                auto a = parts.begin(2 * w * j);
+                auto m = (2 * w * j + w < parts.count) ? parts.begin(2 * w * j + w) : n;
+                auto e = (2 * w * j + 2 * w < parts.count) ? parts.begin(2 * w * j + 2 * w) : n;
+
+                const std::size_t na = m - a;
+                const std::size_t nb = e - m;
+
+                // Piece p produces the elements [d0, d1) of this merge's output
+                const std::size_t d0 = (na + nb) * p / pieces;
+                const std::size_t d1 = (na + nb) * (p + 1) / pieces;
+
+                auto i0 = avel_impl::merge_path_split(src + a, na, src + m, nb, d0);
+                auto i1 = avel_impl::merge_path_split(src + a, na, src + m, nb, d1);
+
+                avel_impl::merge_ranges(
+                    src + a + i0, i1 - i0,
+                    src + m + (d0 - i0), (d1 - i1) - (d0 - i0),
+                    dst + a + d0
+                );
+            });
+
+            std::swap(src, dst);
+        }
+
+        if (src != view.data()) {
+            parts.run([&] (std::size_t k) {
+                std::copy(src + parts.begin(k), src + parts.end(k), view.data() + parts.begin(k));
+            });
+        }
+    }
+
+}
+
+#endif //AVEL_PARALLEL_HPP
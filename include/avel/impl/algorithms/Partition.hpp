@@ -0,0 +1,617 @@
+#ifndef AVEL_PARTITION_HPP
+#define AVEL_PARTITION_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // Lane partitioning
+    //=====================================================
+
+    template<std::size_t S>
+    using lane_size = std::integral_constant<std::size_t, S>;
+
+    ///
+    /// True if partition_lanes is implemented for vectors of N elements of
+    /// type T without a round trip through memory
+    ///
+    template<class T, std::uint32_t N>
+    constexpr bool has_native_lane_partition() {
+        return
+        #if defined(AVEL_AVX512VBMI2) && defined(AVEL_AVX512BW)
+            (sizeof(T) < 4 && sizeof(T) * N == 64) ||
+        #endif
+        #if defined(AVEL_AVX512F)
+            (4 <= sizeof(T) && sizeof(T) * N == 64) ||
+        #endif
+        #if defined(AVEL_AVX2)
+            (4 <= sizeof(T) && sizeof(T) * N == 32) ||
+        #endif
+        #if defined(AVEL_SSSE3) || defined(AVEL_AARCH64)
+            (4 <= sizeof(T) && sizeof(T) * N == 16) ||
+        #endif
+            false;
+    }
+
+    #if defined(AVEL_SSSE3) || defined(AVEL_AARCH64)
+
+    // Byte indices which move the set lanes of a 128-bit vector to the front,
+    // followed by the remaining lanes, indexed by the lane bitmask
+
+    AVEL_FINL const std::uint8_t* lane_partition_table_4x32() {
+        alignas(16) static constexpr std::uint8_t table[16 * 16] {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x08, 0x09, 0x0a, 0x0b, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x00, 0x01, 0x02, 0x03, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+            0x00, 0x01, 0x02, 0x03, 0x0c, 0x0d, 0x0e, 0x0f, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+            0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b,
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0x08, 0x09, 0x0a, 0x0b,
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+            0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x04, 0x05, 0x06, 0x07,
+            0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x01, 0x02, 0x03,
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        };
+
+        return table;
+    }
+
+    AVEL_FINL const std::uint8_t* lane_partition_table_2x64() {
+        alignas(16) static constexpr std::uint8_t table[4 * 16] {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+        };
+
+        return table;
+    }
+
+    #endif
+
+    #if defined(AVEL_SSSE3)
+
+    AVEL_FINL __m128i partition_lanes_native(__m128i v, std::uint64_t bits, lane_size<4>) {
+        auto indices = _mm_load_si128(reinterpret_cast<const __m128i*>(lane_partition_table_4x32() + 16 * bits));
+        return _mm_shuffle_epi8(v, indices);
+    }
+
+    AVEL_FINL __m128i partition_lanes_native(__m128i v, std::uint64_t bits, lane_size<8>) {
+        auto indices = _mm_load_si128(reinterpret_cast<const __m128i*>(lane_partition_table_2x64() + 16 * bits));
+        return _mm_shuffle_epi8(v, indices);
+    }
+
+    template<std::size_t S>
+    AVEL_FINL __m128 partition_lanes_native(__m128 v, std::uint64_t bits, lane_size<S> s) {
+        return _mm_castsi128_ps(partition_lanes_native(_mm_castps_si128(v), bits, s));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL __m128d partition_lanes_native(__m128d v, std::uint64_t bits, lane_size<S> s) {
+        return _mm_castsi128_pd(partition_lanes_native(_mm_castpd_si128(v), bits, s));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX2)
+
+    // Each entry packs the eight 32-bit lane indices for a call to
+    // _mm256_permutevar8x32_epi32 into consecutive nibbles
+
+    AVEL_FINL const std::uint32_t* lane_partition_table_8x32() {
+        alignas(32) static constexpr std::uint32_t table[256] {
+            0x76543210, 0x76543210, 0x76543201, 0x76543210, 0x76543102, 0x76543120, 0x76543021, 0x76543210,
+            0x76542103, 0x76542130, 0x76542031, 0x76542310, 0x76541032, 0x76541320, 0x76540321, 0x76543210,
+            0x76532104, 0x76532140, 0x76532041, 0x76532410, 0x76531042, 0x76531420, 0x76530421, 0x76534210,
+            0x76521043, 0x76521430, 0x76520431, 0x76524310, 0x76510432, 0x76514320, 0x76504321, 0x76543210,
+            0x76432105, 0x76432150, 0x76432051, 0x76432510, 0x76431052, 0x76431520, 0x76430521, 0x76435210,
+            0x76421053, 0x76421530, 0x76420531, 0x76425310, 0x76410532, 0x76415320, 0x76405321, 0x76453210,
+            0x76321054, 0x76321540, 0x76320541, 0x76325410, 0x76310542, 0x76315420, 0x76305421, 0x76354210,
+            0x76210543, 0x76215430, 0x76205431, 0x76254310, 0x76105432, 0x76154320, 0x76054321, 0x76543210,
+            0x75432106, 0x75432160, 0x75432061, 0x75432610, 0x75431062, 0x75431620, 0x75430621, 0x75436210,
+            0x75421063, 0x75421630, 0x75420631, 0x75426310, 0x75410632, 0x75416320, 0x75406321, 0x75463210,
+            0x75321064, 0x75321640, 0x75320641, 0x75326410, 0x75310642, 0x75316420, 0x75306421, 0x75364210,
+            0x75210643, 0x75216430, 0x75206431, 0x75264310, 0x75106432, 0x75164320, 0x75064321, 0x75643210,
+            0x74321065, 0x74321650, 0x74320651, 0x74326510, 0x74310652, 0x74316520, 0x74306521, 0x74365210,
+            0x74210653, 0x74216530, 0x74206531, 0x74265310, 0x74106532, 0x74165320, 0x74065321, 0x74653210,
+            0x73210654, 0x73216540, 0x73206541, 0x73265410, 0x73106542, 0x73165420, 0x73065421, 0x73654210,
+            0x72106543, 0x72165430, 0x72065431, 0x72654310, 0x71065432, 0x71654320, 0x70654321, 0x76543210,
+            0x65432107, 0x65432170, 0x65432071, 0x65432710, 0x65431072, 0x65431720, 0x65430721, 0x65437210,
+            0x65421073, 0x65421730, 0x65420731, 0x65427310, 0x65410732, 0x65417320, 0x65407321, 0x65473210,
+            0x65321074, 0x65321740, 0x65320741, 0x65327410, 0x65310742, 0x65317420, 0x65307421, 0x65374210,
+            0x65210743, 0x65217430, 0x65207431, 0x65274310, 0x65107432, 0x65174320, 0x65074321, 0x65743210,
+            0x64321075, 0x64321750, 0x64320751, 0x64327510, 0x64310752, 0x64317520, 0x64307521, 0x64375210,
+            0x64210753, 0x64217530, 0x64207531, 0x64275310, 0x64107532, 0x64175320, 0x64075321, 0x64753210,
+            0x63210754, 0x63217540, 0x63207541, 0x63275410, 0x63107542, 0x63175420, 0x63075421, 0x63754210,
+            0x62107543, 0x62175430, 0x62075431, 0x62754310, 0x61075432, 0x61754320, 0x60754321, 0x67543210,
+            0x54321076, 0x54321760, 0x54320761, 0x54327610, 0x54310762, 0x54317620, 0x54307621, 0x54376210,
+            0x54210763, 0x54217630, 0x54207631, 0x54276310, 0x54107632, 0x54176320, 0x54076321, 0x54763210,
+            0x53210764, 0x53217640, 0x53207641, 0x53276410, 0x53107642, 0x53176420, 0x53076421, 0x53764210,
+            0x52107643, 0x52176430, 0x52076431, 0x52764310, 0x51076432, 0x51764320, 0x50764321, 0x57643210,
+            0x43210765, 0x43217650, 0x43207651, 0x43276510, 0x43107652, 0x43176520, 0x43076521, 0x43765210,
+            0x42107653, 0x42176530, 0x42076531, 0x42765310, 0x41076532, 0x41765320, 0x40765321, 0x47653210,
+            0x32107654, 0x32176540, 0x32076541, 0x32765410, 0x31076542, 0x31765420, 0x30765421, 0x37654210,
+            0x21076543, 0x21765430, 0x20765431, 0x27654310, 0x10765432, 0x17654320, 0x07654321, 0x76543210,
+        };
+
+        return table;
+    }
+
+    AVEL_FINL const std::uint32_t* lane_partition_table_4x64() {
+        alignas(32) static constexpr std::uint32_t table[16] {
+            0x76543210, 0x76543210, 0x76541032, 0x76543210, 0x76321054, 0x76325410, 0x76105432, 0x76543210,
+            0x54321076, 0x54327610, 0x54107632, 0x54763210, 0x32107654, 0x32765410, 0x10765432, 0x76543210,
+        };
+
+        return table;
+    }
+
+    AVEL_FINL __m256i unpack_lane_indices(std::uint32_t packed) {
+        // Only the low three bits of each index are read by the permute
+        auto shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+        return _mm256_srlv_epi32(_mm256_set1_epi32(packed), shifts);
+    }
+
+    AVEL_FINL __m256i partition_lanes_native(__m256i v, std::uint64_t bits, lane_size<4>) {
+        return _mm256_permutevar8x32_epi32(v, unpack_lane_indices(lane_partition_table_8x32()[bits]));
+    }
+
+    AVEL_FINL __m256i partition_lanes_native(__m256i v, std::uint64_t bits, lane_size<8>) {
+        return _mm256_permutevar8x32_epi32(v, unpack_lane_indices(lane_partition_table_4x64()[bits]));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL __m256 partition_lanes_native(__m256 v, std::uint64_t bits, lane_size<S> s) {
+        return _mm256_castsi256_ps(partition_lanes_native(_mm256_castps_si256(v), bits, s));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL __m256d partition_lanes_native(__m256d v, std::uint64_t bits, lane_size<S> s) {
+        return _mm256_castsi256_pd(partition_lanes_native(_mm256_castpd_si256(v), bits, s));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX512F)
+
+    ///
+    /// Bitmask of the lanes at and above index c
+    ///
+    AVEL_FINL std::uint64_t lanes_from(std::uint32_t c) {
+        return (c < 64) ? (~std::uint64_t(0) << c) : 0x00;
+    }
+
+    // The set lanes are compressed into the low lanes, and the remaining
+    // lanes are compressed and then expanded into the lanes above them
+
+    AVEL_FINL __m512i partition_lanes_native(__m512i v, std::uint64_t bits, lane_size<4>) {
+        auto m = static_cast<__mmask16>(bits);
+        auto hi = static_cast<__mmask16>(lanes_from(avel::popcount(bits)));
+
+        auto selected = _mm512_maskz_compress_epi32(m, v);
+        auto rejected = _mm512_maskz_compress_epi32(static_cast<__mmask16>(~m), v);
+        return _mm512_mask_expand_epi32(selected, hi, rejected);
+    }
+
+    AVEL_FINL __m512i partition_lanes_native(__m512i v, std::uint64_t bits, lane_size<8>) {
+        auto m = static_cast<__mmask8>(bits);
+        auto hi = static_cast<__mmask8>(lanes_from(avel::popcount(bits)));
+
+        auto selected = _mm512_maskz_compress_epi64(m, v);
+        auto rejected = _mm512_maskz_compress_epi64(static_cast<__mmask8>(~m), v);
+        return _mm512_mask_expand_epi64(selected, hi, rejected);
+    }
+
+    #if defined(AVEL_AVX512VBMI2) && defined(AVEL_AVX512BW)
+
+    AVEL_FINL __m512i partition_lanes_native(__m512i v, std::uint64_t bits, lane_size<1>) {
+        auto m = static_cast<__mmask64>(bits);
+        auto hi = static_cast<__mmask64>(lanes_from(avel::popcount(bits)));
+
+        auto selected = _mm512_maskz_compress_epi8(m, v);
+        auto rejected = _mm512_maskz_compress_epi8(static_cast<__mmask64>(~m), v);
+        return _mm512_mask_expand_epi8(selected, hi, rejected);
+    }
+
+    AVEL_FINL __m512i partition_lanes_native(__m512i v, std::uint64_t bits, lane_size<2>) {
+        auto m = static_cast<__mmask32>(bits);
+        auto hi = static_cast<__mmask32>(lanes_from(avel::popcount(bits)));
+
+        auto selected = _mm512_maskz_compress_epi16(m, v);
+        auto rejected = _mm512_maskz_compress_epi16(static_cast<__mmask32>(~m), v);
+        return _mm512_mask_expand_epi16(selected, hi, rejected);
+    }
+
+    #endif
+
+    template<std::size_t S>
+    AVEL_FINL __m512 partition_lanes_native(__m512 v, std::uint64_t bits, lane_size<S> s) {
+        return _mm512_castsi512_ps(partition_lanes_native(_mm512_castps_si512(v), bits, s));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL __m512d partition_lanes_native(__m512d v, std::uint64_t bits, lane_size<S> s) {
+        return _mm512_castsi512_pd(partition_lanes_native(_mm512_castpd_si512(v), bits, s));
+    }
+
+    #endif
+
+    #if defined(AVEL_AARCH64)
+
+    AVEL_FINL uint8x16_t partition_lanes_native(uint8x16_t v, std::uint64_t bits, lane_size<4>) {
+        return vqtbl1q_u8(v, vld1q_u8(lane_partition_table_4x32() + 16 * bits));
+    }
+
+    AVEL_FINL uint8x16_t partition_lanes_native(uint8x16_t v, std::uint64_t bits, lane_size<8>) {
+        return vqtbl1q_u8(v, vld1q_u8(lane_partition_table_2x64() + 16 * bits));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL uint32x4_t partition_lanes_native(uint32x4_t v, std::uint64_t bits, lane_size<S> s) {
+        return vreinterpretq_u32_u8(partition_lanes_native(vreinterpretq_u8_u32(v), bits, s));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL int32x4_t partition_lanes_native(int32x4_t v, std::uint64_t bits, lane_size<S> s) {
+        return vreinterpretq_s32_u8(partition_lanes_native(vreinterpretq_u8_s32(v), bits, s));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL uint64x2_t partition_lanes_native(uint64x2_t v, std::uint64_t bits, lane_size<S> s) {
+        return vreinterpretq_u64_u8(partition_lanes_native(vreinterpretq_u8_u64(v), bits, s));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL int64x2_t partition_lanes_native(int64x2_t v, std::uint64_t bits, lane_size<S> s) {
+        return vreinterpretq_s64_u8(partition_lanes_native(vreinterpretq_u8_s64(v), bits, s));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL float32x4_t partition_lanes_native(float32x4_t v, std::uint64_t bits, lane_size<S> s) {
+        return vreinterpretq_f32_u8(partition_lanes_native(vreinterpretq_u8_f32(v), bits, s));
+    }
+
+    template<std::size_t S>
+    AVEL_FINL float64x2_t partition_lanes_native(float64x2_t v, std::uint64_t bits, lane_size<S> s) {
+        return vreinterpretq_f64_u8(partition_lanes_native(vreinterpretq_u8_f64(v), bits, s));
+    }
+
+    #endif
+
+    template<class T, std::uint32_t N>
+    AVEL_FINL avel::Vector<T, N> partition_lanes(avel::Vector<T, N> v, avel::Vector_mask<T, N> m, std::true_type) {
+        return avel::Vector<T, N>{partition_lanes_native(avel::decay(v), avel::to_bits(m), lane_size<sizeof(T)>{})};
+    }
+
+    template<class T, std::uint32_t N>
+    AVEL_FINL avel::Vector<T, N> partition_lanes(avel::Vector<T, N> v, avel::Vector_mask<T, N> m, std::false_type) {
+        auto bits = avel::to_bits(m);
+        auto elements = avel::to_array(v);
+
+        // Each lane is written unconditionally and the write position only
+        // advances past lanes belonging to the current group. The spare slot
+        // absorbs writes made once all lanes have been filled
+        std::array<T, N + 1> ret{};
+
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            ret[j] = elements[i];
+            j += (bits >> i) & 0x1;
+        }
+
+        for (std::size_t i = 0; i < N; ++i) {
+            ret[j] = elements[i];
+            j += (~bits >> i) & 0x1;
+        }
+
+        return avel::load<avel::Vector<T, N>>(ret.data());
+    }
+
+    ///
+    /// Moves the lanes of v which are set in m to the front, followed by the
+    /// remaining lanes. Both groups keep their original relative order.
+    ///
+    /// Storing the result writes the selected elements contiguously, the
+    /// same as a compress-store, while the rejected elements end up
+    /// contiguous at the back of the vector
+    ///
+    template<class T, std::uint32_t N>
+    AVEL_FINL avel::Vector<T, N> partition_lanes(avel::Vector<T, N> v, avel::Vector_mask<T, N> m) {
+        return partition_lanes(v, m, std::integral_constant<bool, has_native_lane_partition<T, N>()>{});
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Filtering
+    //=====================================================
+
+    ///
+    /// Copies the elements of input for which pred returns true to the front
+    /// of output, preserving their relative order.
+    ///
+    /// Selected lanes are moved to the front of each vector using a
+    /// compress or table-driven permute, after which the whole vector is
+    /// stored. Four vectors are processed per iteration. Their output
+    /// positions are computed from the counts of selected lanes before any
+    /// stores take place, which keeps the dependency chain on the output
+    /// position to a few adds per block.
+    ///
+    /// \param input View over elements to filter
+    /// \param output View to write selected elements to. Must have at least
+    ///     as many elements as input since elements past the returned count
+    ///     may be overwritten. May alias input exactly
+    /// \param pred Callable which takes input's vector_type and returns the
+    ///     corresponding mask type
+    /// \return Number of elements written to output
+    template<
+        class T0, std::size_t E0, std::size_t A0,
+        class T1, std::size_t E1, std::size_t A1,
+        class P
+    >
+    std::size_t copy_if(Vectorized_view<T0, E0, A0> input, Vectorized_view<T1, E1, A1> output, P pred) {
+        using vec = typename Vectorized_view<T0, E0, A0>::vector_type;
+
+        static_assert(!std::is_const<T1>::value, "Cannot write to view over const elements");
+        static_assert(
+            std::is_same<typename std::remove_cv<T0>::type, T1>::value,
+            "Input and output must have the same element type"
+        );
+
+        constexpr std::size_t width = vec::width;
+        constexpr std::size_t block_size = 4 * width;
+
+        const T1* in = input.data();
+        T1* out = output.data();
+        const std::size_t n = input.size();
+
+        std::size_t k = 0;
+
+        std::size_t i = 0;
+        for (; i + block_size <= n; i += block_size) {
+            auto v0 = load<vec>(in + i + 0 * width);
+            auto v1 = load<vec>(in + i + 1 * width);
+            auto v2 = load<vec>(in + i + 2 * width);
+            auto v3 = load<vec>(in + i + 3 * width);
+
+            auto m0 = pred(v0);
+            auto m1 = pred(v1);
+            auto m2 = pred(v2);
+            auto m3 = pred(v3);
+
+            auto k0 = k;
+            auto k1 = k0 + count(m0);
+            auto k2 = k1 + count(m1);
+            auto k3 = k2 + count(m2);
+            k       = k3 + count(m3);
+
+            store(out + k0, avel_impl::partition_lanes(v0, m0));
+            store(out + k1, avel_impl::partition_lanes(v1, m1));
+            store(out + k2, avel_impl::partition_lanes(v2, m2));
+            store(out + k3, avel_impl::partition_lanes(v3, m3));
+        }
+
+        for (; i + width <= n; i += width) {
+            auto v = load<vec>(in + i);
+            auto m = pred(v);
+
+            store(out + k, avel_impl::partition_lanes(v, m));
+            k += count(m);
+        }
+
+        if (i < n) {
+            auto tail_size = static_cast<std::uint32_t>(n - i);
+
+            auto v = load<vec>(in + i, tail_size);
+            auto bits = to_bits(pred(v));
+            auto elements = to_array(v);
+
+            // k never exceeds the index of the element being written
+            for (std::uint32_t j = 0; j < tail_size; ++j) {
+                out[k] = elements[j];
+                k += (bits >> j) & 0x1;
+            }
+        }
+
+        return k;
+    }
+
+    ///
+    /// Reorders the elements of view so that those for which pred returns
+    /// true precede all others, preserving the relative order of elements
+    /// within each group.
+    ///
+    /// Selected elements are compacted in place while rejected elements are
+    /// compacted into a temporary buffer, four vectors per iteration, before
+    /// being copied back behind the selected elements.
+    ///
+    /// \param view View over elements to partition
+    /// \param pred Callable which takes view's vector_type and returns the
+    ///     corresponding mask type
+    /// \return Number of elements for which pred returned true
+    template<class T, std::size_t E, std::size_t A, class P>
+    std::size_t stable_partition(Vectorized_view<T, E, A> view, P pred) {
+        using vec = typename Vectorized_view<T, E, A>::vector_type;
+        using scalar = typename vec::scalar;
+
+        static_assert(!std::is_const<T>::value, "Cannot partition view over const elements");
+
+        constexpr std::size_t width = vec::width;
+        constexpr std::size_t block_size = 4 * width;
+
+        scalar* ptr = view.data();
+        const std::size_t n = view.size();
+
+        std::unique_ptr<scalar[]> rejected{new scalar[n]};
+
+        std::size_t k = 0;
+        std::size_t r = 0;
+
+        std::size_t i = 0;
+        for (; i + block_size <= n; i += block_size) {
+            auto v0 = load<vec>(ptr + i + 0 * width);
+            auto v1 = load<vec>(ptr + i + 1 * width);
+            auto v2 = load<vec>(ptr + i + 2 * width);
+            auto v3 = load<vec>(ptr + i + 3 * width);
+
+            auto m0 = pred(v0);
+            auto m1 = pred(v1);
+            auto m2 = pred(v2);
+            auto m3 = pred(v3);
+
+            auto c0 = count(m0);
+            auto c1 = count(m1);
+            auto c2 = count(m2);
+            auto c3 = count(m3);
+
+            auto k0 = k;
+            auto k1 = k0 + c0;
+            auto k2 = k1 + c1;
+            auto k3 = k2 + c2;
+            k       = k3 + c3;
+
+            auto r0 = r;
+            auto r1 = r0 + (width - c0);
+            auto r2 = r1 + (width - c1);
+            auto r3 = r2 + (width - c2);
+            r       = r3 + (width - c3);
+
+            store(ptr + k0, avel_impl::partition_lanes(v0, m0));
+            store(ptr + k1, avel_impl::partition_lanes(v1, m1));
+            store(ptr + k2, avel_impl::partition_lanes(v2, m2));
+            store(ptr + k3, avel_impl::partition_lanes(v3, m3));
+
+            store(rejected.get() + r0, avel_impl::partition_lanes(v0, !m0));
+            store(rejected.get() + r1, avel_impl::partition_lanes(v1, !m1));
+            store(rejected.get() + r2, avel_impl::partition_lanes(v2, !m2));
+            store(rejected.get() + r3, avel_impl::partition_lanes(v3, !m3));
+        }
+
+        for (; i + width <= n; i += width) {
+            auto v = load<vec>(ptr + i);
+            auto m = pred(v);
+            auto c = count(m);
+
+            store(ptr + k, avel_impl::partition_lanes(v, m));
+            store(rejected.get() + r, avel_impl::partition_lanes(v, !m));
+
+            k += c;
+            r += width - c;
+        }
+
+        if (i < n) {
+            auto tail_size = static_cast<std::uint32_t>(n - i);
+
+            auto v = load<vec>(ptr + i, tail_size);
+            auto bits = to_bits(pred(v));
+            auto elements = to_array(v);
+
+            for (std::uint32_t j = 0; j < tail_size; ++j) {
+                std::size_t b = (bits >> j) & 0x1;
+
+                ptr[k] = elements[j];
+                rejected[r] = elements[j];
+
+                k += b;
+                r += 1 - b;
+            }
+        }
+
+        std::copy(rejected.get(), rejected.get() + r, ptr + k);
+
+        return k;
+    }
+
+
+    ///
+    /// Reorders the elements of view so that those for which pred returns
+    /// true precede all others. The relative order of elements is not
+    /// preserved.
+    ///
+    /// The partition is performed in place. A vector is read from each end of
+    /// view before any writes occur, after which each vector read is
+    /// partitioned in-register and stored to both the front and the back.
+    /// Subsequent vectors are read from whichever end has less room left.
+    ///
+    /// \param view View over elements to partition
+    /// \param pred Callable which takes view's vector_type and returns the
+    ///     corresponding mask type
+    /// \return Number of elements for which pred returned true
+    template<class T, std::size_t E, std::size_t A, class P>
+    std::size_t partition(Vectorized_view<T, E, A> view, P pred) {
+        using vec = typename Vectorized_view<T, E, A>::vector_type;
+        using scalar = typename vec::scalar;
+
+        static_assert(!std::is_const<T>::value, "Cannot partition view over const elements");
+
+        constexpr std::size_t width = vec::width;
+
+        scalar* ptr = view.data();
+        const std::size_t n = view.size();
+
+        if (n < 2 * width) {
+            return stable_partition(view, pred);
+        }
+
+        auto first = load<vec>(ptr);
+        auto last = load<vec>(ptr + n - width);
+
+        std::size_t read_l = width;
+        std::size_t read_r = n - width;
+        std::size_t write_l = 0;
+        std::size_t write_r = n;
+
+        auto write_both_ends = [&] (vec v) {
+            auto m = pred(v);
+            auto p = avel_impl::partition_lanes(v, m);
+            auto c = count(m);
+
+            store(ptr + write_l, p);
+            store(ptr + write_r - width, p);
+
+            write_l += c;
+            write_r -= width - c;
+        };
+
+        while (width <= read_r - read_l) {
+            if (read_l - write_l <= write_r - read_r) {
+                write_both_ends(load<vec>(ptr + read_l));
+                read_l += width;
+            } else {
+                read_r -= width;
+                write_both_ends(load<vec>(ptr + read_r));
+            }
+        }
+
+        // The last few unread elements are handled first, after which the
+        // range between the write positions can hold the remaining vectors
+        auto rest_size = static_cast<std::uint32_t>(read_r - read_l);
+        if (rest_size != 0) {
+            auto rest = load<vec>(ptr + read_l, rest_size);
+            auto bits = to_bits(pred(rest));
+            auto elements = to_array(rest);
+
+            for (std::uint32_t j = 0; j < rest_size; ++j) {
+                if ((bits >> j) & 0x1) {
+                    ptr[write_l++] = elements[j];
+                } else {
+                    ptr[--write_r] = elements[j];
+                }
+            }
+        }
+
+        write_both_ends(first);
+        write_both_ends(last);
+
+        return write_l;
+    }
+
+}
+
+#endif //AVEL_PARTITION_HPP
@@ -0,0 +1,90 @@
+#ifndef AVEL_REDUCE_HPP
+#define AVEL_REDUCE_HPP
+
+namespace avel_impl {
+
+    template<class V, bool Aligned>
+    V reduce_body(const typename V::scalar* ptr, std::size_t n, std::integral_constant<bool, Aligned> aligned) {
+        using scalar = typename V::scalar;
+        constexpr std::size_t width = V::width;
+        constexpr std::size_t block_size = 4 * width;
+
+        V acc0{scalar(0)};
+        V acc1{scalar(0)};
+        V acc2{scalar(0)};
+        V acc3{scalar(0)};
+
+        std::size_t i = 0;
+        for (; i + block_size <= n; i += block_size) {
+            acc0 += body_load<V>(ptr + i + 0 * width, aligned);
+            acc1 += body_load<V>(ptr + i + 1 * width, aligned);
+            acc2 += body_load<V>(ptr + i + 2 * width, aligned);
+            acc3 += body_load<V>(ptr + i + 3 * width, aligned);
+        }
+
+        for (; i + width <= n; i += width) {
+            acc0 += body_load<V>(ptr + i, aligned);
+        }
+
+        if (i < n) {
+            // Lanes past the end of the view are loaded as zeros
+            acc1 += avel::load<V>(ptr + i, static_cast<std::uint32_t>(n - i));
+        }
+
+        return (acc0 + acc1) + (acc2 + acc3);
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Reductions
+    //=====================================================
+
+    ///
+    /// Computes the sum of the elements in view.
+    ///
+    /// Leading elements are peeled off so that the remainder of view may be
+    /// read using aligned loads. Four independent accumulators are used so
+    /// that consecutive additions do not depend on each other. As a
+    /// consequence, floating-point results may differ from those of a
+    /// sequential sum due to rounding.
+    ///
+    /// \param view View over elements to sum
+    /// \param init Value to add the elements to
+    /// \return init plus the sum of all elements in view
+    template<class T, std::size_t E, std::size_t A>
+    typename std::remove_cv<T>::type reduce(
+        Vectorized_view<T, E, A> view,
+        typename std::remove_cv<T>::type init = 0
+    ) {
+        using scalar = typename std::remove_cv<T>::type;
+        using vec = typename Vectorized_view<T, E, A>::vector_type;
+
+        const scalar* ptr = view.data();
+        const std::size_t n = view.size();
+
+        auto peel = avel_impl::peel<vec, A>(ptr, n);
+
+        // Lanes past the head are loaded as zeros
+        vec sum = load<vec>(ptr, static_cast<std::uint32_t>(peel.head));
+        if (peel.aligned) {
+            sum += avel_impl::reduce_body<vec>(ptr + peel.head, n - peel.head, std::true_type{});
+        } else {
+            sum += avel_impl::reduce_body<vec>(ptr, n, std::false_type{});
+        }
+
+        auto lanes = to_array(sum);
+
+        scalar total = init;
+        for (auto x : lanes) {
+            total = scalar(total + x);
+        }
+
+        return total;
+    }
+
+}
+
+#endif //AVEL_REDUCE_HPP
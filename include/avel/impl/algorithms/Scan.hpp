@@ -0,0 +1,143 @@
+#ifndef AVEL_SCAN_HPP
+#define AVEL_SCAN_HPP
+
+namespace avel {
+
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    ///
+    /// Writes the inclusive prefix sum of the elements in input to output.
+    /// That is, output[i] = init + input[0] + ... + input[i].
+    ///
+    /// Four vectors are scanned independently per iteration, and their
+    /// offsets within the block are summed separately from the running total,
+    /// so only a single add per four vectors depends on the previous
+    /// iteration.
+    ///
+    /// \param input View over elements to scan
+    /// \param output View to write results to. Must have at least as many
+    ///     elements as input. May alias input exactly, in which case input
+    ///     must be a view over mutable elements
+    /// \param init Value to offset all outputs by
+    /// \return init plus the sum of all elements in input
+    template<class T, std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    typename std::remove_cv<T>::type inclusive_scan(
+        Vectorized_view<T, E0, A0> input,
+        Vectorized_view<typename std::remove_cv<T>::type, E1, A1> output,
+        typename std::remove_cv<T>::type init = 0
+    ) {
+        using scalar = typename std::remove_cv<T>::type;
+        using vec = Natural_width_vector<scalar>;
+        constexpr std::size_t width = vec::width;
+        constexpr std::size_t block_size = 4 * width;
+
+        const scalar* in = input.data();
+        scalar* out = output.data();
+        const std::size_t n = input.size();
+
+        vec carry{init};
+
+        std::size_t i = 0;
+        for (; i + block_size <= n; i += block_size) {
+            auto s0 = inclusive_scan(load<vec>(in + i + 0 * width));
+            auto s1 = inclusive_scan(load<vec>(in + i + 1 * width));
+            auto s2 = inclusive_scan(load<vec>(in + i + 2 * width));
+            auto s3 = inclusive_scan(load<vec>(in + i + 3 * width));
+
+            // Offsets of each vector within the block are computed without
+            // reference to the running total
+            auto p1 = avel_impl::broadcast_last(s0);
+            auto p2 = p1 + avel_impl::broadcast_last(s1);
+            auto p3 = p2 + avel_impl::broadcast_last(s2);
+            auto t  = p3 + avel_impl::broadcast_last(s3);
+
+            store(out + i + 0 * width, s0 + carry);
+            store(out + i + 1 * width, s1 + (carry + p1));
+            store(out + i + 2 * width, s2 + (carry + p2));
+            store(out + i + 3 * width, s3 + (carry + p3));
+
+            carry += t;
+        }
+
+        for (; i < n; i += width) {
+            auto count = static_cast<std::uint32_t>(std::min(n - i, width));
+
+            // Lanes past count are loaded as zeros so the last lane of the
+            // scan still holds the sum of the loaded elements
+            auto s = inclusive_scan(load<vec>(in + i, count));
+            store(out + i, s + carry, count);
+            carry += avel_impl::broadcast_last(s);
+        }
+
+        return extract<0>(carry);
+    }
+
+    ///
+    /// Writes the exclusive prefix sum of the elements in input to output.
+    /// That is, output[0] = init and output[i] = init + input[0] + ... +
+    /// input[i - 1].
+    ///
+    /// Commonly used to compute the offsets of variable-length records from
+    /// their lengths.
+    ///
+    /// \param input View over elements to scan
+    /// \param output View to write results to. Must have at least as many
+    ///     elements as input. May alias input exactly, in which case input
+    ///     must be a view over mutable elements
+    /// \param init Value to offset all outputs by
+    /// \return init plus the sum of all elements in input
+    template<class T, std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    typename std::remove_cv<T>::type exclusive_scan(
+        Vectorized_view<T, E0, A0> input,
+        Vectorized_view<typename std::remove_cv<T>::type, E1, A1> output,
+        typename std::remove_cv<T>::type init = 0
+    ) {
+        using scalar = typename std::remove_cv<T>::type;
+        using vec = Natural_width_vector<scalar>;
+        constexpr std::size_t width = vec::width;
+        constexpr std::size_t block_size = 4 * width;
+
+        const scalar* in = input.data();
+        scalar* out = output.data();
+        const std::size_t n = input.size();
+
+        vec carry{init};
+
+        std::size_t i = 0;
+        for (; i + block_size <= n; i += block_size) {
+            auto s0 = inclusive_scan(load<vec>(in + i + 0 * width));
+            auto s1 = inclusive_scan(load<vec>(in + i + 1 * width));
+            auto s2 = inclusive_scan(load<vec>(in + i + 2 * width));
+            auto s3 = inclusive_scan(load<vec>(in + i + 3 * width));
+
+            // Offsets of each vector within the block are computed without
+            // reference to the running total
+            auto p1 = avel_impl::broadcast_last(s0);
+            auto p2 = p1 + avel_impl::broadcast_last(s1);
+            auto p3 = p2 + avel_impl::broadcast_last(s2);
+            auto t  = p3 + avel_impl::broadcast_last(s3);
+
+            store(out + i + 0 * width, avel_impl::inclusive_to_exclusive_scan(s0) + carry);
+            store(out + i + 1 * width, avel_impl::inclusive_to_exclusive_scan(s1) + (carry + p1));
+            store(out + i + 2 * width, avel_impl::inclusive_to_exclusive_scan(s2) + (carry + p2));
+            store(out + i + 3 * width, avel_impl::inclusive_to_exclusive_scan(s3) + (carry + p3));
+
+            carry += t;
+        }
+
+        for (; i < n; i += width) {
+            auto count = static_cast<std::uint32_t>(std::min(n - i, width));
+
+            auto s = inclusive_scan(load<vec>(in + i, count));
+            store(out + i, avel_impl::inclusive_to_exclusive_scan(s) + carry, count);
+            carry += avel_impl::broadcast_last(s);
+        }
+
+        return extract<0>(carry);
+    }
+
+}
+
+#endif //AVEL_SCAN_HPP
@@ -0,0 +1,444 @@
+#ifndef AVEL_SEARCH_HPP
+#define AVEL_SEARCH_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // K-ary search
+    //=====================================================
+
+    // Searches compare a key against one vector of pivots per step. The
+    // number of pivots is capped at 16 since each pivot is loaded separately,
+    // and since nodes of a Btree_layout should not exceed a cache line
+
+    template<class T>
+    using Search_vector = avel::Vector<T, (avel::natural_vector_width<T>::value < 16) ? avel::natural_vector_width<T>::value : 16>;
+
+    /// Ranges at most this many vectors long are finished with a linear scan
+    constexpr std::size_t linear_search_vectors = 4;
+
+    struct Before_lower_bound {
+        template<class U>
+        AVEL_FINL auto operator()(U x, U key) const -> decltype(x < key) {
+            return x < key;
+        }
+    };
+
+    struct Before_upper_bound {
+        template<class U>
+        AVEL_FINL auto operator()(U x, U key) const -> decltype(x <= key) {
+            return x <= key;
+        }
+    };
+
+    ///
+    /// \tparam C Callable where C(x, key) is true if x precedes the position
+    ///     being searched for. Must accept both scalars and vectors
+    /// \return Number of elements in the sorted range [ptr, ptr + n) for which
+    ///     C(x, key) is true
+    template<class C, class V>
+    std::size_t kary_search(const typename V::scalar* ptr, std::size_t n, typename V::scalar key) {
+        using scalar = typename V::scalar;
+        constexpr std::size_t width = V::width;
+
+        const C before{};
+        const V keys{key};
+
+        // The answer always lies within [lo, lo + n]
+        std::size_t lo = 0;
+        while (n > linear_search_vectors * width) {
+            // Divide the range into width + 1 segments separated by pivots.
+            // The pivots are loaded independently of each other so that their
+            // cache misses overlap
+            const std::size_t step = n / (width + 1);
+
+            alignas(alignof(V)) scalar pivots[width];
+            for (std::size_t i = 0; i < width; ++i) {
+                pivots[i] = ptr[lo + (i + 1) * step - 1];
+            }
+
+            const std::size_t c = count(before(avel::aligned_load<V>(pivots), keys));
+
+            lo += c * step;
+            n = (c < width) ? step - 1 : n - width * step;
+        }
+
+        auto pred = [&before, &keys] (V x) {
+            return before(x, keys);
+        };
+
+        // All elements of the remaining range which precede the key come
+        // before those that don't, so counting them finds the boundary
+        return lo + count_if_body<V>(ptr + lo, n, pred, std::false_type{});
+    }
+
+    // Conversions from comparison masks to masks over the index type. Masks
+    // over floating-point vectors cannot be converted directly
+
+    template<class M, class U>
+    AVEL_FINL M to_index_mask(U m, std::true_type) {
+        return M{m};
+    }
+
+    template<class M, class U>
+    AVEL_FINL M to_index_mask(U m, std::false_type) {
+        auto bits = to_bits(m);
+
+        std::array<bool, M::width> lanes;
+        for (std::size_t i = 0; i < M::width; ++i) {
+            lanes[i] = (bits >> i) & 0x1;
+        }
+
+        return M{lanes};
+    }
+
+    ///
+    /// Performs a branchless binary search for each lane of keys at once,
+    /// fetching the probed elements using gathers
+    ///
+    /// \tparam C Callable where C(x, key) is true if x precedes the position
+    ///     being searched for. Must accept vectors
+    template<class C, class T, std::uint32_t N>
+    avel::Vector<typename avel::to_index_type<T>::type, N> batch_search(const T* ptr, std::size_t n, avel::Vector<T, N> keys) {
+        using index = typename avel::to_index_type<T>::type;
+        using index_vector = avel::Vector<index, N>;
+        using index_mask = typename index_vector::mask;
+
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Batched searches are only supported for 32- and 64-bit elements");
+
+        const C before{};
+
+        index_vector base{index(0)};
+        if (n == 0) {
+            return base;
+        }
+
+        // Every lane takes the same number of steps, so the length of the
+        // range being searched is uniform across lanes
+        std::size_t len = n;
+        while (len > 1) {
+            const std::size_t half = len / 2;
+
+            auto probe = avel::gather<avel::Vector<T, N>>(ptr, base + index_vector{index(half - 1)});
+            base += keep(to_index_mask<index_mask>(before(probe, keys), std::is_integral<T>{}), index_vector{index(half)});
+
+            len -= half;
+        }
+
+        auto probe = avel::gather<avel::Vector<T, N>>(ptr, base);
+        base += keep(to_index_mask<index_mask>(before(probe, keys), std::is_integral<T>{}), index_vector{index(1)});
+
+        return base;
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Searching sorted ranges
+    //=====================================================
+
+    ///
+    /// Finds the first element of a sorted view which is not less than key.
+    ///
+    /// Rather than comparing against a single midpoint, each step of the
+    /// search compares the key against a vector of evenly spaced pivots and
+    /// counts how many are less than it, shrinking the range by a factor of
+    /// one more than the number of pivots. Short ranges are finished with a
+    /// linear vectorized scan.
+    ///
+    /// \param view View over elements sorted in non-decreasing order. Must not
+    ///     contain NaNs
+    /// \param key Value to search for
+    /// \return Index of first element not less than key, or view.size() if
+    ///     no such element exists
+    template<class T, std::size_t E, std::size_t A>
+    std::size_t lower_bound(Vectorized_view<const T, E, A> view, T key) {
+        using vec = avel_impl::Search_vector<T>;
+        return avel_impl::kary_search<avel_impl::Before_lower_bound, vec>(view.data(), view.size(), key);
+    }
+
+    ///
+    /// Finds the first element of a sorted view which is greater than key.
+    ///
+    /// \param view View over elements sorted in non-decreasing order. Must not
+    ///     contain NaNs
+    /// \param key Value to search for
+    /// \return Index of first element greater than key, or view.size() if no
+    ///     such element exists
+    template<class T, std::size_t E, std::size_t A>
+    std::size_t upper_bound(Vectorized_view<const T, E, A> view, T key) {
+        using vec = avel_impl::Search_vector<T>;
+        return avel_impl::kary_search<avel_impl::Before_upper_bound, vec>(view.data(), view.size(), key);
+    }
+
+    ///
+    /// Searches a sorted view for each lane of keys in parallel. Intended for
+    /// probing a sorted table with many keys at once, such as in a join.
+    ///
+    /// \param view View over elements sorted in non-decreasing order. Must not
+    ///     contain NaNs and its size must be representable by the index type
+    /// \param keys Values to search for
+    /// \return Vector whose lanes contain the index of the first element not
+    ///     less than the corresponding lane of keys, or view.size() if no
+    ///     such element exists. Suitable for use as gather indices
+    template<class T, std::size_t E, std::size_t A, std::uint32_t N>
+    Vector<typename to_index_type<T>::type, N> lower_bound(Vectorized_view<const T, E, A> view, Vector<T, N> keys) {
+        return avel_impl::batch_search<avel_impl::Before_lower_bound>(view.data(), view.size(), keys);
+    }
+
+    ///
+    /// \param view View over elements sorted in non-decreasing order. Must not
+    ///     contain NaNs and its size must be representable by the index type
+    /// \param keys Values to search for
+    /// \return Vector whose lanes contain the index of the first element
+    ///     greater than the corresponding lane of keys, or view.size() if no
+    ///     such element exists
+    template<class T, std::size_t E, std::size_t A, std::uint32_t N>
+    Vector<typename to_index_type<T>::type, N> upper_bound(Vectorized_view<const T, E, A> view, Vector<T, N> keys) {
+        return avel_impl::batch_search<avel_impl::Before_upper_bound>(view.data(), view.size(), keys);
+    }
+
+    //=====================================================
+    // B-tree layout
+    //=====================================================
+
+    ///
+    /// A copy of a sorted range rearranged into an implicit static B-tree.
+    ///
+    /// Each node holds one vector of keys and has one more child than it has
+    /// keys. Nodes are stored in breadth-first order so that the children of
+    /// a node are found arithmetically, and are aligned so that each lies
+    /// within a single cache line. A search therefore touches one cache line
+    /// per level of the tree, and the upper levels, which every search visits,
+    /// tend to remain cached across searches.
+    ///
+    /// Searches report positions within the original sorted range.
+    ///
+    /// \tparam T Element type
+    template<class T>
+    class Btree_layout {
+    public:
+
+        using value_type = T;
+        using vector_type = avel_impl::Search_vector<T>;
+
+        static constexpr std::size_t node_width = vector_type::width;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Btree_layout() = default;
+
+        ///
+        /// \param sorted View over elements sorted in non-decreasing order.
+        ///     Must not contain NaNs
+        template<std::size_t E, std::size_t A>
+        explicit Btree_layout(Vectorized_view<const T, E, A> sorted):
+            n(sorted.size()),
+            node_count((sorted.size() + node_width - 1) / node_width),
+            keys(node_count * node_width),
+            ranks(node_count * node_width) {
+
+            std::size_t next = 0;
+            build(sorted.data(), 0, next);
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// \return Number of elements in the original sorted range
+        [[nodiscard]]
+        std::size_t size() const {
+            return n;
+        }
+
+        //=================================================
+        // Searching
+        //=================================================
+
+        ///
+        /// \param key Value to search for
+        /// \return Index of first element of the original range not less than
+        ///     key, or size() if no such element exists
+        [[nodiscard]]
+        std::size_t lower_bound(T key) const {
+            return search<avel_impl::Before_lower_bound>(key);
+        }
+
+        ///
+        /// \param key Value to search for
+        /// \return Index of first element of the original range greater than
+        ///     key, or size() if no such element exists
+        [[nodiscard]]
+        std::size_t upper_bound(T key) const {
+            return search<avel_impl::Before_upper_bound>(key);
+        }
+
+        ///
+        /// Performs lower_bound() for each element of queries. Several
+        /// searches are advanced in lockstep so that their cache misses
+        /// overlap.
+        ///
+        /// \param queries View over values to search for
+        /// \param out Pointer to array with room for queries.size() indices
+        template<std::size_t E, std::size_t A>
+        void lower_bound(Vectorized_view<const T, E, A> queries, std::size_t* out) const {
+            search<avel_impl::Before_lower_bound>(queries.data(), queries.size(), out);
+        }
+
+        ///
+        /// Performs upper_bound() for each element of queries
+        ///
+        /// \param queries View over values to search for
+        /// \param out Pointer to array with room for queries.size() indices
+        template<std::size_t E, std::size_t A>
+        void upper_bound(Vectorized_view<const T, E, A> queries, std::size_t* out) const {
+            search<avel_impl::Before_upper_bound>(queries.data(), queries.size(), out);
+        }
+
+    private:
+
+        //=================================================
+        // Static members
+        //=================================================
+
+        /// Number of searches advanced in lockstep by batched searches
+        static constexpr std::size_t interleave = 8;
+
+        ///
+        /// Value used to fill unused slots. Not less than any valid key so
+        /// that the keys of each node remain sorted
+        static constexpr T padding() {
+            return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+        }
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        std::size_t n = 0;
+
+        std::size_t node_count = 0;
+
+        std::vector<T, Aligned_allocator<T, alignof(vector_type)>> keys{};
+
+        /// Position within the original range of each key
+        std::vector<std::size_t> ranks{};
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        static std::size_t child(std::size_t node, std::size_t i) {
+            return node * (node_width + 1) + i + 1;
+        }
+
+        ///
+        /// Fills the subtree rooted at node with elements from sorted,
+        /// visiting nodes in order
+        void build(const T* sorted, std::size_t node, std::size_t& next) {
+            if (node >= node_count) {
+                return;
+            }
+
+            for (std::size_t i = 0; i < node_width; ++i) {
+                build(sorted, child(node, i), next);
+
+                const std::size_t slot = node * node_width + i;
+                if (next < n) {
+                    keys[slot] = sorted[next];
+                    ranks[slot] = next;
+                    ++next;
+                } else {
+                    keys[slot] = padding();
+                    ranks[slot] = n;
+                }
+            }
+
+            build(sorted, child(node, node_width), next);
+        }
+
+        ///
+        /// Advances a search by one level
+        ///
+        /// \param node Node to search, replaced with the child to descend into
+        /// \param result Candidate result, updated if the node contains one
+        template<class C>
+        AVEL_FINL void step(const vector_type& key, std::size_t& node, std::size_t& result) const {
+            const C before{};
+
+            auto v = aligned_load<vector_type>(keys.data() + node * node_width);
+            const std::size_t i = count(before(v, key));
+
+            if (i < node_width) {
+                result = ranks[node * node_width + i];
+            }
+
+            node = child(node, i);
+        }
+
+        template<class C>
+        std::size_t search(T key) const {
+            const vector_type k{key};
+
+            std::size_t result = n;
+            std::size_t node = 0;
+            while (node < node_count) {
+                step<C>(k, node, result);
+            }
+
+            return result;
+        }
+
+        template<class C>
+        void search(const T* queries, std::size_t m, std::size_t* out) const {
+            std::size_t i = 0;
+            for (; i + interleave <= m; i += interleave) {
+                vector_type k[interleave];
+                std::size_t node[interleave];
+                std::size_t result[interleave];
+
+                for (std::size_t j = 0; j < interleave; ++j) {
+                    k[j] = vector_type{queries[i + j]};
+                    node[j] = 0;
+                    result[j] = n;
+                }
+
+                // Leaves differ in depth by at most one level
+                bool active = node_count != 0;
+                while (active) {
+                    active = false;
+                    for (std::size_t j = 0; j < interleave; ++j) {
+                        if (node[j] < node_count) {
+                            step<C>(k[j], node[j], result[j]);
+                            active = true;
+                        }
+                    }
+                }
+
+                for (std::size_t j = 0; j < interleave; ++j) {
+                    out[i + j] = result[j];
+                }
+            }
+
+            for (; i < m; ++i) {
+                out[i] = search<C>(queries[i]);
+            }
+        }
+
+    };
+
+    template<class T>
+    constexpr std::size_t Btree_layout<T>::node_width;
+
+    template<class T>
+    constexpr std::size_t Btree_layout<T>::interleave;
+
+}
+
+#endif //AVEL_SEARCH_HPP
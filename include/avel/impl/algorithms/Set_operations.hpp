@@ -0,0 +1,523 @@
+#ifndef AVEL_SET_OPERATIONS_HPP
+#define AVEL_SET_OPERATIONS_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // Lane rotations
+    //=====================================================
+
+    // Each of the following functions rotates the contents of a register
+    // towards the lower lanes by B bytes
+
+    // Declared so that the name refers to a template on targets without
+    // vector registers. Single-lane vectors never reach these functions
+    template<std::uint32_t B, class P>
+    P rotate_bytes_down(P v) = delete;
+
+    #if defined(AVEL_SSE2)
+
+    constexpr int rotate_dwords_imm(std::uint32_t k) {
+        return int(
+            ((k + 0) % 4) << 0 |
+            ((k + 1) % 4) << 2 |
+            ((k + 2) % 4) << 4 |
+            ((k + 3) % 4) << 6
+        );
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m128i rotate_bytes_down(__m128i v) {
+        static_assert(B % 4 == 0, "Rotation amount must be a multiple of 4 bytes");
+        constexpr int imm = rotate_dwords_imm(B / 4);
+        return _mm_shuffle_epi32(v, imm);
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX2)
+
+    template<std::uint32_t B>
+    AVEL_FINL __m256i rotate_bytes_down(__m256i v) {
+        static_assert(B % 4 == 0, "Rotation amount must be a multiple of 4 bytes");
+        constexpr std::uint32_t k = B / 4;
+
+        auto indices = _mm256_setr_epi32(
+            (k + 0) % 8, (k + 1) % 8, (k + 2) % 8, (k + 3) % 8,
+            (k + 4) % 8, (k + 5) % 8, (k + 6) % 8, (k + 7) % 8
+        );
+        return _mm256_permutevar8x32_epi32(v, indices);
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX512F)
+
+    template<std::uint32_t B>
+    AVEL_FINL __m512i rotate_bytes_down(__m512i v) {
+        static_assert(B % 4 == 0, "Rotation amount must be a multiple of 4 bytes");
+        return _mm512_alignr_epi32(v, v, B / 4);
+    }
+
+    #endif
+
+    #if defined(AVEL_NEON)
+
+    template<std::uint32_t B>
+    AVEL_FINL uint8x16_t rotate_bytes_down(uint8x16_t v) {
+        return vextq_u8(v, v, B);
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL uint32x4_t rotate_bytes_down(uint32x4_t v) {
+        return vreinterpretq_u32_u8(rotate_bytes_down<B>(vreinterpretq_u8_u32(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL int32x4_t rotate_bytes_down(int32x4_t v) {
+        return vreinterpretq_s32_u8(rotate_bytes_down<B>(vreinterpretq_u8_s32(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL uint64x2_t rotate_bytes_down(uint64x2_t v) {
+        return vreinterpretq_u64_u8(rotate_bytes_down<B>(vreinterpretq_u8_u64(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL int64x2_t rotate_bytes_down(int64x2_t v) {
+        return vreinterpretq_s64_u8(rotate_bytes_down<B>(vreinterpretq_u8_s64(v)));
+    }
+
+    #endif
+
+    ///
+    /// Rotates the contents of v down by R lanes, so that lane i receives the
+    /// contents of lane (i + R) % width
+    ///
+    template<std::uint32_t R, class V>
+    AVEL_FINL V rotate_lanes_down(V v) {
+        static_assert(0 < R && R < V::width, "Rotation amount must be in the range [1, width)");
+        return V{rotate_bytes_down<R * sizeof(typename V::scalar)>(avel::decay(v))};
+    }
+
+    //=====================================================
+    // All-pairs comparison
+    //=====================================================
+
+    template<std::uint32_t R, class V>
+    AVEL_FINL typename V::mask match_any_lane(V, V, typename V::mask m, std::false_type) {
+        return m;
+    }
+
+    template<std::uint32_t R, class V>
+    AVEL_FINL typename V::mask match_any_lane(V a, V b, typename V::mask m, std::true_type) {
+        m |= (a == rotate_lanes_down<R>(b));
+        return match_any_lane<R + 1>(a, b, m, std::integral_constant<bool, (R + 1 < V::width)>{});
+    }
+
+    ///
+    /// Compares every lane of a against every lane of b by comparing a
+    /// against each rotation of b
+    ///
+    /// \return Mask of the lanes in a which are equal to some lane of b
+    template<class V>
+    AVEL_FINL typename V::mask match_any_lane(V a, V b) {
+        return match_any_lane<1>(a, b, a == b, std::integral_constant<bool, (1 < V::width)>{});
+    }
+
+    template<class V>
+    AVEL_FINL V previous_lanes(V, typename V::scalar prev, std::false_type) {
+        return V{prev};
+    }
+
+    template<class V>
+    AVEL_FINL V previous_lanes(V v, typename V::scalar prev, std::true_type) {
+        return avel::insert<0>(shift_elements_up<1>(v), prev);
+    }
+
+    ///
+    /// \return Vector where lane i holds the contents of lane i - 1 of v, and
+    ///     lane 0 holds prev
+    template<class V>
+    AVEL_FINL V previous_lanes(V v, typename V::scalar prev) {
+        return previous_lanes(v, prev, std::integral_constant<bool, (1 < V::width)>{});
+    }
+
+    //=====================================================
+    // Set operation helpers
+    //=====================================================
+
+    ///
+    /// When the sizes of two lists differ by at least this factor, the larger
+    /// list is searched for each element of the smaller one instead
+    ///
+    static constexpr std::size_t galloping_ratio = 32;
+
+    ///
+    /// Writes the lanes of v which are set in m to out + k and advances k.
+    /// Whole vectors are stored while there is room for them before cap
+    ///
+    template<class V>
+    AVEL_FINL void store_selected(
+        typename V::scalar* out,
+        std::size_t& k,
+        std::size_t cap,
+        V v,
+        typename V::mask m
+    ) {
+        if (k + V::width <= cap) {
+            avel::store(out + k, partition_lanes(v, m));
+            k += avel::count(m);
+        } else {
+            auto elements = avel::to_array(v);
+            avel::for_each_set_lane(m, [&] (std::uint32_t i) {
+                out[k++] = elements[i];
+            });
+        }
+    }
+
+    ///
+    /// Finds the first index at or after pos at which ptr[index] >= x.
+    ///
+    /// The search range is found by galloping forward from pos and narrowed
+    /// down by a binary search until it fits within a single vector, which
+    /// is resolved by counting the lanes below x.
+    ///
+    template<class T>
+    std::size_t gallop_lower_bound(const T* ptr, std::size_t n, std::size_t pos, T x) {
+        using vec = avel::Natural_width_vector<T>;
+        constexpr std::size_t width = vec::width;
+
+        if (n <= pos) {
+            return n;
+        }
+
+        std::size_t bound = 1;
+        while (pos + bound < n && ptr[pos + bound] < x) {
+            bound *= 2;
+        }
+
+        std::size_t lo = pos + bound / 2;
+        std::size_t hi = std::min(pos + bound + 1, n);
+
+        while (width < hi - lo) {
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (ptr[mid] < x) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+
+        auto len = static_cast<std::uint32_t>(hi - lo);
+        if (len == 0) {
+            return lo;
+        }
+
+        // Padding lanes of the partial load are excluded from the count
+        auto bits = avel::to_bits(avel::load<vec>(ptr + lo, len) < vec{x});
+        auto valid = (len < 64) ? ((std::uint64_t(1) << len) - 1) : ~std::uint64_t(0);
+        return lo + avel::popcount(bits & valid);
+    }
+
+    template<class T>
+    std::size_t gallop_intersection(const T* small, std::size_t ns, const T* large, std::size_t nl, T* out) {
+        std::size_t k = 0;
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < ns; ++i) {
+            pos = gallop_lower_bound(large, nl, pos, small[i]);
+            if (pos == nl) {
+                break;
+            }
+
+            out[k] = small[i];
+            k += (large[pos] == small[i]);
+        }
+
+        return k;
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Set operations
+    //=====================================================
+
+    ///
+    /// Writes the elements common to both a and b to out in ascending order.
+    ///
+    /// Blocks of a and b are compared all-pairs by comparing a vector from a
+    /// against each rotation of a vector from b. The matching lanes are
+    /// written out using a compress-store, after which whichever block ends
+    /// with the smaller element is advanced. If one list is much larger than
+    /// the other, the larger list is instead searched for each element of the
+    /// smaller list by galloping.
+    ///
+    /// \param a View over elements sorted in strictly increasing order
+    /// \param b View over elements sorted in strictly increasing order
+    /// \param out View to write results to. Must have at least as many
+    ///     elements as the smaller of a and b
+    /// \return Number of elements written to out
+    template<class T, std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1, std::size_t E2, std::size_t A2>
+    std::size_t set_intersection(
+        Vectorized_view<const T, E0, A0> a,
+        Vectorized_view<const T, E1, A1> b,
+        Vectorized_view<T, E2, A2> out
+    ) {
+        using vec = Natural_width_vector<T>;
+        constexpr std::size_t width = vec::width;
+
+        static_assert(std::is_integral<T>::value, "Set operations are only supported for integer types");
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Set operations are only supported for 32- and 64-bit elements");
+
+        const T* pa = a.data();
+        const T* pb = b.data();
+        T* po = out.data();
+        const std::size_t na = a.size();
+        const std::size_t nb = b.size();
+        const std::size_t cap = std::min(na, nb);
+
+        if (na * avel_impl::galloping_ratio <= nb) {
+            return avel_impl::gallop_intersection(pa, na, pb, nb, po);
+        }
+
+        if (nb * avel_impl::galloping_ratio <= na) {
+            return avel_impl::gallop_intersection(pb, nb, pa, na, po);
+        }
+
+        std::size_t i = 0;
+        std::size_t j = 0;
+        std::size_t k = 0;
+
+        while (i + width <= na && j + width <= nb) {
+            auto va = load<vec>(pa + i);
+            auto vb = load<vec>(pb + j);
+
+            avel_impl::store_selected(po, k, cap, va, avel_impl::match_any_lane(va, vb));
+
+            T a_max = pa[i + width - 1];
+            T b_max = pb[j + width - 1];
+            i += (a_max <= b_max) ? width : 0;
+            j += (b_max <= a_max) ? width : 0;
+        }
+
+        while (i < na && j < nb) {
+            T x = pa[i];
+            T y = pb[j];
+            if (x == y) {
+                po[k++] = x;
+            }
+
+            i += (x <= y);
+            j += (y <= x);
+        }
+
+        return k;
+    }
+
+    ///
+    /// Writes the elements present in either a or b to out in ascending
+    /// order, without duplicates.
+    ///
+    /// Vectors from a and b are merged using bitonic merging networks. The
+    /// smaller half of each merge has elements equal to their predecessor
+    /// removed before being written out using a compress-store.
+    ///
+    /// \param a View over elements sorted in strictly increasing order
+    /// \param b View over elements sorted in strictly increasing order
+    /// \param out View to write results to. Must have at least as many
+    ///     elements as a and b combined
+    /// \return Number of elements written to out
+    template<class T, std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1, std::size_t E2, std::size_t A2>
+    std::size_t set_union(
+        Vectorized_view<const T, E0, A0> a,
+        Vectorized_view<const T, E1, A1> b,
+        Vectorized_view<T, E2, A2> out
+    ) {
+        using vec = Natural_width_vector<T>;
+        using span = avel_impl::Key_span<T>;
+        constexpr std::size_t width = vec::width;
+
+        static_assert(std::is_integral<T>::value, "Set operations are only supported for integer types");
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Set operations are only supported for 32- and 64-bit elements");
+
+        const T* pa = a.data();
+        const T* pb = b.data();
+        T* po = out.data();
+        const std::size_t na = a.size();
+        const std::size_t nb = b.size();
+        const std::size_t cap = na + nb;
+
+        std::size_t i = 0;
+        std::size_t j = 0;
+        std::size_t k = 0;
+
+        // Largest elements of the previous merge, which are yet to be written
+        std::array<T, width> pending{};
+        std::size_t pending_size = 0;
+
+        T prev{};
+        bool has_prev = false;
+
+        if (i + width <= na && j + width <= nb) {
+            auto lo = load<vec>(pa + i);
+            auto hi = load<vec>(pb + j);
+            i += width;
+            j += width;
+
+            // The first merged lane is the smaller of the two heads. Its
+            // bitwise negation is guaranteed to differ from it
+            prev = ~std::min(extract<0>(lo), extract<0>(hi));
+            has_prev = true;
+
+            while (true) {
+                avel_impl::merge_groups<span>(lo, hi);
+
+                auto m = lo != avel_impl::previous_lanes(lo, prev);
+                prev = extract<width - 1>(lo);
+                avel_impl::store_selected(po, k, cap, lo, m);
+
+                // A list with fewer than a vector's worth of elements left
+                // may hold elements smaller than those in the other list, so
+                // merging only continues past it once it's empty
+                bool a_full = i + width <= na;
+                bool b_full = j + width <= nb;
+                if (a_full && b_full) {
+                    bool take_a = pa[i] < pb[j];
+                    lo = take_a ? load<vec>(pa + i) : load<vec>(pb + j);
+                    i += take_a ? width : 0;
+                    j += take_a ? 0 : width;
+                } else if (a_full && j == nb) {
+                    lo = load<vec>(pa + i);
+                    i += width;
+                } else if (b_full && i == na) {
+                    lo = load<vec>(pb + j);
+                    j += width;
+                } else {
+                    break;
+                }
+            }
+
+            pending = to_array(hi);
+            pending_size = width;
+        }
+
+        // The remaining elements of both lists and the pending elements form
+        // three sorted sequences which are merged element by element
+        std::size_t p = 0;
+        while (p < pending_size || i < na || j < nb) {
+            T x;
+            if (p < pending_size && (i == na || pending[p] <= pa[i]) && (j == nb || pending[p] <= pb[j])) {
+                x = pending[p++];
+            } else if (i < na && (j == nb || pa[i] <= pb[j])) {
+                x = pa[i++];
+            } else {
+                x = pb[j++];
+            }
+
+            if (!has_prev || x != prev) {
+                po[k++] = x;
+            }
+
+            prev = x;
+            has_prev = true;
+        }
+
+        return k;
+    }
+
+    ///
+    /// Writes the elements of a which are not present in b to out in
+    /// ascending order.
+    ///
+    /// Each vector from a accumulates the mask of lanes matched by the
+    /// vectors of b it overlaps, compared all-pairs, and its unmatched lanes
+    /// are written out using a compress-store once it is passed. If b is much
+    /// larger than a, b is instead searched for each element of a by
+    /// galloping.
+    ///
+    /// \param a View over elements sorted in strictly increasing order
+    /// \param b View over elements sorted in strictly increasing order
+    /// \param out View to write results to. Must have at least as many
+    ///     elements as a
+    /// \return Number of elements written to out
+    template<class T, std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1, std::size_t E2, std::size_t A2>
+    std::size_t set_difference(
+        Vectorized_view<const T, E0, A0> a,
+        Vectorized_view<const T, E1, A1> b,
+        Vectorized_view<T, E2, A2> out
+    ) {
+        using vec = Natural_width_vector<T>;
+        using mask = typename vec::mask;
+        constexpr std::size_t width = vec::width;
+
+        static_assert(std::is_integral<T>::value, "Set operations are only supported for integer types");
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Set operations are only supported for 32- and 64-bit elements");
+
+        const T* pa = a.data();
+        const T* pb = b.data();
+        T* po = out.data();
+        const std::size_t na = a.size();
+        const std::size_t nb = b.size();
+        const std::size_t cap = na;
+
+        std::size_t i = 0;
+        std::size_t j = 0;
+        std::size_t k = 0;
+
+        if (na * avel_impl::galloping_ratio <= nb) {
+            for (; i < na; ++i) {
+                j = avel_impl::gallop_lower_bound(pb, nb, j, pa[i]);
+
+                po[k] = pa[i];
+                k += (j == nb || pb[j] != pa[i]);
+            }
+
+            return k;
+        }
+
+        // Lanes of the current vector from a which have been matched so far
+        mask matched{false};
+
+        while (i + width <= na && j + width <= nb) {
+            auto va = load<vec>(pa + i);
+            auto vb = load<vec>(pb + j);
+            matched |= avel_impl::match_any_lane(va, vb);
+
+            T a_max = pa[i + width - 1];
+            T b_max = pb[j + width - 1];
+
+            if (a_max <= b_max) {
+                avel_impl::store_selected(po, k, cap, va, !matched);
+                matched = mask{false};
+                i += width;
+            }
+
+            j += (b_max <= a_max) ? width : 0;
+        }
+
+        auto matched_bits = to_bits(matched);
+        for (std::size_t l = 0; i < na; ++i, ++l) {
+            T x = pa[i];
+
+            if (l < width && ((matched_bits >> l) & 0x1)) {
+                continue;
+            }
+
+            while (j < nb && pb[j] < x) {
+                ++j;
+            }
+
+            if (j == nb || pb[j] != x) {
+                po[k++] = x;
+            }
+        }
+
+        return k;
+    }
+
+}
+
+#endif //AVEL_SET_OPERATIONS_HPP
@@ -0,0 +1,983 @@
+#ifndef AVEL_SORT_HPP
+#define AVEL_SORT_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // Lane exchanges
+    //=====================================================
+
+    // Each of the following functions swaps each pair of adjacent B-byte
+    // blocks within a register
+
+    // Declared so that the name refers to a template on targets without
+    // vector registers. Single-lane vectors never reach these functions
+    template<std::uint32_t B, class P>
+    P swap_byte_blocks(P v) = delete;
+
+    #if defined(AVEL_SSE2)
+
+    template<std::uint32_t B, typename std::enable_if<B == 4, bool>::type = true>
+    AVEL_FINL __m128i swap_byte_blocks(__m128i v) {
+        return _mm_shuffle_epi32(v, 0xB1);
+    }
+
+    template<std::uint32_t B, typename std::enable_if<B == 8, bool>::type = true>
+    AVEL_FINL __m128i swap_byte_blocks(__m128i v) {
+        return _mm_shuffle_epi32(v, 0x4E);
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m128 swap_byte_blocks(__m128 v) {
+        return _mm_castsi128_ps(swap_byte_blocks<B>(_mm_castps_si128(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m128d swap_byte_blocks(__m128d v) {
+        return _mm_castsi128_pd(swap_byte_blocks<B>(_mm_castpd_si128(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX2)
+
+    template<std::uint32_t B, typename std::enable_if<B == 4, bool>::type = true>
+    AVEL_FINL __m256i swap_byte_blocks(__m256i v) {
+        return _mm256_shuffle_epi32(v, 0xB1);
+    }
+
+    template<std::uint32_t B, typename std::enable_if<B == 8, bool>::type = true>
+    AVEL_FINL __m256i swap_byte_blocks(__m256i v) {
+        return _mm256_shuffle_epi32(v, 0x4E);
+    }
+
+    template<std::uint32_t B, typename std::enable_if<B == 16, bool>::type = true>
+    AVEL_FINL __m256i swap_byte_blocks(__m256i v) {
+        return _mm256_permute4x64_epi64(v, 0x4E);
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m256 swap_byte_blocks(__m256 v) {
+        return _mm256_castsi256_ps(swap_byte_blocks<B>(_mm256_castps_si256(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m256d swap_byte_blocks(__m256d v) {
+        return _mm256_castsi256_pd(swap_byte_blocks<B>(_mm256_castpd_si256(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX512F)
+
+    template<std::uint32_t B, typename std::enable_if<B == 4, bool>::type = true>
+    AVEL_FINL __m512i swap_byte_blocks(__m512i v) {
+        return _mm512_shuffle_epi32(v, _MM_PERM_CDAB);
+    }
+
+    template<std::uint32_t B, typename std::enable_if<B == 8, bool>::type = true>
+    AVEL_FINL __m512i swap_byte_blocks(__m512i v) {
+        return _mm512_shuffle_epi32(v, _MM_PERM_BADC);
+    }
+
+    template<std::uint32_t B, typename std::enable_if<B == 16, bool>::type = true>
+    AVEL_FINL __m512i swap_byte_blocks(__m512i v) {
+        return _mm512_shuffle_i32x4(v, v, 0xB1);
+    }
+
+    template<std::uint32_t B, typename std::enable_if<B == 32, bool>::type = true>
+    AVEL_FINL __m512i swap_byte_blocks(__m512i v) {
+        return _mm512_shuffle_i32x4(v, v, 0x4E);
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m512 swap_byte_blocks(__m512 v) {
+        return _mm512_castsi512_ps(swap_byte_blocks<B>(_mm512_castps_si512(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m512d swap_byte_blocks(__m512d v) {
+        return _mm512_castsi512_pd(swap_byte_blocks<B>(_mm512_castpd_si512(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_NEON)
+
+    template<std::uint32_t B, typename std::enable_if<B == 4, bool>::type = true>
+    AVEL_FINL uint8x16_t swap_byte_blocks(uint8x16_t v) {
+        return vreinterpretq_u8_u32(vrev64q_u32(vreinterpretq_u32_u8(v)));
+    }
+
+    template<std::uint32_t B, typename std::enable_if<B == 8, bool>::type = true>
+    AVEL_FINL uint8x16_t swap_byte_blocks(uint8x16_t v) {
+        return vextq_u8(v, v, 8);
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL uint32x4_t swap_byte_blocks(uint32x4_t v) {
+        return vreinterpretq_u32_u8(swap_byte_blocks<B>(vreinterpretq_u8_u32(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL int32x4_t swap_byte_blocks(int32x4_t v) {
+        return vreinterpretq_s32_u8(swap_byte_blocks<B>(vreinterpretq_u8_s32(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL uint64x2_t swap_byte_blocks(uint64x2_t v) {
+        return vreinterpretq_u64_u8(swap_byte_blocks<B>(vreinterpretq_u8_u64(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL int64x2_t swap_byte_blocks(int64x2_t v) {
+        return vreinterpretq_s64_u8(swap_byte_blocks<B>(vreinterpretq_u8_s64(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL float32x4_t swap_byte_blocks(float32x4_t v) {
+        return vreinterpretq_f32_u8(swap_byte_blocks<B>(vreinterpretq_u8_f32(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_AARCH64)
+
+    template<std::uint32_t B>
+    AVEL_FINL float64x2_t swap_byte_blocks(float64x2_t v) {
+        return vreinterpretq_f64_u8(swap_byte_blocks<B>(vreinterpretq_u8_f64(v)));
+    }
+
+    #endif
+
+    ///
+    /// Swaps each pair of adjacent groups of D lanes in v
+    ///
+    template<std::uint32_t D, class V>
+    AVEL_FINL V swap_lanes(V v) {
+        static_assert(0 < D && D < V::width, "Group size must be in the range [1, width)");
+        return V{swap_byte_blocks<D * sizeof(typename V::scalar)>(avel::decay(v))};
+    }
+
+    //=====================================================
+    // Sorting network constants
+    //=====================================================
+
+    ///
+    /// Bitmask of the lanes i in [0, w) for which (i & d) is non-zero, i.e.
+    /// the upper lane of each pair compared at distance d
+    ///
+    constexpr std::uint64_t upper_lane_bits(std::uint32_t d, std::uint32_t w, std::uint32_t i = 0) {
+        return (i == w) ? 0x00 : ((std::uint64_t((i & d) != 0) << i) | upper_lane_bits(d, w, i + 1));
+    }
+
+    ///
+    /// Bitmask of the lanes which keep the larger element during the step of
+    /// a bitonic sort that builds sorted sequences of length k by comparing
+    /// lanes at distance j. Sequences which start at odd multiples of k are
+    /// sorted in descending order so that neighbouring sequences form
+    /// bitonic sequences for the next stage
+    ///
+    constexpr std::uint64_t bitonic_upper_lane_bits(std::uint32_t k, std::uint32_t j, std::uint32_t w, std::uint32_t i = 0) {
+        return (i == w) ? 0x00 : (
+            (std::uint64_t(((i & j) != 0) != ((i & k) != 0)) << i) |
+            bitonic_upper_lane_bits(k, j, w, i + 1)
+        );
+    }
+
+    //=====================================================
+    // Sort groups
+    //=====================================================
+
+    ///
+    /// Vectors of keys and the payloads which move alongside them
+    ///
+    template<class KV, class PV>
+    struct Sort_pair {
+        KV keys;
+        PV payload;
+    };
+
+    template<class M>
+    AVEL_FINL M convert_sort_mask(M m, std::true_type) {
+        return m;
+    }
+
+    template<class M, class T, std::uint32_t N>
+    AVEL_FINL M convert_sort_mask(avel::Vector_mask<T, N> m, std::false_type) {
+        return avel::from_bits<M>(avel::to_bits(m));
+    }
+
+    ///
+    /// Converts a mask over keys into a mask over the corresponding payloads
+    ///
+    template<class M, class T, std::uint32_t N>
+    AVEL_FINL M convert_sort_mask(avel::Vector_mask<T, N> m) {
+        return convert_sort_mask<M>(m, std::is_same<M, avel::Vector_mask<T, N>>{});
+    }
+
+    template<std::uint32_t D, class T, std::uint32_t N>
+    AVEL_FINL avel::Vector<T, N> sort_swap_lanes(avel::Vector<T, N> v) {
+        return swap_lanes<D>(v);
+    }
+
+    template<std::uint32_t D, class KV, class PV>
+    AVEL_FINL Sort_pair<KV, PV> sort_swap_lanes(Sort_pair<KV, PV> v) {
+        return {swap_lanes<D>(v.keys), swap_lanes<D>(v.payload)};
+    }
+
+    // The lane-wise minimum and maximum of integers are exact, but selecting
+    // floats by comparison ensures that elements which compare equal without
+    // being identical, such as -0.0 and +0.0, are never duplicated
+
+    template<class T, std::uint32_t N>
+    AVEL_FINL void sort_minmax(avel::Vector<T, N>& a, avel::Vector<T, N>& b, std::true_type) {
+        auto t = avel::minmax(a, b);
+        a = t[0];
+        b = t[1];
+    }
+
+    template<class T, std::uint32_t N>
+    AVEL_FINL void sort_minmax(avel::Vector<T, N>& a, avel::Vector<T, N>& b, std::false_type) {
+        auto m = b < a;
+        auto lo = avel::blend(m, b, a);
+        b = avel::blend(m, a, b);
+        a = lo;
+    }
+
+    ///
+    /// Leaves the lane-wise minimum of a and b in a and the maximum in b
+    ///
+    template<class T, std::uint32_t N>
+    AVEL_FINL void sort_minmax(avel::Vector<T, N>& a, avel::Vector<T, N>& b) {
+        sort_minmax(a, b, std::is_integral<T>{});
+    }
+
+    template<class KV, class PV>
+    AVEL_FINL void sort_minmax(Sort_pair<KV, PV>& a, Sort_pair<KV, PV>& b) {
+        auto m = b.keys < a.keys;
+        auto pm = convert_sort_mask<typename PV::mask>(m);
+
+        Sort_pair<KV, PV> lo{avel::blend(m, b.keys, a.keys), avel::blend(pm, b.payload, a.payload)};
+        b = Sort_pair<KV, PV>{avel::blend(m, a.keys, b.keys), avel::blend(pm, a.payload, b.payload)};
+        a = lo;
+    }
+
+    template<std::uint32_t D, class T, std::uint32_t N>
+    AVEL_FINL avel::Vector<T, N> sort_exchange(avel::Vector<T, N> x, avel::Vector_mask<T, N> upper, std::true_type) {
+        auto p = swap_lanes<D>(x);
+        return avel::blend(upper, avel::max(x, p), avel::min(x, p));
+    }
+
+    template<std::uint32_t D, class T, std::uint32_t N>
+    AVEL_FINL avel::Vector<T, N> sort_exchange(avel::Vector<T, N> x, avel::Vector_mask<T, N> upper, std::false_type) {
+        auto p = swap_lanes<D>(x);
+
+        // A lane only takes its partner's element if it compares strictly in
+        // the required direction, so both lanes of an equal pair keep their own
+        auto lt = x < p;
+        auto gt = p < x;
+        auto take = (upper & lt) | ((!upper) & gt);
+        return avel::blend(take, p, x);
+    }
+
+    ///
+    /// Compares each lane of x with the lane D positions away. The lanes in
+    /// Upper receive the larger element of each pair, the others the smaller
+    ///
+    template<std::uint32_t D, std::uint64_t Upper, class T, std::uint32_t N>
+    AVEL_FINL avel::Vector<T, N> sort_exchange(avel::Vector<T, N> x) {
+        return sort_exchange<D>(x, avel::from_bits<avel::Vector_mask<T, N>>(Upper), std::is_integral<T>{});
+    }
+
+    template<std::uint32_t D, std::uint64_t Upper, class KV, class PV>
+    AVEL_FINL Sort_pair<KV, PV> sort_exchange(Sort_pair<KV, PV> x) {
+        auto upper = avel::from_bits<typename KV::mask>(Upper);
+        auto p = sort_swap_lanes<D>(x);
+
+        auto lt = x.keys < p.keys;
+        auto gt = p.keys < x.keys;
+        auto take = (upper & lt) | ((!upper) & gt);
+        auto payload_take = convert_sort_mask<typename PV::mask>(take);
+
+        return {avel::blend(take, p.keys, x.keys), avel::blend(payload_take, p.payload, x.payload)};
+    }
+
+    //=====================================================
+    // Sort spans
+    //=====================================================
+
+    // Spans give the sorting routines uniform access to keys alone or to
+    // keys together with their payloads
+
+    template<class K>
+    struct Key_span {
+        using key_type = K;
+        using key_vector = avel::Natural_width_vector<K>;
+        using group = key_vector;
+        using element = K;
+
+        static constexpr std::uint32_t width = key_vector::width;
+
+        K* keys;
+
+        class buffer {
+        public:
+
+            explicit buffer(std::size_t n):
+                keys(new K[n]) {}
+
+            Key_span span() {
+                return Key_span{keys.get()};
+            }
+
+        private:
+            std::unique_ptr<K[]> keys;
+        };
+
+        AVEL_FINL Key_span offset(std::size_t i) const {
+            return Key_span{keys + i};
+        }
+
+        AVEL_FINL group load(std::size_t i) const {
+            return avel::load<key_vector>(keys + i);
+        }
+
+        AVEL_FINL void store(std::size_t i, group g) const {
+            avel::store(keys + i, g);
+        }
+
+        AVEL_FINL K key(std::size_t i) const {
+            return keys[i];
+        }
+
+        AVEL_FINL element get(std::size_t i) const {
+            return keys[i];
+        }
+
+        AVEL_FINL void set(std::size_t i, element e) const {
+            keys[i] = e;
+        }
+
+        AVEL_FINL static K key_of(element e) {
+            return e;
+        }
+
+        AVEL_FINL static key_vector keys_of(group g) {
+            return g;
+        }
+
+        AVEL_FINL static std::array<element, width> elements(group g) {
+            return avel::to_array(g);
+        }
+
+    };
+
+    template<class K, class P>
+    struct Pair_span {
+        using key_type = K;
+        using key_vector = avel::Natural_width_vector<K>;
+        using payload_vector = avel::Natural_width_vector<P>;
+        using group = Sort_pair<key_vector, payload_vector>;
+        using element = std::pair<K, P>;
+
+        static constexpr std::uint32_t width = key_vector::width;
+
+        K* keys;
+        P* payload;
+
+        class buffer {
+        public:
+
+            explicit buffer(std::size_t n):
+                keys(new K[n]),
+                payload(new P[n]) {}
+
+            Pair_span span() {
+                return Pair_span{keys.get(), payload.get()};
+            }
+
+        private:
+            std::unique_ptr<K[]> keys;
+            std::unique_ptr<P[]> payload;
+        };
+
+        AVEL_FINL Pair_span offset(std::size_t i) const {
+            return Pair_span{keys + i, payload + i};
+        }
+
+        AVEL_FINL group load(std::size_t i) const {
+            return group{avel::load<key_vector>(keys + i), avel::load<payload_vector>(payload + i)};
+        }
+
+        AVEL_FINL void store(std::size_t i, group g) const {
+            avel::store(keys + i, g.keys);
+            avel::store(payload + i, g.payload);
+        }
+
+        AVEL_FINL K key(std::size_t i) const {
+            return keys[i];
+        }
+
+        AVEL_FINL element get(std::size_t i) const {
+            return element{keys[i], payload[i]};
+        }
+
+        AVEL_FINL void set(std::size_t i, element e) const {
+            keys[i] = e.first;
+            payload[i] = e.second;
+        }
+
+        AVEL_FINL static K key_of(element e) {
+            return e.first;
+        }
+
+        AVEL_FINL static key_vector keys_of(group g) {
+            return g.keys;
+        }
+
+        AVEL_FINL static std::array<element, width> elements(group g) {
+            auto k = avel::to_array(g.keys);
+            auto p = avel::to_array(g.payload);
+
+            std::array<element, width> ret{};
+            for (std::size_t i = 0; i < width; ++i) {
+                ret[i] = element{k[i], p[i]};
+            }
+            return ret;
+        }
+
+    };
+
+    template<class K>
+    constexpr std::uint32_t Key_span<K>::width;
+
+    template<class K, class P>
+    constexpr std::uint32_t Pair_span<K, P>::width;
+
+    //=====================================================
+    // In-register networks
+    //=====================================================
+
+    template<class S, std::uint32_t D>
+    AVEL_FINL typename S::group reverse_group(typename S::group x, std::false_type) {
+        return x;
+    }
+
+    template<class S, std::uint32_t D>
+    AVEL_FINL typename S::group reverse_group(typename S::group x, std::true_type) {
+        x = sort_swap_lanes<D>(x);
+        return reverse_group<S, D / 2>(x, std::integral_constant<bool, (1 < D)>{});
+    }
+
+    ///
+    /// Reverses the order of the lanes in x
+    ///
+    template<class S>
+    AVEL_FINL typename S::group reverse_group(typename S::group x) {
+        return reverse_group<S, S::width / 2>(x, std::integral_constant<bool, (1 < S::width)>{});
+    }
+
+    template<class S, std::uint32_t J>
+    AVEL_FINL typename S::group bitonic_clean(typename S::group x, std::false_type) {
+        return x;
+    }
+
+    template<class S, std::uint32_t J>
+    AVEL_FINL typename S::group bitonic_clean(typename S::group x, std::true_type) {
+        x = sort_exchange<J, upper_lane_bits(J, S::width)>(x);
+        return bitonic_clean<S, J / 2>(x, std::integral_constant<bool, (1 < J)>{});
+    }
+
+    ///
+    /// Sorts the lanes of x in ascending order given that they form a bitonic
+    /// sequence
+    ///
+    template<class S>
+    AVEL_FINL typename S::group bitonic_clean(typename S::group x) {
+        return bitonic_clean<S, S::width / 2>(x, std::integral_constant<bool, (1 < S::width)>{});
+    }
+
+    template<class S, std::uint32_t K, std::uint32_t J>
+    AVEL_FINL typename S::group sort_group_step(typename S::group x, std::false_type) {
+        return x;
+    }
+
+    template<class S, std::uint32_t K, std::uint32_t J>
+    AVEL_FINL typename S::group sort_group_step(typename S::group x, std::true_type) {
+        x = sort_exchange<J, bitonic_upper_lane_bits(K, J, S::width)>(x);
+        return sort_group_step<S, K, J / 2>(x, std::integral_constant<bool, (1 < J)>{});
+    }
+
+    template<class S, std::uint32_t K>
+    AVEL_FINL typename S::group sort_group_stage(typename S::group x, std::false_type) {
+        return x;
+    }
+
+    template<class S, std::uint32_t K>
+    AVEL_FINL typename S::group sort_group_stage(typename S::group x, std::true_type) {
+        x = sort_group_step<S, K, K / 2>(x, std::true_type{});
+        return sort_group_stage<S, 2 * K>(x, std::integral_constant<bool, (2 * K <= S::width)>{});
+    }
+
+    ///
+    /// Sorts the lanes of x in ascending order using a bitonic sorting network
+    ///
+    template<class S>
+    AVEL_FINL typename S::group sort_group(typename S::group x) {
+        return sort_group_stage<S, 2>(x, std::integral_constant<bool, (2 <= S::width)>{});
+    }
+
+    ///
+    /// Given that the lanes of a and b are each sorted, leaves the smallest
+    /// elements of both in a and the largest in b, each in sorted order
+    ///
+    template<class S>
+    AVEL_FINL void merge_groups(typename S::group& a, typename S::group& b) {
+        b = reverse_group<S>(b);
+        sort_minmax(a, b);
+        a = bitonic_clean<S>(a);
+        b = bitonic_clean<S>(b);
+    }
+
+    //=====================================================
+    // Merge sort
+    //=====================================================
+
+    template<class S>
+    void insertion_sort(S s, std::size_t n) {
+        for (std::size_t i = 1; i < n; ++i) {
+            auto e = s.get(i);
+
+            std::size_t j = i;
+            for (; j != 0 && S::key_of(e) < s.key(j - 1); --j) {
+                s.set(j, s.get(j - 1));
+            }
+            s.set(j, e);
+        }
+    }
+
+    ///
+    /// Merges the sorted runs src[a, b) and src[b, e) into dst[a, e). The
+    /// lengths of both runs must be non-zero multiples of the group width.
+    ///
+    /// The largest elements produced by each merge are carried over into the
+    /// next, while the smallest are written out. The next group of inputs is
+    /// taken from whichever run has the smaller head.
+    ///
+    template<class S>
+    void merge_runs(S src, S dst, std::size_t a, std::size_t b, std::size_t e) {
+        constexpr std::size_t w = S::width;
+
+        std::size_t i = a;
+        std::size_t j = b;
+        std::size_t o = a;
+
+        auto lo = src.load(i);
+        auto hi = src.load(j);
+        i += w;
+        j += w;
+
+        merge_groups<S>(lo, hi);
+        dst.store(o, lo);
+        o += w;
+
+        while (i < b && j < e) {
+            if (src.key(j) < src.key(i)) {
+                lo = src.load(j);
+                j += w;
+            } else {
+                lo = src.load(i);
+                i += w;
+            }
+
+            merge_groups<S>(lo, hi);
+            dst.store(o, lo);
+            o += w;
+        }
+
+        for (; i < b; i += w, o += w) {
+            lo = src.load(i);
+            merge_groups<S>(lo, hi);
+            dst.store(o, lo);
+        }
+
+        for (; j < e; j += w, o += w) {
+            lo = src.load(j);
+            merge_groups<S>(lo, hi);
+            dst.store(o, lo);
+        }
+
+        dst.store(o, hi);
+    }
+
+    ///
+    /// Merges the sorted ranges a[0, na) and b[0, nb) into dst, which must
+    /// not overlap either. Unlike merge_runs, the lengths are unrestricted.
+    ///
+    /// Groups are merged as in merge_runs until either range has less than a
+    /// full group left. The elements carried over at that point are merged
+    /// with what remains of both ranges one at a time.
+    ///
+    template<class T>
+    void merge_ranges(const T* a, std::size_t na, const T* b, std::size_t nb, T* dst) {
+        using S = Key_span<T>;
+        using vec = typename S::key_vector;
+        constexpr std::size_t w = S::width;
+
+        if (na < w || nb < w) {
+            std::merge(a, a + na, b, b + nb, dst);
+            return;
+        }
+
+        auto lo = avel::load<vec>(a);
+        auto hi = avel::load<vec>(b);
+        std::size_t i = w;
+        std::size_t j = w;
+        std::size_t o = w;
+
+        merge_groups<S>(lo, hi);
+        avel::store(dst, lo);
+
+        while (i + w <= na && j + w <= nb) {
+            if (b[j] < a[i]) {
+                lo = avel::load<vec>(b + j);
+                j += w;
+            } else {
+                lo = avel::load<vec>(a + i);
+                i += w;
+            }
+
+            merge_groups<S>(lo, hi);
+            avel::store(dst + o, lo);
+            o += w;
+        }
+
+        // The carried over elements are first merged with the range which has
+        // less than a full group left, and the result with the other range
+        auto carried = avel::to_array(hi);
+        std::array<T, 2 * w> small;
+
+        if (na - i < w) {
+            auto small_end = std::merge(carried.begin(), carried.end(), a + i, a + na, small.begin());
+            std::merge(small.begin(), small_end, b + j, b + nb, dst + o);
+        } else {
+            auto small_end = std::merge(carried.begin(), carried.end(), b + j, b + nb, small.begin());
+            std::merge(a + i, a + na, small.begin(), small_end, dst + o);
+        }
+    }
+
+    ///
+    /// Sorts the first n elements of s. buf must have room for n elements
+    ///
+    template<class S>
+    void merge_sort(S s, S buf, std::size_t n) {
+        constexpr std::size_t w = S::width;
+        const std::size_t m = n - n % w;
+
+        for (std::size_t i = 0; i < m; i += w) {
+            s.store(i, sort_group<S>(s.load(i)));
+        }
+
+        // Runs are merged back and forth between s and buf
+        S src = s;
+        S dst = buf;
+        bool in_buffer = false;
+
+        for (std::size_t run = w; run < m; run *= 2) {
+            for (std::size_t a = 0; a < m; a += 2 * run) {
+                std::size_t b = std::min(a + run, m);
+                std::size_t e = std::min(a + 2 * run, m);
+
+                if (b == e) {
+                    for (std::size_t i = a; i < e; i += w) {
+                        dst.store(i, src.load(i));
+                    }
+                } else {
+                    merge_runs(src, dst, a, b, e);
+                }
+            }
+
+            std::swap(src, dst);
+            in_buffer = !in_buffer;
+        }
+
+        if (in_buffer) {
+            for (std::size_t i = 0; i < m; i += w) {
+                s.store(i, buf.load(i));
+            }
+        }
+
+        if (m == n) {
+            return;
+        }
+
+        // The remaining elements are sorted on their own and then merged into
+        // the rest from the back
+        std::size_t t = n - m;
+        insertion_sort(s.offset(m), t);
+
+        for (std::size_t k = 0; k < t; ++k) {
+            buf.set(k, s.get(m + k));
+        }
+
+        std::size_t i = m;
+        std::size_t j = t;
+        std::size_t o = n;
+        while (j != 0) {
+            if (i != 0 && buf.key(j - 1) < s.key(i - 1)) {
+                s.set(--o, s.get(--i));
+            } else {
+                s.set(--o, buf.get(--j));
+            }
+        }
+    }
+
+    //=====================================================
+    // Partitioning
+    //=====================================================
+
+    template<class V>
+    AVEL_FINL typename V::mask compare_to_pivot(V x, V pivot, std::false_type) {
+        return x < pivot;
+    }
+
+    template<class V>
+    AVEL_FINL typename V::mask compare_to_pivot(V x, V pivot, std::true_type) {
+        return x <= pivot;
+    }
+
+    template<class T, std::uint32_t N>
+    AVEL_FINL avel::Vector<T, N> sort_partition_lanes(avel::Vector<T, N> v, avel::Vector_mask<T, N> m) {
+        return partition_lanes(v, m);
+    }
+
+    template<class KV, class PV>
+    AVEL_FINL Sort_pair<KV, PV> sort_partition_lanes(Sort_pair<KV, PV> v, typename KV::mask m) {
+        return {partition_lanes(v.keys, m), partition_lanes(v.payload, convert_sort_mask<typename PV::mask>(m))};
+    }
+
+    ///
+    /// Moves the lanes of g whose keys compare below the pivot to the front
+    /// and stores the result at both write positions. The lanes below the
+    /// pivot land at the left write position and the rest end just before
+    /// the right write position, so the only data-dependent operation is the
+    /// advancement of the write positions
+    ///
+    template<bool Inclusive, class S>
+    AVEL_FINL void scatter_by_pivot(
+        S s,
+        typename S::group g,
+        typename S::key_vector pivot,
+        std::size_t& write_l,
+        std::size_t& write_r
+    ) {
+        auto m = compare_to_pivot(S::keys_of(g), pivot, std::integral_constant<bool, Inclusive>{});
+        auto c = avel::count(m);
+        auto p = sort_partition_lanes(g, m);
+
+        s.store(write_l, p);
+        s.store(write_r - S::width, p);
+
+        write_l += c;
+        write_r -= S::width - c;
+    }
+
+    ///
+    /// Reorders the first n elements of s so that those with keys below pivot
+    /// (or not above pivot if Inclusive is true) precede all others.
+    /// n must be at least twice the group width.
+    ///
+    /// A group is read from each end before any writes occur, which keeps
+    /// room for a whole group of writes on both sides. Subsequent groups are
+    /// read from whichever side has less room left.
+    ///
+    /// \return Number of elements in the left partition
+    template<bool Inclusive, class S>
+    std::size_t partition_by_pivot(S s, std::size_t n, typename S::key_type pivot) {
+        constexpr std::size_t w = S::width;
+        const typename S::key_vector p{pivot};
+
+        auto first = s.load(0);
+        auto last = s.load(n - w);
+
+        std::size_t read_l = w;
+        std::size_t read_r = n - w;
+        std::size_t write_l = 0;
+        std::size_t write_r = n;
+
+        while (w <= read_r - read_l) {
+            typename S::group g;
+            if (read_l - write_l <= write_r - read_r) {
+                g = s.load(read_l);
+                read_l += w;
+            } else {
+                read_r -= w;
+                g = s.load(read_r);
+            }
+
+            scatter_by_pivot<Inclusive>(s, g, p, write_l, write_r);
+        }
+
+        // The last few unread elements are buffered and written out first,
+        // after which the range between the write positions can hold the two
+        // remaining groups
+        std::array<typename S::element, w> rest{};
+        const std::size_t rest_count = read_r - read_l;
+        for (std::size_t k = 0; k < rest_count; ++k) {
+            rest[k] = s.get(read_l + k);
+        }
+
+        for (std::size_t k = 0; k < rest_count; ++k) {
+            auto key = S::key_of(rest[k]);
+            if (Inclusive ? (key <= pivot) : (key < pivot)) {
+                s.set(write_l++, rest[k]);
+            } else {
+                s.set(--write_r, rest[k]);
+            }
+        }
+
+        scatter_by_pivot<Inclusive>(s, first, p, write_l, write_r);
+        scatter_by_pivot<Inclusive>(s, last, p, write_l, write_r);
+
+        return write_l;
+    }
+
+    template<class K>
+    AVEL_FINL K median_of_three(K a, K b, K c) {
+        return std::max(std::min(a, b), std::min(std::max(a, b), c));
+    }
+
+    ///
+    /// Chooses a pivot as the median of three medians of three keys
+    /// distributed evenly across the first n elements of s
+    ///
+    template<class S>
+    typename S::key_type choose_pivot(S s, std::size_t n) {
+        const std::size_t q = n / 8;
+
+        auto m0 = median_of_three(s.key(0 * q), s.key(1 * q), s.key(2 * q));
+        auto m1 = median_of_three(s.key(3 * q), s.key(4 * q), s.key(5 * q));
+        auto m2 = median_of_three(s.key(6 * q), s.key(7 * q), s.key(n - 1));
+
+        return median_of_three(m0, m1, m2);
+    }
+
+    //=====================================================
+    // Sort driver
+    //=====================================================
+
+    ///
+    /// Ranges no larger than this are merge sorted. Chosen so that the
+    /// range and its buffer fit comfortably in the L2 cache
+    ///
+    static constexpr std::size_t sort_partition_threshold = 8 * 1024;
+
+    template<class S>
+    void quick_sort(S s, std::size_t n, S buf, std::uint32_t depth) {
+        while (sort_partition_threshold < n) {
+            if (depth == 0) {
+                // Pivots have been consistently poor, so the worst-case
+                // guarantees of merge sort are taken over
+                typename S::buffer large_buf{n};
+                merge_sort(s, large_buf.span(), n);
+                return;
+            }
+            --depth;
+
+            auto pivot = choose_pivot(s, n);
+            std::size_t l = partition_by_pivot<false>(s, n, pivot);
+
+            if (l == 0) {
+                // No key is below the pivot. Keys equal to the pivot are
+                // moved to the front, where they're already in place
+                l = partition_by_pivot<true>(s, n, pivot);
+                if (l == 0) {
+                    // Only possible for unordered pivots, i.e. NaN
+                    depth = 0;
+                    continue;
+                }
+
+                s = s.offset(l);
+                n -= l;
+                continue;
+            }
+
+            // Recursing into the smaller partition bounds the stack depth
+            if (l < n - l) {
+                quick_sort(s, l, buf, depth);
+                s = s.offset(l);
+                n -= l;
+            } else {
+                quick_sort(s.offset(l), n - l, buf, depth);
+                n = l;
+            }
+        }
+
+        merge_sort(s, buf, n);
+    }
+
+    template<class S>
+    void sort_impl(S s, std::size_t n) {
+        if (n < 2) {
+            return;
+        }
+
+        typename S::buffer buf{std::min(n, sort_partition_threshold)};
+
+        std::uint32_t depth = 0;
+        for (std::size_t x = n; x > 1; x >>= 1) {
+            depth += 2;
+        }
+
+        quick_sort(s, n, buf.span(), depth);
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Sorting
+    //=====================================================
+
+    ///
+    /// Sorts the elements of view in ascending order. The sort is not stable.
+    ///
+    /// Large inputs are partitioned around pivots using vector comparisons.
+    /// Ranges which are small enough to fit in cache are merge sorted: each
+    /// vector is sorted in-register using a bitonic sorting network built on
+    /// lane-wise min/max operations, after which sorted runs are merged a
+    /// vector at a time using bitonic merging networks.
+    ///
+    /// The order of NaNs relative to other elements is unspecified.
+    ///
+    /// \param view View over 32- or 64-bit elements to sort
+    template<class T, std::size_t E, std::size_t A>
+    void sort(Vectorized_view<T, E, A> view) {
+        static_assert(!std::is_const<T>::value, "Cannot sort view over const elements");
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Only 32- and 64-bit keys are supported");
+
+        avel_impl::sort_impl(avel_impl::Key_span<T>{view.data()}, view.size());
+    }
+
+    ///
+    /// Sorts the elements of keys in ascending order, applying the same
+    /// permutation to values. The sort is not stable.
+    ///
+    /// \param keys View over 32- or 64-bit keys to sort
+    /// \param values View over payloads of the same size as the keys. Must
+    ///     have at least as many elements as keys
+    template<class K, std::size_t E0, std::size_t A0, class P, std::size_t E1, std::size_t A1>
+    void sort(Vectorized_view<K, E0, A0> keys, Vectorized_view<P, E1, A1> values) {
+        static_assert(!std::is_const<K>::value, "Cannot sort view over const elements");
+        static_assert(!std::is_const<P>::value, "Cannot sort view over const elements");
+        static_assert(sizeof(K) == 4 || sizeof(K) == 8, "Only 32- and 64-bit keys are supported");
+        static_assert(sizeof(K) == sizeof(P), "Keys and values must be of the same size");
+
+        avel_impl::sort_impl(avel_impl::Pair_span<K, P>{keys.data(), values.data()}, keys.size());
+    }
+
+}
+
+#endif //AVEL_SORT_HPP
@@ -0,0 +1,323 @@
+#ifndef AVEL_TRANSFORM_HPP
+#define AVEL_TRANSFORM_HPP
+
+namespace avel_impl {
+
+    template<std::uint32_t Unroll, class V0, class V1, class F, bool Aligned>
+    void transform_body(
+        const typename V0::scalar* in,
+        typename V1::scalar* out,
+        std::size_t n,
+        F& f,
+        std::integral_constant<bool, Aligned> aligned
+    ) {
+        constexpr std::size_t width = V0::width;
+        constexpr std::size_t block_size = Unroll * width;
+
+        std::size_t i = 0;
+        for (; i + block_size <= n; i += block_size) {
+            V0 x[Unroll];
+            for (std::uint32_t j = 0; j < Unroll; ++j) {
+                x[j] = avel::load<V0>(in + i + j * width);
+            }
+
+            V1 y[Unroll];
+            for (std::uint32_t j = 0; j < Unroll; ++j) {
+                y[j] = f(x[j]);
+            }
+
+            for (std::uint32_t j = 0; j < Unroll; ++j) {
+                body_store(out + i + j * width, y[j], aligned);
+            }
+        }
+
+        for (; i + width <= n; i += width) {
+            body_store(out + i, f(avel::load<V0>(in + i)), aligned);
+        }
+
+        if (i < n) {
+            auto count = static_cast<std::uint32_t>(n - i);
+            avel::store(out + i, f(avel::load<V0>(in + i, count)), count);
+        }
+    }
+
+    template<std::uint32_t Unroll, class V0, class V1, class V2, class F, bool Aligned>
+    void transform_body(
+        const typename V0::scalar* in0,
+        const typename V1::scalar* in1,
+        typename V2::scalar* out,
+        std::size_t n,
+        F& f,
+        std::integral_constant<bool, Aligned> aligned
+    ) {
+        constexpr std::size_t width = V0::width;
+        constexpr std::size_t block_size = Unroll * width;
+
+        std::size_t i = 0;
+        for (; i + block_size <= n; i += block_size) {
+            V0 x[Unroll];
+            V1 y[Unroll];
+            for (std::uint32_t j = 0; j < Unroll; ++j) {
+                x[j] = avel::load<V0>(in0 + i + j * width);
+                y[j] = avel::load<V1>(in1 + i + j * width);
+            }
+
+            V2 z[Unroll];
+            for (std::uint32_t j = 0; j < Unroll; ++j) {
+                z[j] = f(x[j], y[j]);
+            }
+
+            for (std::uint32_t j = 0; j < Unroll; ++j) {
+                body_store(out + i + j * width, z[j], aligned);
+            }
+        }
+
+        for (; i + width <= n; i += width) {
+            body_store(out + i, f(avel::load<V0>(in0 + i), avel::load<V1>(in1 + i)), aligned);
+        }
+
+        if (i < n) {
+            auto count = static_cast<std::uint32_t>(n - i);
+            avel::store(out + i, f(avel::load<V0>(in0 + i, count), avel::load<V1>(in1 + i, count)), count);
+        }
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Transform
+    //=====================================================
+
+    ///
+    /// Writes the result of invoking f on each chunk of input to the
+    /// corresponding chunk of output.
+    ///
+    /// Leading elements are peeled off so that the remainder of output may be
+    /// written using aligned stores. Unroll vectors are then loaded,
+    /// transformed, and stored per iteration of the main loop. The head and
+    /// any remaining elements are handled using partial loads and stores,
+    /// which use masked loads and stores where available. The
+    /// inactive lanes of the final vector passed to f are zeroed, so f should
+    /// not have side effects which depend on their contents.
+    ///
+    /// \tparam Unroll Number of vectors processed per iteration of main loop
+    /// \param input View over elements to transform
+    /// \param output View to write results to. Must have at least as many
+    ///     elements as input. May alias input exactly
+    /// \param f Callable which takes input's vector_type and returns
+    ///     output's vector_type
+    template<
+        std::uint32_t Unroll = 4,
+        class T0, std::size_t E0, std::size_t A0,
+        class T1, std::size_t E1, std::size_t A1,
+        class F
+    >
+    void transform(
+        Vectorized_view<T0, E0, A0> input,
+        Vectorized_view<T1, E1, A1> output,
+        F f
+    ) {
+        using vec0 = typename Vectorized_view<T0, E0, A0>::vector_type;
+        using vec1 = typename Vectorized_view<T1, E1, A1>::vector_type;
+
+        static_assert(0 < Unroll, "Unroll factor must be at least 1");
+        static_assert(!std::is_const<T1>::value, "Cannot write to view over const elements");
+        static_assert(vec0::width == vec1::width, "Input and output vectors must have the same width");
+
+        const typename vec0::scalar* in = input.data();
+        typename vec1::scalar* out = output.data();
+        const std::size_t n = input.size();
+
+        auto peel = avel_impl::peel<vec1, A1>(out, n);
+        if (!peel.aligned) {
+            avel_impl::transform_body<Unroll, vec0, vec1>(in, out, n, f, std::false_type{});
+            return;
+        }
+
+        if (peel.head != 0) {
+            auto count = static_cast<std::uint32_t>(peel.head);
+            store(out, f(load<vec0>(in, count)), count);
+        }
+
+        avel_impl::transform_body<Unroll, vec0, vec1>(in + peel.head, out + peel.head, n - peel.head, f, std::true_type{});
+    }
+
+    ///
+    /// Writes the result of invoking f on each pair of corresponding chunks
+    /// in input0 and input1 to the corresponding chunk of output.
+    ///
+    /// \tparam Unroll Number of vectors processed per iteration of main loop
+    /// \param input0 View over elements to pass as first argument to f
+    /// \param input1 View over elements to pass as second argument to f. Must
+    ///     have at least as many elements as input0
+    /// \param output View to write results to. Must have at least as many
+    ///     elements as input0. May alias either input exactly
+    /// \param f Callable which takes input0's and input1's vector_types and
+    ///     returns output's vector_type
+    template<
+        std::uint32_t Unroll = 4,
+        class T0, std::size_t E0, std::size_t A0,
+        class T1, std::size_t E1, std::size_t A1,
+        class T2, std::size_t E2, std::size_t A2,
+        class F
+    >
+    void transform(
+        Vectorized_view<T0, E0, A0> input0,
+        Vectorized_view<T1, E1, A1> input1,
+        Vectorized_view<T2, E2, A2> output,
+        F f
+    ) {
+        using vec0 = typename Vectorized_view<T0, E0, A0>::vector_type;
+        using vec1 = typename Vectorized_view<T1, E1, A1>::vector_type;
+        using vec2 = typename Vectorized_view<T2, E2, A2>::vector_type;
+
+        static_assert(0 < Unroll, "Unroll factor must be at least 1");
+        static_assert(!std::is_const<T2>::value, "Cannot write to view over const elements");
+        static_assert(
+            vec0::width == vec1::width && vec1::width == vec2::width,
+            "Input and output vectors must have the same width"
+        );
+
+        const typename vec0::scalar* in0 = input0.data();
+        const typename vec1::scalar* in1 = input1.data();
+        typename vec2::scalar* out = output.data();
+        const std::size_t n = input0.size();
+
+        auto peel = avel_impl::peel<vec2, A2>(out, n);
+        if (!peel.aligned) {
+            avel_impl::transform_body<Unroll, vec0, vec1, vec2>(in0, in1, out, n, f, std::false_type{});
+            return;
+        }
+
+        if (peel.head != 0) {
+            auto count = static_cast<std::uint32_t>(peel.head);
+            store(out, f(load<vec0>(in0, count), load<vec1>(in1, count)), count);
+        }
+
+        avel_impl::transform_body<Unroll, vec0, vec1, vec2>(
+            in0 + peel.head,
+            in1 + peel.head,
+            out + peel.head,
+            n - peel.head,
+            f,
+            std::true_type{}
+        );
+    }
+
+    //=====================================================
+    // Streaming transform
+    //=====================================================
+
+    ///
+    /// Equivalent to transform(input, output, f), except that if the output
+    /// is at least AVEL_STREAMING_THRESHOLD bytes in size, it is written using
+    /// non-temporal stores. This keeps large outputs which will not be read
+    /// again soon from evicting other data from the cache.
+    ///
+    /// Elements before the first address in output that is suitably aligned
+    /// for a non-temporal store, and those after the last full vector, are
+    /// written using ordinary stores. stream_fence() is called before
+    /// returning.
+    ///
+    /// \param input View over elements to transform
+    /// \param output View to write results to. Must have at least as many
+    ///     elements as input. May alias input exactly
+    /// \param f Callable which takes input's vector_type and returns
+    ///     output's vector_type
+    template<
+        class T0, std::size_t E0, std::size_t A0,
+        class T1, std::size_t E1, std::size_t A1,
+        class F
+    >
+    void stream_transform(
+        Vectorized_view<T0, E0, A0> input,
+        Vectorized_view<T1, E1, A1> output,
+        F f
+    ) {
+        using vec0 = typename Vectorized_view<T0, E0, A0>::vector_type;
+        using vec1 = typename Vectorized_view<T1, E1, A1>::vector_type;
+        constexpr std::size_t width = vec0::width;
+
+        const typename vec0::scalar* in = input.data();
+        typename vec1::scalar* out = output.data();
+        const std::size_t n = input.size();
+
+        auto peel = avel_impl::peel<vec1, A1>(out, n);
+        if (n * sizeof(*out) < AVEL_STREAMING_THRESHOLD || !peel.aligned) {
+            transform(input, output, f);
+            return;
+        }
+
+        const std::size_t head = peel.head;
+
+        transform(input.first(head), output.first(head), f);
+
+        std::size_t i = head;
+        for (; i + width <= n; i += width) {
+            stream_store(out + i, f(load<vec0>(in + i)));
+        }
+
+        transform(input.subview(i), output.subview(i), f);
+
+        stream_fence();
+    }
+
+    ///
+    /// Equivalent to transform(input0, input1, output, f), except that if the
+    /// output is at least AVEL_STREAMING_THRESHOLD bytes in size, it is
+    /// written using non-temporal stores.
+    ///
+    /// \param input0 View over elements to pass as first argument to f
+    /// \param input1 View over elements to pass as second argument to f. Must
+    ///     have at least as many elements as input0
+    /// \param output View to write results to. Must have at least as many
+    ///     elements as input0. May alias either input exactly
+    /// \param f Callable which takes input0's and input1's vector_types and
+    ///     returns output's vector_type
+    template<
+        class T0, std::size_t E0, std::size_t A0,
+        class T1, std::size_t E1, std::size_t A1,
+        class T2, std::size_t E2, std::size_t A2,
+        class F
+    >
+    void stream_transform(
+        Vectorized_view<T0, E0, A0> input0,
+        Vectorized_view<T1, E1, A1> input1,
+        Vectorized_view<T2, E2, A2> output,
+        F f
+    ) {
+        using vec0 = typename Vectorized_view<T0, E0, A0>::vector_type;
+        using vec1 = typename Vectorized_view<T1, E1, A1>::vector_type;
+        using vec2 = typename Vectorized_view<T2, E2, A2>::vector_type;
+        constexpr std::size_t width = vec0::width;
+
+        const typename vec0::scalar* in0 = input0.data();
+        const typename vec1::scalar* in1 = input1.data();
+        typename vec2::scalar* out = output.data();
+        const std::size_t n = input0.size();
+
+        auto peel = avel_impl::peel<vec2, A2>(out, n);
+        if (n * sizeof(*out) < AVEL_STREAMING_THRESHOLD || !peel.aligned) {
+            transform(input0, input1, output, f);
+            return;
+        }
+
+        const std::size_t head = peel.head;
+
+        transform(input0.first(head), input1.first(head), output.first(head), f);
+
+        std::size_t i = head;
+        for (; i + width <= n; i += width) {
+            stream_store(out + i, f(load<vec0>(in0 + i), load<vec1>(in1 + i)));
+        }
+
+        transform(input0.subview(i), input1.subview(i), output.subview(i), f);
+
+        stream_fence();
+    }
+
+}
+
+#endif //AVEL_TRANSFORM_HPP
@@ -0,0 +1,625 @@
+#ifndef AVEL_UNICODE_HPP
+#define AVEL_UNICODE_HPP
+
+namespace avel {
+
+    ///
+    /// Outcome of a transcoding operation
+    ///
+    struct Transcode_result {
+
+        /// Number of input code units consumed. Less than the size of the
+        /// input only if the input was invalid, in which case it is the offset
+        /// of the first invalid sequence
+        std::size_t read;
+
+        /// Number of output code units written
+        std::size_t written;
+
+    };
+
+}
+
+namespace avel_impl {
+
+    //=====================================================
+    // Scalar UTF-8 decoding
+    //=====================================================
+
+    AVEL_FINL bool is_utf8_continuation(std::uint8_t x) {
+        return (x & 0xC0) == 0x80;
+    }
+
+    ///
+    /// Decodes the UTF-8 sequence at the start of ptr.
+    ///
+    /// \param ptr Pointer to first byte of sequence
+    /// \param n Number of bytes readable from ptr. Must be non-zero
+    /// \param code_point Set to the decoded code point if the sequence is
+    ///     valid
+    /// \return Length of sequence in bytes, or 0 if it is invalid or truncated
+    inline std::size_t decode_utf8(const std::uint8_t* ptr, std::size_t n, std::uint32_t& code_point) {
+        const std::uint8_t b0 = ptr[0];
+
+        if (b0 < 0x80) {
+            code_point = b0;
+            return 1;
+        }
+
+        // Bounds on the second byte exclude overlong encodings, surrogates,
+        // and code points above U+10FFFF
+        std::size_t length = 0;
+        std::uint8_t lo = 0x80;
+        std::uint8_t hi = 0xBF;
+
+        if (0xC2 <= b0 && b0 <= 0xDF) {
+            length = 2;
+            code_point = b0 & 0x1F;
+        } else if (0xE0 <= b0 && b0 <= 0xEF) {
+            length = 3;
+            code_point = b0 & 0x0F;
+            lo = (b0 == 0xE0) ? 0xA0 : 0x80;
+            hi = (b0 == 0xED) ? 0x9F : 0xBF;
+        } else if (0xF0 <= b0 && b0 <= 0xF4) {
+            length = 4;
+            code_point = b0 & 0x07;
+            lo = (b0 == 0xF0) ? 0x90 : 0x80;
+            hi = (b0 == 0xF4) ? 0x8F : 0xBF;
+        } else {
+            return 0;
+        }
+
+        if (n < length || ptr[1] < lo || hi < ptr[1]) {
+            return 0;
+        }
+
+        code_point = (code_point << 6) | (ptr[1] & 0x3F);
+        for (std::size_t i = 2; i < length; ++i) {
+            if (!is_utf8_continuation(ptr[i])) {
+                return 0;
+            }
+            code_point = (code_point << 6) | (ptr[i] & 0x3F);
+        }
+
+        return length;
+    }
+
+    ///
+    /// \return Offset of first invalid sequence in ptr at or after start, or n
+    ///     if there is none
+    inline std::size_t validate_utf8_scalar(const std::uint8_t* ptr, std::size_t n, std::size_t start) {
+        std::size_t i = start;
+        while (i < n) {
+            std::uint32_t code_point;
+            auto length = decode_utf8(ptr + i, n - i, code_point);
+            if (length == 0) {
+                return i;
+            }
+            i += length;
+        }
+
+        return n;
+    }
+
+    ///
+    /// Finds the first invalid sequence given that some sequence beginning
+    /// before ptr + i + width is known to be invalid, and that all sequences
+    /// ending before ptr + i are known to be valid
+    inline std::size_t locate_utf8_error(const std::uint8_t* ptr, std::size_t n, std::size_t i) {
+        // Back up to the lead byte of any sequence which straddles i
+        std::size_t start = i;
+        std::size_t j = i;
+        while (j != 0 && i - j < 3 && is_utf8_continuation(ptr[j - 1])) {
+            --j;
+        }
+
+        if (j != 0 && ptr[j - 1] >= 0xC0) {
+            start = j - 1;
+        }
+
+        return validate_utf8_scalar(ptr, n, start);
+    }
+
+    ///
+    /// Encodes a code point as UTF-16
+    ///
+    /// \return Number of code units written to out
+    AVEL_FINL std::size_t encode_utf16(std::uint32_t code_point, std::uint16_t* out) {
+        if (code_point < 0x10000) {
+            out[0] = static_cast<std::uint16_t>(code_point);
+            return 1;
+        }
+
+        code_point -= 0x10000;
+        out[0] = static_cast<std::uint16_t>(0xD800 | (code_point >> 10));
+        out[1] = static_cast<std::uint16_t>(0xDC00 | (code_point & 0x3FF));
+        return 2;
+    }
+
+    ///
+    /// Decodes the UTF-16 sequence at the start of ptr and encodes it as UTF-8
+    ///
+    /// \param n Number of code units readable from ptr. Must be non-zero
+    /// \return Number of code units consumed, or 0 if the sequence is an
+    ///     unpaired surrogate
+    inline std::size_t transcode_utf16_sequence(const std::uint16_t* ptr, std::size_t n, std::uint8_t* out, std::size_t& written) {
+        std::uint32_t code_point = ptr[0];
+        std::size_t consumed = 1;
+
+        if (0xD800 <= code_point && code_point <= 0xDFFF) {
+            if (code_point >= 0xDC00 || n < 2 || ptr[1] < 0xDC00 || 0xDFFF < ptr[1]) {
+                return 0;
+            }
+
+            code_point = 0x10000 + (((code_point & 0x3FF) << 10) | (ptr[1] & 0x3FF));
+            consumed = 2;
+        }
+
+        if (code_point < 0x80) {
+            out[0] = static_cast<std::uint8_t>(code_point);
+            written = 1;
+        } else if (code_point < 0x800) {
+            out[0] = static_cast<std::uint8_t>(0xC0 | (code_point >> 6));
+            out[1] = static_cast<std::uint8_t>(0x80 | (code_point & 0x3F));
+            written = 2;
+        } else if (code_point < 0x10000) {
+            out[0] = static_cast<std::uint8_t>(0xE0 | (code_point >> 12));
+            out[1] = static_cast<std::uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+            out[2] = static_cast<std::uint8_t>(0x80 | (code_point & 0x3F));
+            written = 3;
+        } else {
+            out[0] = static_cast<std::uint8_t>(0xF0 | (code_point >> 18));
+            out[1] = static_cast<std::uint8_t>(0x80 | ((code_point >> 12) & 0x3F));
+            out[2] = static_cast<std::uint8_t>(0x80 | ((code_point >> 6) & 0x3F));
+            out[3] = static_cast<std::uint8_t>(0x80 | (code_point & 0x3F));
+            written = 4;
+        }
+
+        return consumed;
+    }
+
+    //=====================================================
+    // ASCII widening and narrowing
+    //=====================================================
+
+    // Stores the lanes of a vector of bytes as 16-bit code units, and vice
+    // versa. Narrowing is only used on lanes known to be ASCII, so saturation
+    // does not matter
+
+    template<std::uint32_t N>
+    AVEL_FINL void widen_store(std::uint16_t* out, avel::Vector<std::uint8_t, N> v) {
+        auto lanes = avel::to_array(v);
+        for (std::size_t i = 0; i < N; ++i) {
+            out[i] = lanes[i];
+        }
+    }
+
+    template<std::uint32_t N>
+    AVEL_FINL void narrow_store(std::uint8_t* out, avel::Vector<std::uint16_t, N> v) {
+        auto lanes = avel::to_array(v);
+        for (std::size_t i = 0; i < N; ++i) {
+            out[i] = static_cast<std::uint8_t>(lanes[i]);
+        }
+    }
+
+    #if defined(AVEL_SSE2)
+
+    AVEL_FINL void widen_store(std::uint16_t* out, avel::vec16x8u v) {
+        auto zeros = _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0), _mm_unpacklo_epi8(decay(v), zeros));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(decay(v), zeros));
+    }
+
+    AVEL_FINL void narrow_store(std::uint8_t* out, avel::vec8x16u v) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(decay(v), decay(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX2)
+
+    AVEL_FINL void widen_store(std::uint16_t* out, avel::vec32x8u v) {
+        auto lo = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(decay(v)));
+        auto hi = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(decay(v), 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x00), lo);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0x10), hi);
+    }
+
+    AVEL_FINL void narrow_store(std::uint8_t* out, avel::vec16x16u v) {
+        auto lo = _mm256_castsi256_si128(decay(v));
+        auto hi = _mm256_extracti128_si256(decay(v), 1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(lo, hi));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX512BW)
+
+    AVEL_FINL void widen_store(std::uint16_t* out, avel::vec64x8u v) {
+        auto lo = _mm512_cvtepu8_epi16(_mm512_castsi512_si256(decay(v)));
+        auto hi = _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(decay(v), 1));
+        _mm512_storeu_si512(out + 0x00, lo);
+        _mm512_storeu_si512(out + 0x20, hi);
+    }
+
+    AVEL_FINL void narrow_store(std::uint8_t* out, avel::vec32x16u v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm512_cvtepi16_epi8(decay(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_NEON)
+
+    AVEL_FINL void widen_store(std::uint16_t* out, avel::vec16x8u v) {
+        vst1q_u16(out + 0, vmovl_u8(vget_low_u8(decay(v))));
+        vst1q_u16(out + 8, vmovl_u8(vget_high_u8(decay(v))));
+    }
+
+    AVEL_FINL void narrow_store(std::uint8_t* out, avel::vec8x16u v) {
+        vst1_u8(out, vmovn_u16(decay(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_SSE2) || defined(AVEL_NEON)
+
+    //=====================================================
+    // Vectorized UTF-8 validation
+    //=====================================================
+
+    // Each byte is classified according to the high nibble of the preceding
+    // byte, the low nibble of the preceding byte, and the high nibble of the
+    // byte itself. Each of the following bits marks a class of error, and a
+    // pair of bytes is erroneous if all three lookups agree on some error
+
+    constexpr std::uint8_t utf8_too_short      = 1 << 0;
+    constexpr std::uint8_t utf8_too_long       = 1 << 1;
+    constexpr std::uint8_t utf8_overlong_3     = 1 << 2;
+    constexpr std::uint8_t utf8_too_large      = 1 << 3;
+    constexpr std::uint8_t utf8_surrogate      = 1 << 4;
+    constexpr std::uint8_t utf8_overlong_2     = 1 << 5;
+    constexpr std::uint8_t utf8_too_large_1000 = 1 << 6;
+    constexpr std::uint8_t utf8_overlong_4     = 1 << 6;
+    constexpr std::uint8_t utf8_two_conts      = 1 << 7;
+
+    constexpr std::uint8_t utf8_carry = utf8_too_short | utf8_too_long | utf8_two_conts;
+
+    ///
+    /// \param ptr Pointer to block of bytes. The three bytes preceding ptr must
+    ///     be readable
+    /// \return Vector which is non-zero in lanes where the byte, in
+    ///     combination with the three bytes preceding it, is not valid UTF-8
+    template<class V>
+    AVEL_FINL V utf8_block_errors(const std::uint8_t* ptr) {
+        using avel::vec16x8u;
+        using avel::arr16x8u;
+
+        const vec16x8u prev_high_table{arr16x8u{
+            // 0___ ASCII
+            utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long,
+            utf8_too_long, utf8_too_long, utf8_too_long, utf8_too_long,
+            // 10__ Continuation
+            utf8_two_conts, utf8_two_conts, utf8_two_conts, utf8_two_conts,
+            // 1100 Two-byte lead
+            utf8_too_short | utf8_overlong_2,
+            // 1101 Two-byte lead
+            utf8_too_short,
+            // 1110 Three-byte lead
+            utf8_too_short | utf8_overlong_3 | utf8_surrogate,
+            // 1111 Four-byte lead
+            utf8_too_short | utf8_too_large | utf8_too_large_1000 | utf8_overlong_4
+        }};
+
+        const vec16x8u prev_low_table{arr16x8u{
+            utf8_carry | utf8_overlong_3 | utf8_overlong_2 | utf8_overlong_4,
+            utf8_carry | utf8_overlong_2,
+            utf8_carry,
+            utf8_carry,
+            utf8_carry | utf8_too_large,
+            utf8_carry | utf8_too_large | utf8_too_large_1000,
+            utf8_carry | utf8_too_large | utf8_too_large_1000,
+            utf8_carry | utf8_too_large | utf8_too_large_1000,
+            utf8_carry | utf8_too_large | utf8_too_large_1000,
+            utf8_carry | utf8_too_large | utf8_too_large_1000,
+            utf8_carry | utf8_too_large | utf8_too_large_1000,
+            utf8_carry | utf8_too_large | utf8_too_large_1000,
+            utf8_carry | utf8_too_large | utf8_too_large_1000,
+            utf8_carry | utf8_too_large | utf8_too_large_1000 | utf8_surrogate,
+            utf8_carry | utf8_too_large | utf8_too_large_1000,
+            utf8_carry | utf8_too_large | utf8_too_large_1000
+        }};
+
+        const vec16x8u high_table{arr16x8u{
+            // 0___ ASCII
+            utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short,
+            utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short,
+            // 1000 Continuation
+            utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large_1000 | utf8_overlong_4,
+            // 1001 Continuation
+            utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large,
+            // 101_ Continuation
+            utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+            utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+            // 11__ Lead
+            utf8_too_short, utf8_too_short, utf8_too_short, utf8_too_short
+        }};
+
+        const V low_nibble{0x0F};
+
+        V input = avel::load<V>(ptr - 0);
+        V prev1 = avel::load<V>(ptr - 1);
+        V prev2 = avel::load<V>(ptr - 2);
+        V prev3 = avel::load<V>(ptr - 3);
+
+        V special =
+            lookup16(prev_high_table, prev1 >> 4) &
+            lookup16(prev_low_table, prev1 & low_nibble) &
+            lookup16(high_table, input >> 4);
+
+        // The third and fourth bytes of multi-byte sequences must be
+        // continuation bytes, which the lookups above don't account for
+        auto must_be_continuation = (prev2 >= V{0xE0}) | (prev3 >= V{0xF0});
+
+        return keep(must_be_continuation, V{0x80}) ^ special;
+    }
+
+    ///
+    /// Checks bytes [i, i + n) of ptr after copying them into a zero-padded
+    /// buffer, so that neither the bytes preceding i nor those following
+    /// i + n need to be readable
+    ///
+    /// \return True if the bytes contain an error
+    template<class V>
+    AVEL_FINL bool utf8_buffered_block_has_errors(const std::uint8_t* ptr, std::size_t i, std::size_t n) {
+        std::uint8_t buffer[3 + V::width]{};
+
+        for (std::size_t j = 0; j < 3; ++j) {
+            if (i + j >= 3) {
+                buffer[j] = ptr[i + j - 3];
+            }
+        }
+
+        if (n != 0) {
+            std::memcpy(buffer + 3, ptr + i, n);
+        }
+
+        return any(utf8_block_errors<V>(buffer + 3));
+    }
+
+    template<class V>
+    std::size_t validate_utf8(const std::uint8_t* ptr, std::size_t n) {
+        constexpr std::size_t width = V::width;
+
+        const V high_bit{0x80};
+
+        std::size_t i = 0;
+        if (n >= width) {
+            if (utf8_buffered_block_has_errors<V>(ptr, 0, width)) {
+                return locate_utf8_error(ptr, n, 0);
+            }
+            i = width;
+        }
+
+        for (; i + width <= n; i += width) {
+            V input = avel::load<V>(ptr + i);
+
+            if (none(input >= high_bit)) {
+                // ASCII blocks are valid unless they cut short a multi-byte
+                // sequence in the preceding block
+                if (ptr[i - 1] >= 0xC0 || ptr[i - 2] >= 0xE0 || ptr[i - 3] >= 0xF0) {
+                    return locate_utf8_error(ptr, n, i);
+                }
+                continue;
+            }
+
+            if (any(utf8_block_errors<V>(ptr + i))) {
+                return locate_utf8_error(ptr, n, i);
+            }
+        }
+
+        // The zeros following the final bytes reveal truncated sequences, so
+        // this check is necessary even if no bytes remain
+        if (utf8_buffered_block_has_errors<V>(ptr, i, n - i)) {
+            return locate_utf8_error(ptr, n, i);
+        }
+
+        return n;
+    }
+
+    #endif
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // UTF-8 validation
+    //=====================================================
+
+    ///
+    /// Validates that view contains well-formed UTF-8. Overlong encodings,
+    /// surrogates, code points above U+10FFFF, and truncated sequences are
+    /// all rejected.
+    ///
+    /// Each byte is classified by looking up the nibbles of it and the byte
+    /// preceding it in 16-entry tables, which detects all errors other than
+    /// missing third and fourth bytes. Blocks consisting entirely of ASCII
+    /// skip classification. Once a block containing an error is found, the
+    /// exact position of the error is located using a scalar decoder.
+    ///
+    /// \param view View over bytes to validate
+    /// \return Offset of the first byte of the first invalid sequence, or
+    ///     view.size() if view is valid
+    template<std::size_t E, std::size_t A>
+    std::size_t validate_utf8(Vectorized_view<const std::uint8_t, E, A> view) {
+        #if defined(AVEL_SSE2) || defined(AVEL_NEON)
+        return avel_impl::validate_utf8<Natural_width_vector<std::uint8_t>>(view.data(), view.size());
+
+        #else
+        return avel_impl::validate_utf8_scalar(view.data(), view.size(), 0);
+
+        #endif
+    }
+
+    //=====================================================
+    // UTF-8/UTF-16 transcoding
+    //=====================================================
+
+    ///
+    /// \param view View over valid UTF-8
+    /// \return Number of UTF-16 code units required to represent view
+    template<std::size_t E, std::size_t A>
+    std::size_t utf16_length_from_utf8(Vectorized_view<const std::uint8_t, E, A> view) {
+        using vec = Natural_width_vector<std::uint8_t>;
+
+        // Each sequence begins with a byte that isn't a continuation byte, and
+        // four-byte sequences require a surrogate pair
+        auto leads = count_if(view, [] (vec v) {
+            return (v & vec{0xC0}) != vec{0x80};
+        });
+
+        auto four_byte_leads = count_if(view, [] (vec v) {
+            return v >= vec{0xF0};
+        });
+
+        return leads + four_byte_leads;
+    }
+
+    ///
+    /// \param view View over valid UTF-16
+    /// \return Number of UTF-8 bytes required to represent view
+    template<std::size_t E, std::size_t A>
+    std::size_t utf8_length_from_utf16(Vectorized_view<const std::uint16_t, E, A> view) {
+        using vec = Natural_width_vector<std::uint16_t>;
+
+        // Code units below U+80 take one byte, those below U+800 two, and
+        // others three. Surrogates take two bytes each for a total of four
+        // per pair
+        auto at_least_two = count_if(view, [] (vec v) {
+            return v >= vec{0x80};
+        });
+
+        auto at_least_three = count_if(view, [] (vec v) {
+            return v >= vec{0x800};
+        });
+
+        auto surrogates = count_if(view, [] (vec v) {
+            return (v & vec{0xF800}) == vec{0xD800};
+        });
+
+        return view.size() + at_least_two + at_least_three - surrogates;
+    }
+
+    ///
+    /// Converts UTF-8 to UTF-16, validating the input as it's read.
+    ///
+    /// Blocks of ASCII are widened using vector instructions, while blocks
+    /// containing multi-byte sequences are decoded one code point at a time.
+    ///
+    /// \param in View over UTF-8 to convert
+    /// \param out View to write code units to. Must have room for at least
+    ///     utf16_length_from_utf8(in) code units
+    /// \return Transcode_result describing how much of in was converted. If
+    ///     in is invalid, conversion stops at the first invalid sequence
+    template<std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    Transcode_result utf8_to_utf16(
+        Vectorized_view<const std::uint8_t, E0, A0> in,
+        Vectorized_view<std::uint16_t, E1, A1> out
+    ) {
+        using vec = Natural_width_vector<std::uint8_t>;
+        constexpr std::size_t width = vec::width;
+
+        const std::uint8_t* src = in.data();
+        std::uint16_t* dst = out.data();
+        const std::size_t n = in.size();
+
+        const vec high_bit{0x80};
+
+        std::size_t i = 0;
+        std::size_t o = 0;
+        while (i < n) {
+            if (i + width <= n) {
+                auto input = load<vec>(src + i);
+                if (none(input >= high_bit)) {
+                    avel_impl::widen_store(dst + o, input);
+                    i += width;
+                    o += width;
+                    continue;
+                }
+            }
+
+            // Decode sequences until the end of the block, possibly finishing
+            // slightly past it
+            const std::size_t block_end = std::min(n, i + width);
+            while (i < block_end) {
+                std::uint32_t code_point;
+                auto length = avel_impl::decode_utf8(src + i, n - i, code_point);
+                if (length == 0) {
+                    return {i, o};
+                }
+
+                i += length;
+                o += avel_impl::encode_utf16(code_point, dst + o);
+            }
+        }
+
+        return {i, o};
+    }
+
+    ///
+    /// Converts UTF-16 to UTF-8, validating the input as it's read.
+    ///
+    /// Blocks of ASCII are narrowed using vector instructions, while blocks
+    /// containing other code points are encoded one code point at a time.
+    ///
+    /// \param in View over UTF-16 to convert, in native byte order
+    /// \param out View to write bytes to. Must have room for at least
+    ///     utf8_length_from_utf16(in) bytes
+    /// \return Transcode_result describing how much of in was converted. If
+    ///     in contains an unpaired surrogate, conversion stops there
+    template<std::size_t E0, std::size_t A0, std::size_t E1, std::size_t A1>
+    Transcode_result utf16_to_utf8(
+        Vectorized_view<const std::uint16_t, E0, A0> in,
+        Vectorized_view<std::uint8_t, E1, A1> out
+    ) {
+        using vec = Natural_width_vector<std::uint16_t>;
+        constexpr std::size_t width = vec::width;
+
+        const std::uint16_t* src = in.data();
+        std::uint8_t* dst = out.data();
+        const std::size_t n = in.size();
+
+        const vec ascii_limit{0x80};
+
+        std::size_t i = 0;
+        std::size_t o = 0;
+        while (i < n) {
+            if (i + width <= n) {
+                auto input = load<vec>(src + i);
+                if (none(input >= ascii_limit)) {
+                    avel_impl::narrow_store(dst + o, input);
+                    i += width;
+                    o += width;
+                    continue;
+                }
+            }
+
+            const std::size_t block_end = std::min(n, i + width);
+            while (i < block_end) {
+                std::size_t written = 0;
+                auto consumed = avel_impl::transcode_utf16_sequence(src + i, n - i, dst + o, written);
+                if (consumed == 0) {
+                    return {i, o};
+                }
+
+                i += consumed;
+                o += written;
+            }
+        }
+
+        return {i, o};
+    }
+
+}
+
+#endif //AVEL_UNICODE_HPP
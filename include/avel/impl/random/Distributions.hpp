@@ -0,0 +1,254 @@
+#ifndef AVEL_DISTRIBUTIONS_HPP
+#define AVEL_DISTRIBUTIONS_HPP
+
+namespace avel_impl {
+
+    ///
+    /// \param bits Vector of random bits. Only the upper 23 bits of each lane
+    ///     are used
+    /// \return Value in [1, 2) for each lane
+    ///
+    template<std::uint32_t N>
+    AVEL_FINL avel::Vector<float, N> unit_interval_plus_one(avel::Vector<std::uint32_t, N> bits) {
+        using vec = avel::Vector<std::uint32_t, N>;
+        return avel::bit_cast<avel::Vector<float, N>>((bits >> 9) | vec{0x3F800000});
+    }
+
+    ///
+    /// Natural logarithm of each lane of x. Based on Cephes' logf
+    ///
+    /// \param x Vector of normal, positive, finite values
+    ///
+    template<std::uint32_t N>
+    AVEL_FINL avel::Vector<float, N> log_positive(avel::Vector<float, N> x) {
+        using vec = avel::Vector<std::uint32_t, N>;
+        using vecf = avel::Vector<float, N>;
+
+        auto bits = avel::bit_cast<vec>(x);
+
+        // Splits x into a mantissa in [0.5, 1) and an exponent, the latter
+        // being converted to a float by placing it in the mantissa of 2^23
+        auto m = avel::bit_cast<vecf>((bits & vec{0x007FFFFF}) | vec{0x3F000000});
+        auto e = avel::bit_cast<vecf>((bits >> 23) | vec{0x4B000000}) - vecf{8388608.0f + 126.0f};
+
+        auto is_small = m < vecf{0.707106781186547524f};
+        e = blend(is_small, e - vecf{1.0f}, e);
+        auto t = blend(is_small, m + m, m) - vecf{1.0f};
+
+        auto t2 = t * t;
+        auto p = vecf{7.0376836292e-2f};
+        p = p * t - vecf{1.1514610310e-1f};
+        p = p * t + vecf{1.1676998740e-1f};
+        p = p * t - vecf{1.2420140846e-1f};
+        p = p * t + vecf{1.4249322787e-1f};
+        p = p * t - vecf{1.6668057665e-1f};
+        p = p * t + vecf{2.0000714765e-1f};
+        p = p * t - vecf{2.4999993993e-1f};
+        p = p * t + vecf{3.3333331174e-1f};
+
+        auto z = p * t * t2;
+        z = z + e * vecf{-2.12194440e-4f};
+        z = z - vecf{0.5f} * t2;
+
+        return t + z + e * vecf{0.693359375f};
+    }
+
+    ///
+    /// Computes the sine and cosine of an angle uniformly distributed over
+    /// a full turn. The top two bits of each lane select a quadrant and the
+    /// remaining bits an offset within it, so no range reduction is needed.
+    /// The angles are offset by an eighth of a turn relative to the bits,
+    /// which doesn't affect the distribution.
+    ///
+    /// \param bits Vector of random bits
+    /// \param sine Set to the sine of each lane's angle
+    /// \return The cosine of each lane's angle
+    ///
+    template<std::uint32_t N>
+    AVEL_FINL avel::Vector<float, N> random_sincos(avel::Vector<std::uint32_t, N> bits, avel::Vector<float, N>& sine) {
+        using vec = avel::Vector<std::uint32_t, N>;
+        using vecf = avel::Vector<float, N>;
+
+        auto quadrant = bits >> 30;
+        auto offset = unit_interval_plus_one(bits << 2) - vecf{1.5f};
+
+        // Angle in [-pi/4, pi/4)
+        auto a = offset * vecf{1.57079632679489662f};
+        auto a2 = a * a;
+
+        auto s = vecf{-1.9515295891e-4f};
+        s = s * a2 + vecf{8.3321608736e-3f};
+        s = s * a2 - vecf{1.6666654611e-1f};
+        s = s * a2 * a + a;
+
+        auto c = vecf{2.443315711809948e-5f};
+        c = c * a2 - vecf{1.388731625493765e-3f};
+        c = c * a2 + vecf{4.166664568298827e-2f};
+        c = c * a2 * a2 - vecf{0.5f} * a2 + vecf{1.0f};
+
+        // Rotation by a multiple of a quarter turn swaps the sine and cosine
+        // for odd quadrants, and negates them according to the quadrant
+        auto is_odd = (quadrant & vec{1}) != vec{0};
+        auto s_bits = blend(is_odd, avel::bit_cast<vec>(c), avel::bit_cast<vec>(s));
+        auto c_bits = blend(is_odd, avel::bit_cast<vec>(s), avel::bit_cast<vec>(c));
+
+        s_bits ^= (quadrant & vec{2}) << 30;
+        c_bits ^= ((quadrant ^ (quadrant >> 1)) & vec{1}) << 31;
+
+        sine = avel::bit_cast<vecf>(s_bits);
+        return avel::bit_cast<vecf>(c_bits);
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Uniform distributions
+    //=====================================================
+
+    ///
+    /// \param gen Generator producing vectors of 32-bit integers
+    /// \return Vector of floats uniformly distributed over [0, 1). The
+    ///     values are multiples of 2^-23 computed from the upper bits of
+    ///     each lane of gen's output
+    ///
+    template<class G>
+    AVEL_FINL Vector<float, G::result_type::width> uniform_float(G& gen) {
+        using vec = typename G::result_type;
+        using vecf = Vector<float, vec::width>;
+        static_assert(std::is_same<typename vec::scalar, std::uint32_t>::value, "Generator must produce 32-bit integers");
+
+        return avel_impl::unit_interval_plus_one(gen()) - vecf{1.0f};
+    }
+
+    ///
+    /// \param gen Generator producing vectors of 64-bit integers
+    /// \return Vector of doubles uniformly distributed over [0, 1). The
+    ///     values are multiples of 2^-52 computed from the upper bits of
+    ///     each lane of gen's output
+    ///
+    template<class G>
+    AVEL_FINL Vector<double, G::result_type::width> uniform_double(G& gen) {
+        using vec = typename G::result_type;
+        using vecd = Vector<double, vec::width>;
+        static_assert(std::is_same<typename vec::scalar, std::uint64_t>::value, "Generator must produce 64-bit integers");
+
+        auto bits = (gen() >> 12) | vec{0x3FF0000000000000ull};
+        return bit_cast<vecd>(bits) - vecd{1.0};
+    }
+
+    ///
+    /// Produces integers uniformly distributed over [0, bound) using
+    /// Lemire's multiply-and-shift method. The high half of the 64-bit
+    /// product of a random value and bound is the result, unless the low
+    /// half falls below 2^32 mod bound, in which case the lane is redrawn.
+    /// Redraws are rare unless bound is large, and a fresh vector is drawn
+    /// from gen for each, of which only the rejected lanes are used.
+    ///
+    /// \param gen Generator producing vectors of 32-bit integers
+    /// \param bound Exclusive upper bound of the results. Must be non-zero
+    /// \return Vector of integers in [0, bound)
+    ///
+    template<class G>
+    AVEL_FINL typename G::result_type uniform_int(G& gen, std::uint32_t bound) {
+        using vec = typename G::result_type;
+        static_assert(std::is_same<typename vec::scalar, std::uint32_t>::value, "Generator must produce 32-bit integers");
+
+        const vec b{bound};
+
+        vec lo;
+        auto hi = avel_impl::mulhilo(gen(), b, lo);
+
+        // The threshold is only computed when some lane might be rejected,
+        // avoiding the division in the common case
+        if (any(lo < b)) {
+            const vec threshold{static_cast<std::uint32_t>(0 - bound) % bound};
+
+            auto rejected = lo < threshold;
+            while (any(rejected)) {
+                vec new_lo;
+                auto new_hi = avel_impl::mulhilo(gen(), b, new_lo);
+
+                hi = blend(rejected, new_hi, hi);
+                lo = blend(rejected, new_lo, lo);
+                rejected = lo < threshold;
+            }
+        }
+
+        return hi;
+    }
+
+    //=====================================================
+    // Normal distribution
+    //=====================================================
+
+    ///
+    /// Produces normally distributed floats using the Box-Muller transform.
+    /// Each pair of vectors drawn from a generator yields two vectors of
+    /// variates, the second of which is returned by the following call.
+    ///
+    /// \tparam N Number of lanes
+    ///
+    template<std::uint32_t N = natural_width_32f>
+    class Normal_distribution {
+    public:
+
+        using result_type = Vector<float, N>;
+
+        ///
+        /// \param mean Mean of the distribution
+        /// \param stddev Standard deviation of the distribution
+        ///
+        explicit Normal_distribution(float mean = 0.0f, float stddev = 1.0f):
+            mean(mean),
+            stddev(stddev) {}
+
+        ///
+        /// \param gen Generator producing vectors of N 32-bit integers
+        /// \return Vector of normally distributed values
+        ///
+        template<class G>
+        AVEL_FINL result_type operator()(G& gen) {
+            static_assert(std::is_same<typename G::result_type, Vector<std::uint32_t, N>>::value, "Generator must produce vectors of N 32-bit integers");
+
+            if (has_spare) {
+                has_spare = false;
+                return result_type{mean} + result_type{stddev} * spare;
+            }
+
+            // The radius uses 1 - u, which lies in (0, 1], so the logarithm
+            // is always finite
+            auto u = result_type{2.0f} - avel_impl::unit_interval_plus_one(gen());
+            auto radius = sqrt(result_type{-2.0f} * avel_impl::log_positive(u));
+
+            result_type sine;
+            auto cosine = avel_impl::random_sincos(gen(), sine);
+
+            spare = radius * sine;
+            has_spare = true;
+
+            return result_type{mean} + result_type{stddev} * (radius * cosine);
+        }
+
+        ///
+        /// Discards the cached second half of the last pair of variates, so
+        /// that the next call draws from the generator
+        ///
+        void reset() {
+            has_spare = false;
+        }
+
+    private:
+
+        float mean;
+        float stddev;
+
+        result_type spare;
+        bool has_spare = false;
+
+    };
+
+}
+
+#endif //AVEL_DISTRIBUTIONS_HPP
@@ -0,0 +1,138 @@
+#ifndef AVEL_PCG_HPP
+#define AVEL_PCG_HPP
+
+namespace avel_impl {
+
+    constexpr std::uint64_t pcg32_multiplier = 6364136223846793005ull;
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // PCG32
+    //=====================================================
+
+    ///
+    /// Runs an independent PCG32 (XSH RR) generator in each lane, producing
+    /// N random 32-bit values per call.
+    ///
+    /// Each lane's 64-bit state is advanced using 64-bit lanes, so the
+    /// state is held in two vectors of N / 2 lanes whose outputs are
+    /// narrowed into a single vector of 32-bit integers. The multiplication
+    /// is emulated using 32-bit multiplies on targets without AVX-512DQ.
+    ///
+    /// \tparam N Number of lanes. Must be either 1 or at least 4
+    ///
+    template<std::uint32_t N = natural_width_32u>
+    class Pcg32 {
+        static_assert(N >= 4, "Pcg32 requires either one or at least four lanes");
+
+        using state_type = Vector<std::uint64_t, N / 2>;
+
+    public:
+
+        using result_type = Vector<std::uint32_t, N>;
+
+        ///
+        /// Lane i is initialized as the reference implementation's
+        /// pcg32_srandom_r(initstate, initseq) would be, where initstate and
+        /// initseq are the (2i)th and (2i + 1)th outputs of a SplitMix64
+        /// generator initialized with seed.
+        ///
+        /// \param seed Value from which the state of all lanes is derived
+        ///
+        explicit Pcg32(std::uint64_t seed) {
+            std::array<std::uint64_t, N> states;
+            std::array<std::uint64_t, N> increments;
+            for (std::size_t i = 0; i < N; ++i) {
+                auto initstate = avel_impl::splitmix64(seed);
+                auto initseq = avel_impl::splitmix64(seed);
+
+                increments[i] = (initseq << 1) | 1;
+                states[i] = increments[i];
+                states[i] += initstate;
+                states[i] = states[i] * avel_impl::pcg32_multiplier + increments[i];
+            }
+
+            state0 = load<state_type>(states.data() + 0 * N / 2);
+            state1 = load<state_type>(states.data() + 1 * N / 2);
+            increment0 = load<state_type>(increments.data() + 0 * N / 2);
+            increment1 = load<state_type>(increments.data() + 1 * N / 2);
+        }
+
+        ///
+        /// \return Vector of the next output of each lane's generator
+        ///
+        AVEL_FINL result_type operator()() {
+            auto out0 = output(state0);
+            auto out1 = output(state1);
+
+            state0 = state0 * state_type{avel_impl::pcg32_multiplier} + increment0;
+            state1 = state1 * state_type{avel_impl::pcg32_multiplier} + increment1;
+
+            return avel_impl::narrow_pair(out0, out1);
+        }
+
+    private:
+
+        state_type state0;
+        state_type state1;
+
+        state_type increment0;
+        state_type increment1;
+
+        ///
+        /// \return The XSH RR output function applied to each lane of state,
+        ///     in the low half of each lane
+        ///
+        AVEL_FINL static state_type output(state_type state) {
+            auto xorshifted = ((state >> 18) ^ state) >> 27;
+            auto rotation = state >> 59;
+
+            // Rotating a 32-bit value right is equivalent to shifting a
+            // 64-bit lane holding two copies of it
+            auto doubled = (xorshifted << 32) | (xorshifted & state_type{0xFFFFFFFFull});
+            return doubled >> rotation;
+        }
+
+    };
+
+    ///
+    /// Single-lane PCG32, for targets whose natural vectors of 32-bit
+    /// integers have only one lane. The state is advanced using scalar
+    /// arithmetic.
+    ///
+    template<>
+    class Pcg32<1> {
+    public:
+
+        using result_type = Vector<std::uint32_t, 1>;
+
+        explicit Pcg32(std::uint64_t seed) {
+            auto initstate = avel_impl::splitmix64(seed);
+            auto initseq = avel_impl::splitmix64(seed);
+
+            increment = (initseq << 1) | 1;
+            state = (increment + initstate) * avel_impl::pcg32_multiplier + increment;
+        }
+
+        AVEL_FINL result_type operator()() {
+            auto xorshifted = static_cast<std::uint32_t>(((state >> 18) ^ state) >> 27);
+            auto rotation = static_cast<std::uint32_t>(state >> 59);
+
+            state = state * avel_impl::pcg32_multiplier + increment;
+
+            return result_type{rotr(xorshifted, rotation)};
+        }
+
+    private:
+
+        std::uint64_t state;
+        std::uint64_t increment;
+
+    };
+
+}
+
+#endif //AVEL_PCG_HPP
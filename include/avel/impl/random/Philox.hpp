@@ -0,0 +1,125 @@
+#ifndef AVEL_PHILOX_HPP
+#define AVEL_PHILOX_HPP
+
+namespace avel_impl {
+
+    constexpr std::uint32_t philox_multiplier0 = 0xD2511F53;
+    constexpr std::uint32_t philox_multiplier1 = 0xCD9E8D57;
+
+    constexpr std::uint32_t philox_weyl0 = 0x9E3779B9;
+    constexpr std::uint32_t philox_weyl1 = 0xBB67AE85;
+
+    constexpr std::uint32_t philox_rounds = 10;
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Philox4x32-10
+    //=====================================================
+
+    ///
+    /// Counter-based generator computing the Philox4x32-10 bijection of N
+    /// consecutive 128-bit counters at once. The four words of each counter
+    /// are held in separate vectors, so each round is performed using
+    /// whole-vector operations.
+    ///
+    /// Each block of four calls returns the first, second, third, and then
+    /// fourth output word of the counters c + 0 through c + N - 1, after
+    /// which c is advanced by N. Counters are 64-bit values placed in the
+    /// first two words of the 128-bit Philox counter, the remaining words
+    /// being zero.
+    ///
+    /// \tparam N Number of lanes
+    ///
+    template<std::uint32_t N = natural_width_32u>
+    class Philox4x32 {
+    public:
+
+        using result_type = Vector<std::uint32_t, N>;
+
+        ///
+        /// \param seed 64-bit Philox key, the low half being the first word
+        /// \param counter Counter of the first lane of the first block of
+        ///     outputs. Generators created with the same seed produce
+        ///     non-overlapping sequences if their counters differ by enough
+        ///
+        explicit Philox4x32(std::uint64_t seed, std::uint64_t counter = 0):
+            key0(static_cast<std::uint32_t>(seed)),
+            key1(static_cast<std::uint32_t>(seed >> 32)) {
+
+            std::array<std::uint32_t, N> lo;
+            std::array<std::uint32_t, N> hi;
+            for (std::size_t i = 0; i < N; ++i) {
+                lo[i] = static_cast<std::uint32_t>(counter + i);
+                hi[i] = static_cast<std::uint32_t>((counter + i) >> 32);
+            }
+
+            counter_lo = load<result_type>(lo.data());
+            counter_hi = load<result_type>(hi.data());
+        }
+
+        ///
+        /// \return Vector holding the next output word of each lane's
+        ///     counter
+        ///
+        AVEL_FINL result_type operator()() {
+            if (index == 4) {
+                generate_block();
+                index = 0;
+            }
+
+            return block[index++];
+        }
+
+    private:
+
+        std::uint32_t key0;
+        std::uint32_t key1;
+
+        result_type counter_lo;
+        result_type counter_hi;
+
+        std::array<result_type, 4> block;
+        std::uint32_t index = 4;
+
+        void generate_block() {
+            result_type c0 = counter_lo;
+            result_type c1 = counter_hi;
+            result_type c2{0x00};
+            result_type c3{0x00};
+
+            std::uint32_t k0 = key0;
+            std::uint32_t k1 = key1;
+
+            for (std::uint32_t i = 0; i < avel_impl::philox_rounds; ++i) {
+                result_type lo0;
+                result_type lo1;
+                auto hi0 = avel_impl::mulhilo(result_type{avel_impl::philox_multiplier0}, c0, lo0);
+                auto hi1 = avel_impl::mulhilo(result_type{avel_impl::philox_multiplier1}, c2, lo1);
+
+                c0 = hi1 ^ c1 ^ result_type{k0};
+                c1 = lo1;
+                c2 = hi0 ^ c3 ^ result_type{k1};
+                c3 = lo0;
+
+                k0 += avel_impl::philox_weyl0;
+                k1 += avel_impl::philox_weyl1;
+            }
+
+            block[0] = c0;
+            block[1] = c1;
+            block[2] = c2;
+            block[3] = c3;
+
+            // Lanes whose low word wraps around carry into the high word
+            counter_lo += result_type{N};
+            counter_hi += result_type{counter_lo < result_type{N}};
+        }
+
+    };
+
+}
+
+#endif //AVEL_PHILOX_HPP
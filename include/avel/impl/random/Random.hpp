@@ -0,0 +1,15 @@
+#ifndef AVEL_IMPL_RANDOM_HPP
+#define AVEL_IMPL_RANDOM_HPP
+
+#include <array>
+#include <type_traits>
+
+#include "Random_common.hpp"
+
+#include "Xoshiro.hpp"
+#include "Pcg.hpp"
+#include "Philox.hpp"
+
+#include "Distributions.hpp"
+
+#endif //AVEL_IMPL_RANDOM_HPP
@@ -0,0 +1,138 @@
+#ifndef AVEL_RANDOM_COMMON_HPP
+#define AVEL_RANDOM_COMMON_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // Seeding
+    //=====================================================
+
+    ///
+    /// Advances the state of a SplitMix64 generator and returns its next
+    /// output. Used to expand a single seed into the state of every lane
+    ///
+    AVEL_FINL std::uint64_t splitmix64(std::uint64_t& state) {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    //=====================================================
+    // Widening multiplication
+    //=====================================================
+
+    ///
+    /// \param x First factor
+    /// \param y Second factor
+    /// \param lo Set to the low 32 bits of each lane's 64-bit product
+    /// \return The high 32 bits of each lane's 64-bit product
+    ///
+    AVEL_FINL avel::vec1x32u mulhilo(avel::vec1x32u x, avel::vec1x32u y, avel::vec1x32u& lo) {
+        auto product = std::uint64_t(decay(x)) * std::uint64_t(decay(y));
+        lo = avel::vec1x32u{static_cast<std::uint32_t>(product)};
+        return avel::vec1x32u{static_cast<std::uint32_t>(product >> 32)};
+    }
+
+    #if defined(AVEL_SSE2)
+
+    AVEL_FINL avel::vec4x32u mulhilo(avel::vec4x32u x, avel::vec4x32u y, avel::vec4x32u& lo) {
+        auto even = _mm_mul_epu32(decay(x), decay(y));
+        auto odd = _mm_mul_epu32(_mm_srli_epi64(decay(x), 32), _mm_srli_epi64(decay(y), 32));
+
+        auto low_halves = _mm_set1_epi64x(0x00000000FFFFFFFFll);
+        lo = avel::vec4x32u{_mm_or_si128(_mm_and_si128(even, low_halves), _mm_slli_epi64(odd, 32))};
+        return avel::vec4x32u{_mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(low_halves, odd))};
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX2)
+
+    AVEL_FINL avel::vec8x32u mulhilo(avel::vec8x32u x, avel::vec8x32u y, avel::vec8x32u& lo) {
+        auto even = _mm256_mul_epu32(decay(x), decay(y));
+        auto odd = _mm256_mul_epu32(_mm256_srli_epi64(decay(x), 32), _mm256_srli_epi64(decay(y), 32));
+
+        lo = avel::vec8x32u{_mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA)};
+        return avel::vec8x32u{_mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA)};
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX512F)
+
+    AVEL_FINL avel::vec16x32u mulhilo(avel::vec16x32u x, avel::vec16x32u y, avel::vec16x32u& lo) {
+        auto even = _mm512_mul_epu32(decay(x), decay(y));
+        auto odd = _mm512_mul_epu32(_mm512_srli_epi64(decay(x), 32), _mm512_srli_epi64(decay(y), 32));
+
+        lo = avel::vec16x32u{_mm512_mask_blend_epi32(0xAAAA, even, _mm512_slli_epi64(odd, 32))};
+        return avel::vec16x32u{_mm512_mask_blend_epi32(0xAAAA, _mm512_srli_epi64(even, 32), odd)};
+    }
+
+    #endif
+
+    #if defined(AVEL_NEON)
+
+    AVEL_FINL avel::vec4x32u mulhilo(avel::vec4x32u x, avel::vec4x32u y, avel::vec4x32u& lo) {
+        auto prod_half0 = vreinterpretq_u32_u64(vmull_u32(vget_low_u32(decay(x)), vget_low_u32(decay(y))));
+        auto prod_half1 = vreinterpretq_u32_u64(vmull_u32(vget_high_u32(decay(x)), vget_high_u32(decay(y))));
+
+        auto halves = vuzpq_u32(prod_half0, prod_half1);
+        lo = avel::vec4x32u{halves.val[0]};
+        return avel::vec4x32u{halves.val[1]};
+    }
+
+    #endif
+
+    //=====================================================
+    // Narrowing
+    //=====================================================
+
+    // The following functions truncate each 64-bit lane of a and b to 32
+    // bits, returning the lanes of a followed by those of b
+
+    // Declared so that the name is known on targets without vector
+    // registers. Single-lane generators never reach these functions
+    template<class V>
+    V narrow_pair(V a, V b) = delete;
+
+    #if defined(AVEL_SSE2)
+
+    AVEL_FINL avel::vec4x32u narrow_pair(avel::vec2x64u a, avel::vec2x64u b) {
+        auto ret = _mm_shuffle_ps(_mm_castsi128_ps(decay(a)), _mm_castsi128_ps(decay(b)), _MM_SHUFFLE(2, 0, 2, 0));
+        return avel::vec4x32u{_mm_castps_si128(ret)};
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX2)
+
+    AVEL_FINL avel::vec8x32u narrow_pair(avel::vec4x64u a, avel::vec4x64u b) {
+        // Shuffling operates within 128-bit lanes, so the 64-bit groups of
+        // the result are reordered afterwards
+        auto interleaved = _mm256_shuffle_ps(_mm256_castsi256_ps(decay(a)), _mm256_castsi256_ps(decay(b)), _MM_SHUFFLE(2, 0, 2, 0));
+        return avel::vec8x32u{_mm256_permute4x64_epi64(_mm256_castps_si256(interleaved), _MM_SHUFFLE(3, 1, 2, 0))};
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX512F)
+
+    AVEL_FINL avel::vec16x32u narrow_pair(avel::vec8x64u a, avel::vec8x64u b) {
+        auto indices = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+        return avel::vec16x32u{_mm512_permutex2var_epi32(decay(a), indices, decay(b))};
+    }
+
+    #endif
+
+    #if defined(AVEL_NEON)
+
+    AVEL_FINL avel::vec4x32u narrow_pair(avel::vec2x64u a, avel::vec2x64u b) {
+        return avel::vec4x32u{vcombine_u32(vmovn_u64(decay(a)), vmovn_u64(decay(b)))};
+    }
+
+    #endif
+
+}
+
+#endif //AVEL_RANDOM_COMMON_HPP
@@ -0,0 +1,145 @@
+#ifndef AVEL_XOSHIRO_HPP
+#define AVEL_XOSHIRO_HPP
+
+namespace avel {
+
+    //=====================================================
+    // xoshiro128+
+    //=====================================================
+
+    ///
+    /// Runs an independent xoshiro128+ generator in each lane of a vector of
+    /// 32-bit integers, producing N random values per call.
+    ///
+    /// The lowest bits of xoshiro128+'s outputs are of lower quality than
+    /// the rest, so consumers should prefer the upper bits, as the
+    /// distribution functions in this header do.
+    ///
+    /// \tparam N Number of lanes
+    ///
+    template<std::uint32_t N = natural_width_32u>
+    class Xoshiro128_plus {
+    public:
+
+        using result_type = Vector<std::uint32_t, N>;
+
+        ///
+        /// The state of each lane is filled with consecutive outputs of a
+        /// SplitMix64 generator initialized with seed, two outputs per lane,
+        /// the low half of each output being used first.
+        ///
+        /// \param seed Value from which the state of all lanes is derived
+        ///
+        explicit Xoshiro128_plus(std::uint64_t seed) {
+            std::array<std::uint32_t, N> words[4];
+            for (std::size_t i = 0; i < N; ++i) {
+                for (std::size_t j = 0; j < 4; j += 2) {
+                    auto x = avel_impl::splitmix64(seed);
+                    words[j + 0][i] = static_cast<std::uint32_t>(x);
+                    words[j + 1][i] = static_cast<std::uint32_t>(x >> 32);
+                }
+            }
+
+            s0 = load<result_type>(words[0].data());
+            s1 = load<result_type>(words[1].data());
+            s2 = load<result_type>(words[2].data());
+            s3 = load<result_type>(words[3].data());
+        }
+
+        ///
+        /// \return Vector of the next output of each lane's generator
+        ///
+        AVEL_FINL result_type operator()() {
+            auto ret = s0 + s3;
+            auto t = s1 << 9;
+
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+
+            s2 ^= t;
+            s3 = rotl<11>(s3);
+
+            return ret;
+        }
+
+    private:
+
+        result_type s0;
+        result_type s1;
+        result_type s2;
+        result_type s3;
+
+    };
+
+    //=====================================================
+    // xoshiro256+
+    //=====================================================
+
+    ///
+    /// Runs an independent xoshiro256+ generator in each lane of a vector of
+    /// 64-bit integers, producing N random values per call.
+    ///
+    /// As with xoshiro128+, the lowest bits of each output are weaker than
+    /// the rest.
+    ///
+    /// \tparam N Number of lanes
+    ///
+    template<std::uint32_t N = natural_width_64u>
+    class Xoshiro256_plus {
+    public:
+
+        using result_type = Vector<std::uint64_t, N>;
+
+        ///
+        /// The state of each lane is filled with consecutive outputs of a
+        /// SplitMix64 generator initialized with seed, four outputs per
+        /// lane.
+        ///
+        /// \param seed Value from which the state of all lanes is derived
+        ///
+        explicit Xoshiro256_plus(std::uint64_t seed) {
+            std::array<std::uint64_t, N> words[4];
+            for (std::size_t i = 0; i < N; ++i) {
+                for (std::size_t j = 0; j < 4; ++j) {
+                    words[j][i] = avel_impl::splitmix64(seed);
+                }
+            }
+
+            s0 = load<result_type>(words[0].data());
+            s1 = load<result_type>(words[1].data());
+            s2 = load<result_type>(words[2].data());
+            s3 = load<result_type>(words[3].data());
+        }
+
+        ///
+        /// \return Vector of the next output of each lane's generator
+        ///
+        AVEL_FINL result_type operator()() {
+            auto ret = s0 + s3;
+            auto t = s1 << 17;
+
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+
+            s2 ^= t;
+            s3 = rotl<45>(s3);
+
+            return ret;
+        }
+
+    private:
+
+        result_type s0;
+        result_type s1;
+        result_type s2;
+        result_type s3;
+
+    };
+
+}
+
+#endif //AVEL_XOSHIRO_HPP
@@ -415,6 +415,23 @@ namespace avel {
         return ((std::uint64_t(a) + std::uint64_t(b)) >> 1) + t0;
     }
 
+    ///
+    /// MurmurHash3's finalizer. Mixes the bits of x such that each bit of the
+    /// input affects every bit of the output, making it suitable for hashing
+    /// integer keys. The mapping is a bijection.
+    ///
+    /// \param x Value to mix
+    /// \return Mixed value
+    [[nodiscard]]
+    AVEL_FINL std::uint32_t fmix(std::uint32_t x) {
+        x ^= x >> 16;
+        x *= 0x85ebca6bu;
+        x ^= x >> 13;
+        x *= 0xc2b2ae35u;
+        x ^= x >> 16;
+        return x;
+    }
+
 }
 
 #endif
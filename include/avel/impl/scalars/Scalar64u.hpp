@@ -456,6 +456,22 @@ namespace avel {
         #endif
     }
 
+    ///
+    /// MurmurHash3's 64-bit finalizer. A bijection under which each bit of
+    /// the output depends on every bit of the input.
+    ///
+    /// \param x Value to mix
+    /// \return Mixed value
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t fmix(std::uint64_t x) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ull;
+        x ^= x >> 33;
+        return x;
+    }
+
 }
 
 #endif //AVEL_SCALAR64U_HPP
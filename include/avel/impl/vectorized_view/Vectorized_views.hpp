@@ -5,12 +5,425 @@
 #ifndef AVEL_VECTORIZED_VIEWS_HPP
 #define AVEL_VECTORIZED_VIEWS_HPP
 
+#include <cstddef>
+#include <limits>
+#include <iterator>
+#include <type_traits>
+#include <algorithm>
+
 #include "../Capabilities.hpp"
+#include "../../Vector.hpp"
+
+namespace avel {
+
+    //=====================================================
+    // Constants
+    //=====================================================
+
+    ///
+    /// Value used to indicate that the number of elements in a view is only
+    /// known at run-time
+    ///
+    constexpr std::size_t Dynamic_extent = std::numeric_limits<std::size_t>::max();
+
+    //=====================================================
+    // Forward declarations
+    //=====================================================
+
+    ///
+    /// A non-owning view over a contiguous range of elements, meant to be
+    /// processed in vector-sized chunks.
+    ///
+    /// \tparam T Element type. May be const-qualified to indicate a read-only
+    ///     view
+    /// \tparam Extent Number of elements in the view, or Dynamic_extent if
+    ///     the number of elements is only known at run-time
+    /// \tparam Alignment Alignment, in bytes, that the view's data pointer is
+    ///     guaranteed to have. If at least the alignment of the natural-width
+    ///     vector for T, aligned loads and stores are used
+    template<class T, std::size_t Extent = Dynamic_extent, std::size_t Alignment = alignof(T)>
+    class Vectorized_view;
+
+    //=====================================================
+    // Vectorized_view_base
+    //=====================================================
+
+    template<std::size_t Extent>
+    class Vectorized_view_base {
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        explicit Vectorized_view_base(std::size_t) {}
+
+        Vectorized_view_base() = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        [[nodiscard]]
+        constexpr std::size_t size() const noexcept {
+            return Extent;
+        }
+
+    };
+
+    template<>
+    class Vectorized_view_base<Dynamic_extent> {
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        explicit Vectorized_view_base(std::size_t n):
+            count(n) {}
+
+        Vectorized_view_base() = default;
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        [[nodiscard]]
+        std::size_t size() const noexcept {
+            return count;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        std::size_t count = 0;
+
+    };
+
+    //=====================================================
+    // Vectorized_view
+    //=====================================================
+
+    template<class T, std::size_t Extent, std::size_t Alignment>
+    class Vectorized_view : Vectorized_view_base<Extent> {
+        using base = Vectorized_view_base<Extent>;
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using element_type = T;
+
+        using value_type = typename std::remove_cv<T>::type;
+
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        using pointer = T*;
+        using const_pointer = const value_type*;
+
+        using reference = T&;
+        using const_reference = const value_type&;
+
+        using iterator = pointer;
+
+        using vector_type = Natural_width_vector<value_type>;
+
+        static_assert(
+            std::is_arithmetic<value_type>::value && !std::is_same<value_type, bool>::value,
+            "Vectorized views are only supported for integral and floating-point types"
+        );
+
+        static_assert(
+            alignof(value_type) <= Alignment,
+            "Alignment of view must be at least the alignment of its element type"
+        );
+
+        //=================================================
+        // Static members
+        //=================================================
+
+        static constexpr std::size_t extent = Extent;
+
+        static constexpr std::size_t alignment = Alignment;
+
+        ///
+        /// Number of elements processed per chunk
+        ///
+        static constexpr std::size_t chunk_width = vector_type::width;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Vectorized_view(pointer ptr, size_type n):
+            base(n),
+            ptr(ptr) {}
+
+        template<std::size_t E = Extent, class = typename std::enable_if<E != Dynamic_extent>::type>
+        explicit Vectorized_view(pointer ptr):
+            base(Extent),
+            ptr(ptr) {}
+
+        ///
+        /// Allows views over mutable elements to be converted to views over
+        /// const elements
+        ///
+        template<
+            class U,
+            class = typename std::enable_if<
+                std::is_const<T>::value && std::is_same<U, value_type>::value
+            >::type
+        >
+        Vectorized_view(Vectorized_view<U, Extent, Alignment> v):
+            Vectorized_view(v.data(), v.size()) {}
+
+        Vectorized_view() = default;
+        Vectorized_view(const Vectorized_view&) = default;
+        Vectorized_view(Vectorized_view&&) noexcept = default;
+        ~Vectorized_view() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Vectorized_view& operator=(const Vectorized_view&) = default;
+        Vectorized_view& operator=(Vectorized_view&&) noexcept = default;
+
+        //=================================================
+        // Iterator methods
+        //=================================================
+
+        [[nodiscard]]
+        iterator begin() const noexcept {
+            return ptr;
+        }
+
+        [[nodiscard]]
+        iterator end() const noexcept {
+            return ptr + size();
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        [[nodiscard]]
+        reference operator[](size_type i) const {
+            return ptr[i];
+        }
+
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return base::size();
+        }
+
+        [[nodiscard]]
+        size_type size_bytes() const noexcept {
+            return size() * sizeof(value_type);
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        [[nodiscard]]
+        pointer data() const noexcept {
+            return ptr;
+        }
+
+        //=================================================
+        // Subviews
+        //=================================================
+
+        ///
+        /// \param n Number of elements in subview. Must not exceed size()
+        /// \return View over the first n elements of this view
+        [[nodiscard]]
+        Vectorized_view<T, Dynamic_extent, Alignment> first(size_type n) const {
+            return {ptr, n};
+        }
+
+        ///
+        /// \tparam N Number of elements in subview. Must not exceed size()
+        /// \return View over the first N elements of this view
+        template<std::size_t N>
+        [[nodiscard]]
+        Vectorized_view<T, N, Alignment> first() const {
+            static_assert(Extent == Dynamic_extent || N <= Extent, "Subview cannot be larger than view");
+            return Vectorized_view<T, N, Alignment>{ptr};
+        }
+
+        ///
+        /// \param n Number of elements in subview. Must not exceed size()
+        /// \return View over the last n elements of this view
+        [[nodiscard]]
+        Vectorized_view<T, Dynamic_extent, alignof(value_type)> last(size_type n) const {
+            return {ptr + (size() - n), n};
+        }
+
+        ///
+        /// \param offset Index of first element in subview
+        /// \param n Number of elements in subview. If Dynamic_extent, the
+        ///     subview extends to the end of this view
+        /// \return View over elements [offset, offset + n) of this view
+        [[nodiscard]]
+        Vectorized_view<T, Dynamic_extent, alignof(value_type)> subview(size_type offset, size_type n = Dynamic_extent) const {
+            return {ptr + offset, (n == Dynamic_extent) ? size() - offset : n};
+        }
+
+        ///
+        /// Produces a view over whole chunks of this view. Since chunks begin
+        /// at byte offsets which are multiples of sizeof(vector_type), the
+        /// subview retains the alignment of this view up to that size.
+        ///
+        /// \param offset Index of first chunk in subview
+        /// \param n Number of chunks in subview. The final chunk may be
+        ///     partial
+        /// \return View over the elements of chunks [offset, offset + n)
+        [[nodiscard]]
+        Vectorized_view<T, Dynamic_extent, (Alignment < sizeof(vector_type)) ? Alignment : sizeof(vector_type)> chunks(size_type offset, size_type n) const {
+            auto begin = std::min(offset * chunk_width, size());
+            auto end = std::min((offset + n) * chunk_width, size());
+            return {ptr + begin, end - begin};
+        }
+
+        //=================================================
+        // Chunk access
+        //=================================================
+
+        ///
+        /// \return Number of chunks in view, including a final partial chunk
+        [[nodiscard]]
+        size_type chunk_count() const noexcept {
+            return (size() + chunk_width - 1) / chunk_width;
+        }
+
+        ///
+        /// \return Number of chunks in view which contain exactly
+        ///     chunk_width elements
+        [[nodiscard]]
+        size_type full_chunk_count() const noexcept {
+            return size() / chunk_width;
+        }
+
+        ///
+        /// \param i Index of chunk. Must be less than chunk_count()
+        /// \return Number of elements in the ith chunk
+        [[nodiscard]]
+        std::uint32_t chunk_size(size_type i) const noexcept {
+            return static_cast<std::uint32_t>(std::min(size() - i * chunk_width, chunk_width));
+        }
+
+        ///
+        /// Loads the contents of the ith chunk into a vector. If the chunk is
+        /// partial, the remaining lanes are zeroed and no memory past the end
+        /// of the view is read.
+        ///
+        /// \param i Index of chunk. Must be less than chunk_count()
+        /// \return Vector containing elements of the ith chunk
+        [[nodiscard]]
+        vector_type load_chunk(size_type i) const {
+            const value_type* p = ptr + i * chunk_width;
+            if (is_vector_aligned) {
+                return aligned_load<vector_type>(p, chunk_size(i));
+            } else {
+                return load<vector_type>(p, chunk_size(i));
+            }
+        }
+
+        ///
+        /// Stores the contents of v to the ith chunk. If the chunk is partial,
+        /// only the lanes which correspond to elements of the view are
+        /// written.
+        ///
+        /// \param i Index of chunk. Must be less than chunk_count()
+        /// \param v Vector whose contents should be written to the chunk
+        void store_chunk(size_type i, vector_type v) const {
+            static_assert(!std::is_const<T>::value, "Cannot store to view over const elements");
+
+            value_type* p = ptr + i * chunk_width;
+            if (is_vector_aligned) {
+                aligned_store(p, v, chunk_size(i));
+            } else {
+                store(p, v, chunk_size(i));
+            }
+        }
+
+        ///
+        /// Invokes f on each chunk of the view in order, passing a vector
+        /// holding the chunk's contents and the number of valid lanes in it as
+        /// a std::uint32_t.
+        ///
+        /// \param f Callable invocable as f(vector_type, std::uint32_t)
+        template<class F>
+        void for_each_chunk(F f) const {
+            for (size_type i = 0; i < chunk_count(); ++i) {
+                f(load_chunk(i), chunk_size(i));
+            }
+        }
+
+        ///
+        /// Replaces the contents of each chunk of the view with the result of
+        /// invoking f on a vector holding the chunk's contents.
+        ///
+        /// \param f Callable invocable as f(vector_type) which returns a
+        ///     vector_type
+        template<class F>
+        void transform_chunks(F f) const {
+            for (size_type i = 0; i < chunk_count(); ++i) {
+                store_chunk(i, f(load_chunk(i)));
+            }
+        }
+
+    private:
+
+        //=================================================
+        // Static members
+        //=================================================
+
+        static constexpr bool is_vector_aligned = (alignof(vector_type) <= Alignment);
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        pointer ptr = nullptr;
+
+    };
+
+    template<class T, std::size_t Extent, std::size_t Alignment>
+    constexpr std::size_t Vectorized_view<T, Extent, Alignment>::extent;
+
+    template<class T, std::size_t Extent, std::size_t Alignment>
+    constexpr std::size_t Vectorized_view<T, Extent, Alignment>::alignment;
+
+    template<class T, std::size_t Extent, std::size_t Alignment>
+    constexpr std::size_t Vectorized_view<T, Extent, Alignment>::chunk_width;
+
+    template<class T, std::size_t Extent, std::size_t Alignment>
+    constexpr bool Vectorized_view<T, Extent, Alignment>::is_vector_aligned;
 
-#if defined(AVEL_SSE)
+    //=====================================================
+    // Type aliases
+    //=====================================================
 
-    #include "Vectorized_view32u.hpp"
+    using Vectorized_view8u  = Vectorized_view<std::uint8_t>;
+    using Vectorized_view8i  = Vectorized_view<std::int8_t>;
+    using Vectorized_view16u = Vectorized_view<std::uint16_t>;
+    using Vectorized_view16i = Vectorized_view<std::int16_t>;
+    using Vectorized_view32u = Vectorized_view<std::uint32_t>;
+    using Vectorized_view32i = Vectorized_view<std::int32_t>;
+    using Vectorized_view64u = Vectorized_view<std::uint64_t>;
+    using Vectorized_view64i = Vectorized_view<std::int64_t>;
+    using Vectorized_view32f = Vectorized_view<float>;
+    using Vectorized_view64f = Vectorized_view<double>;
 
-#endif
+}
 
 #endif //AVEL_VECTORIZED_VIEWS_HPP
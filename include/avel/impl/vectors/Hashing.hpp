@@ -0,0 +1,52 @@
+#ifndef AVEL_HASHING_HPP
+#define AVEL_HASHING_HPP
+
+namespace avel {
+
+    //=====================================================
+    // Integer hashing
+    //=====================================================
+
+    // The following functions hash a full vector of keys at once, producing
+    // the same results as their scalar counterparts. 64-bit multiplication
+    // is emulated using 32-bit multiplies on targets without AVX-512DQ
+
+    ///
+    /// MurmurHash3's finalizer applied to each lane of x
+    ///
+    /// \param x Vector of values to mix
+    /// \return fmix(x[i]) for each lane
+    template<std::uint32_t N>
+    [[nodiscard]]
+    AVEL_FINL Vector<std::uint32_t, N> fmix(Vector<std::uint32_t, N> x) {
+        using vec = Vector<std::uint32_t, N>;
+
+        x ^= x >> 16;
+        x *= vec{0x85ebca6bu};
+        x ^= x >> 13;
+        x *= vec{0xc2b2ae35u};
+        x ^= x >> 16;
+        return x;
+    }
+
+    ///
+    /// MurmurHash3's 64-bit finalizer applied to each lane of x
+    ///
+    /// \param x Vector of values to mix
+    /// \return fmix(x[i]) for each lane
+    template<std::uint32_t N>
+    [[nodiscard]]
+    AVEL_FINL Vector<std::uint64_t, N> fmix(Vector<std::uint64_t, N> x) {
+        using vec = Vector<std::uint64_t, N>;
+
+        x ^= x >> 33;
+        x *= vec{0xff51afd7ed558ccdull};
+        x ^= x >> 33;
+        x *= vec{0xc4ceb9fe1a85ec53ull};
+        x ^= x >> 33;
+        return x;
+    }
+
+}
+
+#endif //AVEL_HASHING_HPP
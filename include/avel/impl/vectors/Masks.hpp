@@ -0,0 +1,136 @@
+#ifndef AVEL_MASKS_HPP
+#define AVEL_MASKS_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // Lane bitmasks
+    //=====================================================
+
+    #if defined(AVEL_NEON)
+
+    AVEL_FINL uint16x8_t mask_as_u16(uint8x16_t m) {
+        return vreinterpretq_u16_u8(m);
+    }
+
+    AVEL_FINL uint16x8_t mask_as_u16(uint16x8_t m) {
+        return m;
+    }
+
+    AVEL_FINL uint16x8_t mask_as_u16(uint32x4_t m) {
+        return vreinterpretq_u16_u32(m);
+    }
+
+    AVEL_FINL uint16x8_t mask_as_u16(uint64x2_t m) {
+        return vreinterpretq_u16_u64(m);
+    }
+
+    // NEON has no movemask equivalent. Narrowing each 16-bit chunk of a mask
+    // to a byte leaves each lane represented by 64 / N consecutive bits,
+    // which is cheaper than compressing it down to a single bit per lane
+    template<std::uint32_t N>
+    using use_narrowed_mask = std::integral_constant<bool, (1 < N)>;
+
+    template<class T, std::uint32_t N>
+    AVEL_FINL std::uint64_t lane_bits(avel::Vector_mask<T, N> m, std::true_type) {
+        auto t0 = vshrn_n_u16(mask_as_u16(avel::decay(m)), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(t0), 0);
+    }
+
+    #else
+
+    template<std::uint32_t N>
+    using use_narrowed_mask = std::false_type;
+
+    #endif
+
+    template<class T, std::uint32_t N>
+    AVEL_FINL std::uint64_t lane_bits(avel::Vector_mask<T, N> m, std::false_type) {
+        return avel::to_bits(m);
+    }
+
+    ///
+    /// Converts m to an integer in which each lane is represented by
+    /// lane_bits_stride<N>() consecutive bits, all set if the lane is set
+    ///
+    template<class T, std::uint32_t N>
+    AVEL_FINL std::uint64_t lane_bits(avel::Vector_mask<T, N> m) {
+        return lane_bits(m, use_narrowed_mask<N>{});
+    }
+
+    template<std::uint32_t N>
+    constexpr std::uint32_t lane_bits_stride() {
+        return use_narrowed_mask<N>::value ? 64 / N : 1;
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Set lane iteration
+    //=====================================================
+
+    ///
+    /// Invokes f once for each set lane in m, in order of increasing lane
+    /// index, passing the index of the lane as a std::uint32_t.
+    ///
+    /// The mask is converted to a bitmask once, after which each set lane is
+    /// visited by counting trailing zeros and clearing the lowest set bit.
+    ///
+    /// \param m Mask whose set lanes should be visited
+    /// \param f Callable invocable as f(std::uint32_t)
+    template<class T, std::uint32_t N, class F>
+    AVEL_FINL void for_each_set_lane(Vector_mask<T, N> m, F f) {
+        std::uint64_t bits = to_bits(m);
+        while (bits) {
+            f(static_cast<std::uint32_t>(countr_zero(bits)));
+            bits &= bits - 1;
+        }
+    }
+
+    //=====================================================
+    // Set lane search
+    //=====================================================
+
+    ///
+    /// Finds the index of the lowest set lane in m.
+    ///
+    /// \param m Mask to search
+    /// \return Index of the lowest set lane, or the width of the mask if no
+    ///     lanes are set
+    template<class T, std::uint32_t N>
+    [[nodiscard]]
+    AVEL_FINL std::uint32_t find_first(Vector_mask<T, N> m) {
+        constexpr std::uint32_t stride = avel_impl::lane_bits_stride<N>();
+
+        // A bit just past the last lane makes the result equal to N when no
+        // lanes are set, removing the need for a branch
+        constexpr std::uint64_t sentinel = (N * stride < 64) ? (std::uint64_t(1) << (N * stride % 64)) : 0x00;
+
+        auto bits = avel_impl::lane_bits(m) | sentinel;
+        return static_cast<std::uint32_t>(countr_zero(bits) / stride);
+    }
+
+    ///
+    /// Finds the index of the highest set lane in m.
+    ///
+    /// \param m Mask to search
+    /// \return Index of the highest set lane, or the width of the mask if no
+    ///     lanes are set
+    template<class T, std::uint32_t N>
+    [[nodiscard]]
+    AVEL_FINL std::uint32_t find_last(Vector_mask<T, N> m) {
+        constexpr std::uint32_t stride = avel_impl::lane_bits_stride<N>();
+
+        auto bits = avel_impl::lane_bits(m);
+        if (bits == 0x00) {
+            return N;
+        }
+
+        return static_cast<std::uint32_t>((63 - countl_zero(bits)) / stride);
+    }
+
+}
+
+#endif //AVEL_MASKS_HPP
@@ -0,0 +1,242 @@
+#ifndef AVEL_SCANS_HPP
+#define AVEL_SCANS_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // Element shifts
+    //=====================================================
+
+    // Each of the following functions shifts the contents of a register
+    // towards the higher lanes by B bytes, shifting in zeros.
+
+    // Declared so that the name refers to a template on targets without
+    // vector registers. Single-lane vectors never reach these functions
+    template<std::uint32_t B, class P>
+    P shift_bytes_up(P v) = delete;
+
+    #if defined(AVEL_SSE2)
+
+    template<std::uint32_t B>
+    AVEL_FINL __m128i shift_bytes_up(__m128i v) {
+        return _mm_slli_si128(v, B);
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m128 shift_bytes_up(__m128 v) {
+        return _mm_castsi128_ps(shift_bytes_up<B>(_mm_castps_si128(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m128d shift_bytes_up(__m128d v) {
+        return _mm_castsi128_pd(shift_bytes_up<B>(_mm_castpd_si128(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX2)
+
+    template<std::uint32_t B, typename std::enable_if<(B < 16), bool>::type = true>
+    AVEL_FINL __m256i shift_bytes_up(__m256i v) {
+        // Low half is zeroed, high half holds the original low half
+        auto lo = _mm256_permute2x128_si256(v, v, 0x08);
+        return _mm256_alignr_epi8(v, lo, 16 - B);
+    }
+
+    template<std::uint32_t B, typename std::enable_if<(16 <= B), bool>::type = true>
+    AVEL_FINL __m256i shift_bytes_up(__m256i v) {
+        auto lo = _mm256_permute2x128_si256(v, v, 0x08);
+        return _mm256_slli_si256(lo, B - 16);
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m256 shift_bytes_up(__m256 v) {
+        return _mm256_castsi256_ps(shift_bytes_up<B>(_mm256_castps_si256(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m256d shift_bytes_up(__m256d v) {
+        return _mm256_castsi256_pd(shift_bytes_up<B>(_mm256_castpd_si256(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX512F)
+
+    template<std::uint32_t B, typename std::enable_if<(B % 4 == 0), bool>::type = true>
+    AVEL_FINL __m512i shift_bytes_up(__m512i v) {
+        return _mm512_alignr_epi32(v, _mm512_setzero_si512(), 16 - B / 4);
+    }
+
+    #if defined(AVEL_AVX512BW)
+    template<std::uint32_t B, typename std::enable_if<(B % 4 != 0), bool>::type = true>
+    AVEL_FINL __m512i shift_bytes_up(__m512i v) {
+        static_assert(B < 16, "Unaligned shifts only implemented for amounts under 16 bytes");
+
+        // Each 128-bit lane holds the contents of the lane beneath it
+        auto lo = _mm512_alignr_epi64(v, _mm512_setzero_si512(), 6);
+        return _mm512_alignr_epi8(v, lo, 16 - B);
+    }
+    #endif
+
+    template<std::uint32_t B>
+    AVEL_FINL __m512 shift_bytes_up(__m512 v) {
+        return _mm512_castsi512_ps(shift_bytes_up<B>(_mm512_castps_si512(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL __m512d shift_bytes_up(__m512d v) {
+        return _mm512_castsi512_pd(shift_bytes_up<B>(_mm512_castpd_si512(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_NEON)
+
+    template<std::uint32_t B>
+    AVEL_FINL uint8x16_t shift_bytes_up(uint8x16_t v) {
+        return vextq_u8(vdupq_n_u8(0x00), v, 16 - B);
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL int8x16_t shift_bytes_up(int8x16_t v) {
+        return vreinterpretq_s8_u8(shift_bytes_up<B>(vreinterpretq_u8_s8(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL uint16x8_t shift_bytes_up(uint16x8_t v) {
+        return vreinterpretq_u16_u8(shift_bytes_up<B>(vreinterpretq_u8_u16(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL int16x8_t shift_bytes_up(int16x8_t v) {
+        return vreinterpretq_s16_u8(shift_bytes_up<B>(vreinterpretq_u8_s16(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL uint32x4_t shift_bytes_up(uint32x4_t v) {
+        return vreinterpretq_u32_u8(shift_bytes_up<B>(vreinterpretq_u8_u32(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL int32x4_t shift_bytes_up(int32x4_t v) {
+        return vreinterpretq_s32_u8(shift_bytes_up<B>(vreinterpretq_u8_s32(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL uint64x2_t shift_bytes_up(uint64x2_t v) {
+        return vreinterpretq_u64_u8(shift_bytes_up<B>(vreinterpretq_u8_u64(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL int64x2_t shift_bytes_up(int64x2_t v) {
+        return vreinterpretq_s64_u8(shift_bytes_up<B>(vreinterpretq_u8_s64(v)));
+    }
+
+    template<std::uint32_t B>
+    AVEL_FINL float32x4_t shift_bytes_up(float32x4_t v) {
+        return vreinterpretq_f32_u8(shift_bytes_up<B>(vreinterpretq_u8_f32(v)));
+    }
+
+    #endif
+
+    #if defined(AVEL_AARCH64)
+
+    template<std::uint32_t B>
+    AVEL_FINL float64x2_t shift_bytes_up(float64x2_t v) {
+        return vreinterpretq_f64_u8(shift_bytes_up<B>(vreinterpretq_u8_f64(v)));
+    }
+
+    #endif
+
+    ///
+    /// Shifts the contents of v up by S lanes, shifting in zeros
+    ///
+    template<std::uint32_t S, class V>
+    AVEL_FINL V shift_elements_up(V v) {
+        static_assert(0 < S && S < V::width, "Shift amount must be in the range [1, width)");
+        return V{shift_bytes_up<S * sizeof(typename V::scalar)>(avel::decay(v))};
+    }
+
+    ///
+    /// Broadcasts the contents of the highest lane of v to all lanes
+    ///
+    template<class V>
+    AVEL_FINL V broadcast_last(V v) {
+        return V{avel::extract<V::width - 1>(v)};
+    }
+
+    //=====================================================
+    // Scan helpers
+    //=====================================================
+
+    template<std::uint32_t S, class V>
+    AVEL_FINL V inclusive_scan_impl(V v, std::false_type) {
+        return v;
+    }
+
+    template<std::uint32_t S, class V>
+    AVEL_FINL V inclusive_scan_impl(V v, std::true_type) {
+        v += shift_elements_up<S>(v);
+        return inclusive_scan_impl<2 * S>(v, std::integral_constant<bool, (2 * S < V::width)>{});
+    }
+
+    template<class V>
+    AVEL_FINL V inclusive_to_exclusive_scan(V, std::false_type) {
+        return V{typename V::scalar(0)};
+    }
+
+    template<class V>
+    AVEL_FINL V inclusive_to_exclusive_scan(V v, std::true_type) {
+        return shift_elements_up<1>(v);
+    }
+
+    ///
+    /// Converts the results of an inclusive scan into the results of the
+    /// corresponding exclusive scan
+    ///
+    template<class V>
+    AVEL_FINL V inclusive_to_exclusive_scan(V v) {
+        return inclusive_to_exclusive_scan(v, std::integral_constant<bool, (1 < V::width)>{});
+    }
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    ///
+    /// Computes the inclusive prefix sum of the lanes in v. That is, the nth
+    /// lane of the output holds the sum of lanes [0, n] of v.
+    ///
+    /// Implemented using log2(width) shift-and-add steps. For floating-point
+    /// vectors, the order of the additions differs from that of a sequential
+    /// sum so the results may differ slightly from those of a scalar loop.
+    ///
+    /// \param v Vector to scan
+    /// \return Inclusive prefix sum of v's lanes
+    template<class T, std::uint32_t N>
+    [[nodiscard]]
+    AVEL_FINL Vector<T, N> inclusive_scan(Vector<T, N> v) {
+        return avel_impl::inclusive_scan_impl<1>(v, std::integral_constant<bool, (1 < N)>{});
+    }
+
+    ///
+    /// Computes the exclusive prefix sum of the lanes in v. That is, the nth
+    /// lane of the output holds the sum of lanes [0, n) of v, with the first
+    /// lane being zero.
+    ///
+    /// \param v Vector to scan
+    /// \return Exclusive prefix sum of v's lanes
+    template<class T, std::uint32_t N>
+    [[nodiscard]]
+    AVEL_FINL Vector<T, N> exclusive_scan(Vector<T, N> v) {
+        return avel_impl::inclusive_to_exclusive_scan(inclusive_scan(v));
+    }
+
+}
+
+#endif //AVEL_SCANS_HPP
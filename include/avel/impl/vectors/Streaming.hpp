@@ -0,0 +1,175 @@
+#ifndef AVEL_STREAMING_HPP
+#define AVEL_STREAMING_HPP
+
+namespace avel_impl {
+
+    //=====================================================
+    // Non-temporal memory access
+    //=====================================================
+
+    // The following overloads provide non-temporal loads and stores for each
+    // register type. Loads are selected using a value of the register type
+    // as a tag. Types for which the target has no such instructions fall back
+    // to ordinary memory accesses.
+
+    template<class P>
+    AVEL_FINL P stream_load_impl(const void* ptr, P) {
+        P ret;
+        std::memcpy(&ret, ptr, sizeof(P));
+        return ret;
+    }
+
+    template<class P>
+    AVEL_FINL void stream_store_impl(void* ptr, P v) {
+        std::memcpy(ptr, &v, sizeof(P));
+    }
+
+    #if defined(AVEL_SSE2)
+
+    AVEL_FINL __m128i stream_load_impl(const void* ptr, __m128i) {
+        #if defined(AVEL_SSE4_1)
+        return _mm_stream_load_si128(static_cast<__m128i*>(const_cast<void*>(ptr)));
+        #else
+        return _mm_load_si128(static_cast<const __m128i*>(ptr));
+        #endif
+    }
+
+    AVEL_FINL __m128 stream_load_impl(const void* ptr, __m128) {
+        return _mm_castsi128_ps(stream_load_impl(ptr, __m128i{}));
+    }
+
+    AVEL_FINL __m128d stream_load_impl(const void* ptr, __m128d) {
+        return _mm_castsi128_pd(stream_load_impl(ptr, __m128i{}));
+    }
+
+    AVEL_FINL void stream_store_impl(void* ptr, __m128i v) {
+        _mm_stream_si128(static_cast<__m128i*>(ptr), v);
+    }
+
+    AVEL_FINL void stream_store_impl(void* ptr, __m128 v) {
+        _mm_stream_ps(static_cast<float*>(ptr), v);
+    }
+
+    AVEL_FINL void stream_store_impl(void* ptr, __m128d v) {
+        _mm_stream_pd(static_cast<double*>(ptr), v);
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX)
+
+    AVEL_FINL __m256i stream_load_impl(const void* ptr, __m256i) {
+        #if defined(AVEL_AVX2)
+        return _mm256_stream_load_si256(static_cast<const __m256i*>(ptr));
+        #else
+        return _mm256_load_si256(static_cast<const __m256i*>(ptr));
+        #endif
+    }
+
+    AVEL_FINL __m256 stream_load_impl(const void* ptr, __m256) {
+        return _mm256_castsi256_ps(stream_load_impl(ptr, __m256i{}));
+    }
+
+    AVEL_FINL __m256d stream_load_impl(const void* ptr, __m256d) {
+        return _mm256_castsi256_pd(stream_load_impl(ptr, __m256i{}));
+    }
+
+    AVEL_FINL void stream_store_impl(void* ptr, __m256i v) {
+        _mm256_stream_si256(static_cast<__m256i*>(ptr), v);
+    }
+
+    AVEL_FINL void stream_store_impl(void* ptr, __m256 v) {
+        _mm256_stream_ps(static_cast<float*>(ptr), v);
+    }
+
+    AVEL_FINL void stream_store_impl(void* ptr, __m256d v) {
+        _mm256_stream_pd(static_cast<double*>(ptr), v);
+    }
+
+    #endif
+
+    #if defined(AVEL_AVX512F)
+
+    AVEL_FINL __m512i stream_load_impl(const void* ptr, __m512i) {
+        return _mm512_stream_load_si512(const_cast<void*>(ptr));
+    }
+
+    AVEL_FINL __m512 stream_load_impl(const void* ptr, __m512) {
+        return _mm512_castsi512_ps(stream_load_impl(ptr, __m512i{}));
+    }
+
+    AVEL_FINL __m512d stream_load_impl(const void* ptr, __m512d) {
+        return _mm512_castsi512_pd(stream_load_impl(ptr, __m512i{}));
+    }
+
+    AVEL_FINL void stream_store_impl(void* ptr, __m512i v) {
+        _mm512_stream_si512(static_cast<__m512i*>(ptr), v);
+    }
+
+    AVEL_FINL void stream_store_impl(void* ptr, __m512 v) {
+        _mm512_stream_ps(static_cast<float*>(ptr), v);
+    }
+
+    AVEL_FINL void stream_store_impl(void* ptr, __m512d v) {
+        _mm512_stream_pd(static_cast<double*>(ptr), v);
+    }
+
+    #endif
+
+}
+
+namespace avel {
+
+    //=====================================================
+    // Non-temporal memory access
+    //=====================================================
+
+    ///
+    /// Loads a vector from memory with a hint that the data is not expected to
+    /// be reused soon, and so should not displace other data in the cache.
+    ///
+    /// On x86, the hint is only honored for write-combining memory, and
+    /// requires SSE4.1 for 128-bit vectors and AVX2 for 256-bit vectors. In
+    /// all other cases, an ordinary aligned load is performed.
+    ///
+    /// \tparam V Vector type to load
+    /// \param ptr Pointer to load from. Must be aligned to alignof(V)
+    /// \return Vector containing the loaded elements
+    template<class V>
+    [[nodiscard]]
+    AVEL_FINL V stream_load(const typename V::scalar* ptr) {
+        return V{avel_impl::stream_load_impl(ptr, typename V::primitive{})};
+    }
+
+    ///
+    /// Stores a vector to memory while bypassing the cache hierarchy, so that
+    /// writing large buffers does not evict data which will be reused.
+    ///
+    /// Non-temporal stores are weakly ordered with respect to other stores.
+    /// stream_fence() must be called before the stored data is handed off to
+    /// another thread.
+    ///
+    /// Where non-temporal stores are not available for V, an ordinary store is
+    /// performed.
+    ///
+    /// \param ptr Pointer to store to. Must be aligned to alignof(V)
+    /// \param v Vector to store
+    template<class T, std::uint32_t N>
+    AVEL_FINL void stream_store(T* ptr, Vector<T, N> v) {
+        avel_impl::stream_store_impl(ptr, decay(v));
+    }
+
+    ///
+    /// Orders all preceding non-temporal stores before any subsequent stores
+    ///
+    AVEL_FINL void stream_fence() {
+        #if defined(AVEL_SSE2)
+        _mm_sfence();
+        #else
+        std::atomic_thread_fence(std::memory_order_release);
+        #endif
+    }
+
+}
+
+#endif //AVEL_STREAMING_HPP
@@ -268,6 +268,17 @@ namespace avel {
         return mask16x16i{insert<N>(mask16x16u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask16x16i m) {
+        return to_bits(mask16x16u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask16x16i from_bits<mask16x16i>(std::uint64_t bits) {
+        return mask16x16i{from_bits<mask16x16u>(bits)};
+    }
+
 
 
 
@@ -971,6 +982,24 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec16x16i gather<vec16x16i>(const std::int16_t* ptr, vec16x16u indices, std::uint32_t n) {
+        return vec16x16i{gather<vec16x16u>(reinterpret_cast<const std::uint16_t*>(ptr), indices, n)};
+    }
+
+    AVEL_FINL void scatter(std::int16_t* ptr, vec16x16i x, vec16x16u indices, std::uint32_t n) {
+        scatter(reinterpret_cast<std::uint16_t*>(ptr), vec16x16u{x}, indices, n);
+    }
+
+    template<std::uint32_t N = vec16x16i::width>
+    AVEL_FINL void scatter(std::int16_t* ptr, vec16x16i x, vec16x16u indices) {
+        static_assert(N <= vec16x16i::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec16x16i::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
@@ -288,6 +288,36 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask16x16u m) {
+        #if (defined(AVEL_AVX512VL) && defined(AVEL_AVX512BW)) || defined(AVEL_AVX10_1)
+        return decay(m);
+
+        #elif defined(AVEL_AVX2)
+        auto lo = _mm256_castsi256_si128(decay(m));
+        auto hi = _mm256_extracti128_si256(decay(m), 0x1);
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(lo, hi)));
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask16x16u from_bits<mask16x16u>(std::uint64_t bits) {
+        #if (defined(AVEL_AVX512VL) && defined(AVEL_AVX512BW)) || defined(AVEL_AVX10_1)
+        return mask16x16u{static_cast<__mmask16>(bits)};
+
+        #elif defined(AVEL_AVX2)
+        auto t0 = _mm256_set1_epi16(static_cast<std::int16_t>(bits));
+        auto weights = _mm256_setr_epi16(
+            0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+            0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, std::int16_t(0x8000)
+        );
+        return mask16x16u{_mm256_cmpeq_epi16(_mm256_and_si256(t0, weights), weights)};
+
+        #endif
+    }
+
 
 
 
@@ -1062,6 +1092,55 @@ namespace avel {
         return ret;
     }
 
+    //Definition of gather/scatter delayed until now so they may rely on to_array
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec16x16u gather<vec16x16u>(const std::uint16_t* ptr, vec16x16u indices, std::uint32_t n) {
+        #if defined(AVEL_AVX512F)
+        // Elements are extracted from the aligned 32-bit words containing
+        // them so that no read extends past the page holding the element
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        auto misalignment = static_cast<std::int32_t>(address & 0x3);
+        auto base = reinterpret_cast<const void*>(address - misalignment);
+
+        auto offsets = _mm512_add_epi32(_mm512_slli_epi32(_mm512_cvtepu16_epi32(decay(indices)), 1), _mm512_set1_epi32(misalignment));
+        auto word_indices = _mm512_srli_epi32(offsets, 2);
+        auto shifts = _mm512_slli_epi32(_mm512_and_si512(offsets, _mm512_set1_epi32(0x2)), 3);
+
+        auto mask = (n >= 16) ? 0xFFFF : (1 << n) - 1;
+        auto words = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, word_indices, base, sizeof(std::uint32_t));
+
+        return vec16x16u{_mm512_cvtepi32_epi16(_mm512_srlv_epi32(words, shifts))};
+
+        #elif defined(AVEL_AVX2)
+        auto lo = gather<vec8x16u>(ptr, vec8x16u{_mm256_castsi256_si128(decay(indices))}, n);
+        auto hi = gather<vec8x16u>(ptr, vec8x16u{_mm256_extracti128_si256(decay(indices), 0x1)}, n - min(n, 8u));
+
+        return vec16x16u{_mm256_inserti128_si256(_mm256_castsi128_si256(decay(lo)), decay(hi), 0x1)};
+
+        #endif
+    }
+
+    AVEL_FINL void scatter(std::uint16_t* ptr, vec16x16u x, vec16x16u indices, std::uint32_t n) {
+        // No ISA offers scatters of elements narrower than 32 bits
+        auto index_array = to_array(indices);
+        auto value_array = to_array(x);
+
+        n = min(n, vec16x16u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ptr[index_array[i]] = value_array[i];
+        }
+    }
+
+    template<std::uint32_t N = vec16x16u::width>
+    AVEL_FINL void scatter(std::uint16_t* ptr, vec16x16u x, vec16x16u indices) {
+        static_assert(N <= vec16x16u::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec16x16u::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
@@ -198,6 +198,17 @@ namespace avel {
         return mask16x32f{__mmask16((decay(m) & ~mask) | mask)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask16x32f m) {
+        return decay(m);
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask16x32f from_bits<mask16x32f>(std::uint64_t bits) {
+        return mask16x32f{static_cast<__mmask16>(bits)};
+    }
+
 
 
 
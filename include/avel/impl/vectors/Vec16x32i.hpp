@@ -223,6 +223,17 @@ namespace avel {
         return mask16x32i{insert<N>(mask16x32u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask16x32i m) {
+        return to_bits(mask16x32u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask16x32i from_bits<mask16x32i>(std::uint64_t bits) {
+        return mask16x32i{from_bits<mask16x32u>(bits)};
+    }
+
 
 
     template<>
@@ -494,11 +505,11 @@ namespace avel {
     //=====================================================
 
     template<std::uint32_t N>
-    AVEL_FINL std::uint32_t extract(vec16x32i v) {
+    AVEL_FINL std::int32_t extract(vec16x32i v) {
         static_assert(N <= vec16x32i::width, "Specified index does not exist");
         typename std::enable_if<N <= vec16x32i::width, int>::type dummy_variable = 0;
 
-        return static_cast<std::uint32_t>(extract<N>(vec16x32u{v}));
+        return static_cast<std::int32_t>(extract<N>(vec16x32u{v}));
     }
 
     template<std::uint32_t N>
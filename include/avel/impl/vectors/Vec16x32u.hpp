@@ -207,6 +207,17 @@ namespace avel {
         return mask16x32u{__mmask16((decay(m) & ~mask) | mask)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask16x32u m) {
+        return decay(m);
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask16x32u from_bits<mask16x32u>(std::uint64_t bits) {
+        return mask16x32u{static_cast<__mmask16>(bits)};
+    }
+
 
 
 
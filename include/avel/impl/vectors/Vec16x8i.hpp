@@ -321,6 +321,17 @@ namespace avel {
         return mask16x8i{insert<N>(mask16x8u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask16x8i m) {
+        return to_bits(mask16x8u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask16x8i from_bits<mask16x8i>(std::uint64_t bits) {
+        return mask16x8i{from_bits<mask16x8u>(bits)};
+    }
+
 
 
 
@@ -1941,7 +1952,7 @@ namespace avel {
     template<>
     AVEL_FINL void store<vec16x8u::width>(std::int8_t* ptr, vec16x8i v) {
         #if defined(AVEL_SSE2)
-        _mm_store_si128(reinterpret_cast<__m128i*>(ptr), decay(v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), decay(v));
         #endif
 
         #if defined(AVEL_NEON)
@@ -1985,6 +1996,24 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec16x8i gather<vec16x8i>(const std::int8_t* ptr, vec16x8u indices, std::uint32_t n) {
+        return vec16x8i{gather<vec16x8u>(reinterpret_cast<const std::uint8_t*>(ptr), indices, n)};
+    }
+
+    AVEL_FINL void scatter(std::int8_t* ptr, vec16x8i x, vec16x8u indices, std::uint32_t n) {
+        scatter(reinterpret_cast<std::uint8_t*>(ptr), vec16x8u{x}, indices, n);
+    }
+
+    template<std::uint32_t N = vec16x8i::width>
+    AVEL_FINL void scatter(std::int8_t* ptr, vec16x8i x, vec16x8u indices) {
+        static_assert(N <= vec16x8i::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec16x8i::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
@@ -410,6 +410,63 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask16x8u m) {
+        #if (defined(AVEL_AVX512VL) && defined(AVEL_AVX512BW)) || defined(AVEL_AVX10_1)
+        return decay(m);
+
+        #elif defined(AVEL_SSE2)
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(decay(m)));
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        // Narrowing each lane to a single bit with a weighted horizontal add. Done
+        // per half since the sum of all weights would not fit in a byte
+        alignas(16) static constexpr std::uint8_t weight_data[16] {
+            0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+            0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+        };
+
+        auto t0 = vandq_u8(decay(m), vld1q_u8(weight_data));
+        std::uint64_t lo = vaddv_u8(vget_low_u8(t0));
+        std::uint64_t hi = vaddv_u8(vget_high_u8(t0));
+        return lo | (hi << 8);
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask16x8u from_bits<mask16x8u>(std::uint64_t bits) {
+        #if (defined(AVEL_AVX512VL) && defined(AVEL_AVX512BW)) || defined(AVEL_AVX10_1)
+        return mask16x8u{static_cast<__mmask16>(bits)};
+
+        #elif defined(AVEL_SSE2)
+        // Each byte of the first and second halves holds the low and high byte of bits
+        auto t0 = _mm_cvtsi32_si128(static_cast<std::int32_t>(bits));
+        auto t1 = _mm_unpacklo_epi8(t0, t0);
+        auto t2 = _mm_unpacklo_epi16(t1, t1);
+        auto t3 = _mm_unpacklo_epi32(t2, t2);
+
+        auto weights = _mm_set1_epi64x(0x8040201008040201ull);
+        return mask16x8u{_mm_cmpeq_epi8(_mm_and_si128(t3, weights), weights)};
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        alignas(16) static constexpr std::uint8_t weight_data[16] {
+            0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+            0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+        };
+
+        auto lo = vdup_n_u8(static_cast<std::uint8_t>(bits >> 0));
+        auto hi = vdup_n_u8(static_cast<std::uint8_t>(bits >> 8));
+        return mask16x8u{vtstq_u8(vcombine_u8(lo, hi), vld1q_u8(weight_data))};
+
+        #endif
+    }
+
 
 
 
@@ -2416,7 +2473,7 @@ namespace avel {
     template<>
     AVEL_FINL void store<vec16x8u::width>(std::uint8_t* ptr, vec16x8u v) {
         #if defined(AVEL_SSE2)
-        _mm_store_si128(reinterpret_cast<__m128i*>(ptr), decay(v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), decay(v));
         #endif
 
         #if defined(AVEL_NEON)
@@ -2461,6 +2518,226 @@ namespace avel {
         return ret;
     }
 
+    //Definition of gather/scatter delayed until now so they may rely on to_array
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec16x8u gather<vec16x8u>(const std::uint8_t* ptr, vec16x8u indices, std::uint32_t n) {
+        #if defined(AVEL_AVX512F)
+        // Elements are extracted from the aligned 32-bit words containing
+        // them so that no read extends past the page holding the element
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        auto misalignment = static_cast<std::int32_t>(address & 0x3);
+        auto base = reinterpret_cast<const void*>(address - misalignment);
+
+        auto offsets = _mm512_add_epi32(_mm512_cvtepu8_epi32(decay(indices)), _mm512_set1_epi32(misalignment));
+        auto word_indices = _mm512_srli_epi32(offsets, 2);
+        auto shifts = _mm512_slli_epi32(_mm512_and_si512(offsets, _mm512_set1_epi32(0x3)), 3);
+
+        auto mask = (n >= 16) ? 0xFFFF : (1 << n) - 1;
+        auto words = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask, word_indices, base, sizeof(std::uint32_t));
+
+        return vec16x8u{_mm512_cvtepi32_epi8(_mm512_srlv_epi32(words, shifts))};
+
+        #elif defined(AVEL_AVX2)
+        // Elements are extracted from the aligned 32-bit words containing
+        // them so that no read extends past the page holding the element
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        auto misalignment = static_cast<std::int32_t>(address & 0x3);
+        auto base = reinterpret_cast<const int*>(address - misalignment);
+
+        auto offset = _mm256_set1_epi32(misalignment);
+        auto offsets_lo = _mm256_add_epi32(_mm256_cvtepu8_epi32(decay(indices)), offset);
+        auto offsets_hi = _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_srli_si128(decay(indices), 8)), offset);
+
+        auto count = static_cast<std::int32_t>(min(n, vec16x8u::width));
+        auto lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        auto mask_lo = _mm256_cmpgt_epi32(_mm256_set1_epi32(count - 0), lanes);
+        auto mask_hi = _mm256_cmpgt_epi32(_mm256_set1_epi32(count - 8), lanes);
+
+        auto zeros = _mm256_setzero_si256();
+        auto words_lo = _mm256_mask_i32gather_epi32(zeros, base, _mm256_srli_epi32(offsets_lo, 2), mask_lo, sizeof(std::uint32_t));
+        auto words_hi = _mm256_mask_i32gather_epi32(zeros, base, _mm256_srli_epi32(offsets_hi, 2), mask_hi, sizeof(std::uint32_t));
+
+        auto three = _mm256_set1_epi32(0x3);
+        auto byte_mask = _mm256_set1_epi32(0xFF);
+        auto bytes_lo = _mm256_and_si256(_mm256_srlv_epi32(words_lo, _mm256_slli_epi32(_mm256_and_si256(offsets_lo, three), 3)), byte_mask);
+        auto bytes_hi = _mm256_and_si256(_mm256_srlv_epi32(words_hi, _mm256_slli_epi32(_mm256_and_si256(offsets_hi, three), 3)), byte_mask);
+
+        // Packing operates within 128-bit lanes so elements must be put
+        // back into order before the final pack
+        auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(bytes_lo, bytes_hi), 0xD8);
+        auto ret = _mm_packus_epi16(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 0x1));
+
+        return vec16x8u{ret};
+
+        #elif defined(AVEL_SSE2)
+        auto index_array = to_array(indices);
+
+        arr16x8u ret{};
+        n = min(n, vec16x8u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ret[i] = ptr[index_array[i]];
+        }
+
+        return vec16x8u{ret};
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        auto index_array = to_array(indices);
+
+        arr16x8u ret{};
+        n = min(n, vec16x8u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ret[i] = ptr[index_array[i]];
+        }
+
+        return vec16x8u{ret};
+
+        #endif
+    }
+
+    AVEL_FINL void scatter(std::uint8_t* ptr, vec16x8u x, vec16x8u indices, std::uint32_t n) {
+        // No ISA offers scatters of elements narrower than 32 bits
+        auto index_array = to_array(indices);
+        auto value_array = to_array(x);
+
+        n = min(n, vec16x8u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ptr[index_array[i]] = value_array[i];
+        }
+    }
+
+    template<std::uint32_t N = vec16x8u::width>
+    AVEL_FINL void scatter(std::uint8_t* ptr, vec16x8u x, vec16x8u indices) {
+        static_assert(N <= vec16x8u::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec16x8u::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
+    //=====================================================
+    // Table lookup operations
+    //=====================================================
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 16-entry table.
+    ///
+    /// \param table Vector holding the table's entries
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 16
+    [[nodiscard]]
+    AVEL_FINL vec16x8u lookup16(vec16x8u table, vec16x8u indices) {
+        #if defined(AVEL_SSSE3)
+        // Saturating addition sets the high bit of indices which are out of
+        // range without disturbing the low nibble of those which are not,
+        // causing pshufb to zero the corresponding lanes
+        auto adjusted_indices = _mm_adds_epu8(decay(indices), _mm_set1_epi8(0x70));
+        return vec16x8u{_mm_shuffle_epi8(decay(table), adjusted_indices)};
+
+        #elif defined(AVEL_SSE2)
+        auto table_array = to_array(table);
+        auto index_array = to_array(indices);
+
+        alignas(16) arr16x8u ret{};
+        for (std::size_t i = 0; i < vec16x8u::width; ++i) {
+            auto index = index_array[i];
+            ret[i] = (index < 16) ? table_array[index] : 0x00;
+        }
+
+        return vec16x8u{ret};
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        return vec16x8u{vqtbl1q_u8(decay(table), decay(indices))};
+
+        #endif
+    }
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 32-entry table.
+    ///
+    /// \param table Vectors holding the table's entries, lowest entries first
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 32
+    [[nodiscard]]
+    AVEL_FINL vec16x8u lookup32(std::array<vec16x8u, 2> table, vec16x8u indices) {
+        #if (defined(AVEL_AVX512VL) && defined(AVEL_AVX512VBMI)) || defined(AVEL_AVX10_1)
+        auto in_range = _mm_cmplt_epu8_mask(decay(indices), _mm_set1_epi8(32));
+        auto ret = _mm_maskz_permutex2var_epi8(in_range, decay(table[0]), decay(indices), decay(table[1]));
+        return vec16x8u{ret};
+
+        #elif defined(AVEL_SSE2)
+        // Subtraction wraps indices meant for the first half of the table
+        // around to large values, which the second lookup maps to zero
+        auto lo = lookup16(table[0], indices);
+        auto hi = lookup16(table[1], indices - vec16x8u{16});
+        return lo | hi;
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        uint8x16x2_t t{{decay(table[0]), decay(table[1])}};
+        return vec16x8u{vqtbl2q_u8(t, decay(indices))};
+
+        #endif
+    }
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 64-entry table.
+    ///
+    /// \param table Vectors holding the table's entries, lowest entries first
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 64
+    [[nodiscard]]
+    AVEL_FINL vec16x8u lookup64(std::array<vec16x8u, 4> table, vec16x8u indices) {
+        #if defined(AVEL_SSE2)
+        auto lo = lookup32({table[0], table[1]}, indices);
+        auto hi = lookup32({table[2], table[3]}, indices - vec16x8u{32});
+        return lo | hi;
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        uint8x16x4_t t{{decay(table[0]), decay(table[1]), decay(table[2]), decay(table[3])}};
+        return vec16x8u{vqtbl4q_u8(t, decay(indices))};
+
+        #endif
+    }
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 128-entry table.
+    ///
+    /// \param table Vectors holding the table's entries, lowest entries first
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 128
+    [[nodiscard]]
+    AVEL_FINL vec16x8u lookup128(std::array<vec16x8u, 8> table, vec16x8u indices) {
+        #if defined(AVEL_SSE2)
+        auto lo = lookup64({table[0], table[1], table[2], table[3]}, indices);
+        auto hi = lookup64({table[4], table[5], table[6], table[7]}, indices - vec16x8u{64});
+        return lo | hi;
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        uint8x16x4_t t0{{decay(table[0]), decay(table[1]), decay(table[2]), decay(table[3])}};
+        uint8x16x4_t t1{{decay(table[4]), decay(table[5]), decay(table[6]), decay(table[7])}};
+
+        // Lanes not in range of the second table retain the first table's results
+        auto lo = vqtbl4q_u8(t0, decay(indices));
+        auto ret = vqtbx4q_u8(lo, t1, vsubq_u8(decay(indices), vdupq_n_u8(64)));
+        return vec16x8u{ret};
+
+        #endif
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
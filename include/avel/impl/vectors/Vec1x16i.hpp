@@ -200,6 +200,17 @@ namespace avel {
         return mask1x16i{b};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask1x16i m) {
+        return decay(m) ? 0x1 : 0x0;
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask1x16i from_bits<mask1x16i>(std::uint64_t bits) {
+        return mask1x16i{bool(bits & 0x1)};
+    }
+
 
 
 
@@ -659,6 +670,38 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec1x16i gather<vec1x16i>(const std::int16_t* ptr, vec1x16u indices, std::uint32_t n) {
+        if (n) {
+            return vec1x16i{ptr[decay(indices)]};
+        } else {
+            return vec1x16i{0x00};
+        }
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec1x16i gather<vec1x16i>(const std::int16_t* ptr, vec1x16u indices) {
+        return vec1x16i{ptr[decay(indices)]};
+    }
+
+    AVEL_FINL void scatter(std::int16_t* ptr, vec1x16i v, vec1x16u indices, std::uint32_t n) {
+        if (n) {
+            ptr[decay(indices)] = decay(v);
+        }
+    }
+
+    template<std::uint32_t N = vec1x16i::width>
+    AVEL_FINL void scatter(std::int16_t* ptr, vec1x16i v, vec1x16u indices) {
+        static_assert(N <= vec1x16i::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec1x16i::width, int>::type dummy_variable = 0;
+
+        if (N) {
+            ptr[decay(indices)] = decay(v);
+        }
+    }
+
     //=====================================================
     // Arrangement Instructions
     //=====================================================
@@ -184,6 +184,17 @@ namespace avel {
         return mask1x16u{b};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask1x16u m) {
+        return decay(m) ? 0x1 : 0x0;
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask1x16u from_bits<mask1x16u>(std::uint64_t bits) {
+        return mask1x16u{bool(bits & 0x1)};
+    }
+
     //=====================================================
     // Mask conversions
     //=====================================================
@@ -621,6 +632,38 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec1x16u gather<vec1x16u>(const std::uint16_t* ptr, vec1x16u indices, std::uint32_t n) {
+        if (n) {
+            return vec1x16u{ptr[decay(indices)]};
+        } else {
+            return vec1x16u{0x00};
+        }
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec1x16u gather<vec1x16u>(const std::uint16_t* ptr, vec1x16u indices) {
+        return vec1x16u{ptr[decay(indices)]};
+    }
+
+    AVEL_FINL void scatter(std::uint16_t* ptr, vec1x16u v, vec1x16u indices, std::uint32_t n) {
+        if (n) {
+            ptr[decay(indices)] = decay(v);
+        }
+    }
+
+    template<std::uint32_t N = vec1x16u::width>
+    AVEL_FINL void scatter(std::uint16_t* ptr, vec1x16u v, vec1x16u indices) {
+        static_assert(N <= vec1x16u::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec1x16u::width, int>::type dummy_variable = 0;
+
+        if (N) {
+            ptr[decay(indices)] = decay(v);
+        }
+    }
+
     //=====================================================
     // Arrangement Instructions
     //=====================================================
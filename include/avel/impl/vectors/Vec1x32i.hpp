@@ -200,6 +200,17 @@ namespace avel {
         return mask1x32i{b};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask1x32i m) {
+        return decay(m) ? 0x1 : 0x0;
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask1x32i from_bits<mask1x32i>(std::uint64_t bits) {
+        return mask1x32i{bool(bits & 0x1)};
+    }
+
 
 
 
@@ -184,6 +184,17 @@ namespace avel {
         return mask1x32u{b};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask1x32u m) {
+        return decay(m) ? 0x1 : 0x0;
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask1x32u from_bits<mask1x32u>(std::uint64_t bits) {
+        return mask1x32u{bool(bits & 0x1)};
+    }
+
     //=====================================================
     // Mask conversions
     //=====================================================
@@ -175,6 +175,17 @@ namespace avel {
         return mask1x64f{b};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask1x64f m) {
+        return decay(m) ? 0x1 : 0x0;
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask1x64f from_bits<mask1x64f>(std::uint64_t bits) {
+        return mask1x64f{bool(bits & 0x1)};
+    }
+
 
 
 
@@ -184,6 +184,17 @@ namespace avel {
         return mask1x64u{b};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask1x64u m) {
+        return decay(m) ? 0x1 : 0x0;
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask1x64u from_bits<mask1x64u>(std::uint64_t bits) {
+        return mask1x64u{bool(bits & 0x1)};
+    }
+
     //=====================================================
     // Mask conversions
     //=====================================================
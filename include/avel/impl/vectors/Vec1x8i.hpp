@@ -184,6 +184,17 @@ namespace avel {
         return mask1x8i{b};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask1x8i m) {
+        return decay(m) ? 0x1 : 0x0;
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask1x8i from_bits<mask1x8i>(std::uint64_t bits) {
+        return mask1x8i{bool(bits & 0x1)};
+    }
+
     //=====================================================
     // Mask conversions
     //=====================================================
@@ -657,6 +668,38 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec1x8i gather<vec1x8i>(const std::int8_t* ptr, vec1x8u indices, std::uint32_t n) {
+        if (n) {
+            return vec1x8i{ptr[decay(indices)]};
+        } else {
+            return vec1x8i{0x00};
+        }
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec1x8i gather<vec1x8i>(const std::int8_t* ptr, vec1x8u indices) {
+        return vec1x8i{ptr[decay(indices)]};
+    }
+
+    AVEL_FINL void scatter(std::int8_t* ptr, vec1x8i v, vec1x8u indices, std::uint32_t n) {
+        if (n) {
+            ptr[decay(indices)] = decay(v);
+        }
+    }
+
+    template<std::uint32_t N = vec1x8i::width>
+    AVEL_FINL void scatter(std::int8_t* ptr, vec1x8i v, vec1x8u indices) {
+        static_assert(N <= vec1x8i::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec1x8i::width, int>::type dummy_variable = 0;
+
+        if (N) {
+            ptr[decay(indices)] = decay(v);
+        }
+    }
+
     //=====================================================
     // Arrangement Instructions
     //=====================================================
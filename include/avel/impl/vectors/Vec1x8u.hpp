@@ -184,6 +184,17 @@ namespace avel {
         return mask1x8u{b};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask1x8u m) {
+        return decay(m) ? 0x1 : 0x0;
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask1x8u from_bits<mask1x8u>(std::uint64_t bits) {
+        return mask1x8u{bool(bits & 0x1)};
+    }
+
 
 
 
@@ -597,6 +608,38 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec1x8u gather<vec1x8u>(const std::uint8_t* ptr, vec1x8u indices, std::uint32_t n) {
+        if (n) {
+            return vec1x8u{ptr[decay(indices)]};
+        } else {
+            return vec1x8u{0x00};
+        }
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec1x8u gather<vec1x8u>(const std::uint8_t* ptr, vec1x8u indices) {
+        return vec1x8u{ptr[decay(indices)]};
+    }
+
+    AVEL_FINL void scatter(std::uint8_t* ptr, vec1x8u v, vec1x8u indices, std::uint32_t n) {
+        if (n) {
+            ptr[decay(indices)] = decay(v);
+        }
+    }
+
+    template<std::uint32_t N = vec1x8u::width>
+    AVEL_FINL void scatter(std::uint8_t* ptr, vec1x8u v, vec1x8u indices) {
+        static_assert(N <= vec1x8u::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec1x8u::width, int>::type dummy_variable = 0;
+
+        if (N) {
+            ptr[decay(indices)] = decay(v);
+        }
+    }
+
     //=====================================================
     // Arrangement Instructions
     //=====================================================
@@ -367,6 +367,52 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask2x64f m) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return decay(m);
+
+        #elif defined(AVEL_SSE2)
+        return static_cast<std::uint32_t>(_mm_movemask_pd(decay(m)));
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        // Narrowing each lane to a single bit by shifting out all but the
+        // sign bit of each lane
+        auto t0 = vshrn_n_u64(decay(m), 32);
+        auto t1 = vshr_n_u32(t0, 31);
+        return vget_lane_u32(t1, 0) | (vget_lane_u32(t1, 1) << 1);
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask2x64f from_bits<mask2x64f>(std::uint64_t bits) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return mask2x64f{static_cast<__mmask8>(bits & 0x3)};
+
+        #elif defined(AVEL_SSE2)
+        // Comparing 32-bit halves since SSE2 lacks a 64-bit equality comparison
+        auto t0 = _mm_set1_epi32(static_cast<std::int32_t>(bits));
+        auto weights = _mm_setr_epi32(0x1, 0x1, 0x2, 0x2);
+        auto t1 = _mm_cmpeq_epi32(_mm_and_si128(t0, weights), weights);
+        return mask2x64f{_mm_castsi128_pd(t1)};
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        alignas(16) static constexpr std::uint64_t weight_data[2] {
+            0x1, 0x2
+        };
+
+        auto t0 = vdupq_n_u64(bits);
+        return mask2x64f{vtstq_u64(t0, vld1q_u64(weight_data))};
+
+        #endif
+    }
+
 
 
 
@@ -326,6 +326,17 @@ namespace avel {
         return mask2x64i{insert<N>(mask2x64u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask2x64i m) {
+        return to_bits(mask2x64u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask2x64i from_bits<mask2x64i>(std::uint64_t bits) {
+        return mask2x64i{from_bits<mask2x64u>(bits)};
+    }
+
 
 
 
@@ -495,8 +506,11 @@ namespace avel {
 
             #elif defined(AVEL_SSE2)
 
-            auto t0 = decay(lhs);
-            auto t1 = decay(rhs);
+            // The low halves of each element must be compared as unsigned
+            // integers, so their sign bits are flipped
+            auto bias = _mm_set_epi32(0x00, 0x80000000, 0x00, 0x80000000);
+            auto t0 = _mm_xor_si128(decay(lhs), bias);
+            auto t1 = _mm_xor_si128(decay(rhs), bias);
 
             auto c0 = _mm_cmplt_epi32(t0, t1);
             auto c1 = _mm_cmplt_epi32(t1, t0);
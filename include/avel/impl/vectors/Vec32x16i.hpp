@@ -233,6 +233,17 @@ namespace avel {
         return mask32x16i{insert<N>(mask32x16u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask32x16i m) {
+        return to_bits(mask32x16u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask32x16i from_bits<mask32x16i>(std::uint64_t bits) {
+        return mask32x16i{from_bits<mask32x16u>(bits)};
+    }
+
 
 
 
@@ -842,6 +853,24 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec32x16i gather<vec32x16i>(const std::int16_t* ptr, vec32x16u indices, std::uint32_t n) {
+        return vec32x16i{gather<vec32x16u>(reinterpret_cast<const std::uint16_t*>(ptr), indices, n)};
+    }
+
+    AVEL_FINL void scatter(std::int16_t* ptr, vec32x16i x, vec32x16u indices, std::uint32_t n) {
+        scatter(reinterpret_cast<std::uint16_t*>(ptr), vec32x16u{x}, indices, n);
+    }
+
+    template<std::uint32_t N = vec32x16i::width>
+    AVEL_FINL void scatter(std::int16_t* ptr, vec32x16i x, vec32x16u indices) {
+        static_assert(N <= vec32x16i::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec32x16i::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
@@ -216,6 +216,17 @@ namespace avel {
         return mask32x16u{__mmask32((decay(m) & ~mask) | mask)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask32x16u m) {
+        return decay(m);
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask32x16u from_bits<mask32x16u>(std::uint64_t bits) {
+        return mask32x16u{static_cast<__mmask32>(bits)};
+    }
+
 
 
 
@@ -863,6 +874,39 @@ namespace avel {
         return ret;
     }
 
+    //Definition of gather/scatter delayed until now so they may rely on to_array
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec32x16u gather<vec32x16u>(const std::uint16_t* ptr, vec32x16u indices, std::uint32_t n) {
+        #if defined(AVEL_AVX512BW)
+        auto lo = gather<vec16x16u>(ptr, vec16x16u{_mm512_castsi512_si256(decay(indices))}, n);
+        auto hi = gather<vec16x16u>(ptr, vec16x16u{_mm512_extracti64x4_epi64(decay(indices), 0x1)}, n - min(n, 16u));
+
+        return vec32x16u{_mm512_inserti64x4(_mm512_castsi256_si512(decay(lo)), decay(hi), 0x1)};
+
+        #endif
+    }
+
+    AVEL_FINL void scatter(std::uint16_t* ptr, vec32x16u x, vec32x16u indices, std::uint32_t n) {
+        // No ISA offers scatters of elements narrower than 32 bits
+        auto index_array = to_array(indices);
+        auto value_array = to_array(x);
+
+        n = min(n, vec32x16u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ptr[index_array[i]] = value_array[i];
+        }
+    }
+
+    template<std::uint32_t N = vec32x16u::width>
+    AVEL_FINL void scatter(std::uint16_t* ptr, vec32x16u x, vec32x16u indices) {
+        static_assert(N <= vec32x16u::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec32x16u::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
@@ -266,6 +266,17 @@ namespace avel {
         return mask32x8i{insert<N>(mask32x8u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask32x8i m) {
+        return to_bits(mask32x8u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask32x8i from_bits<mask32x8i>(std::uint64_t bits) {
+        return mask32x8i{from_bits<mask32x8u>(bits)};
+    }
+
 
 
 
@@ -1123,6 +1134,24 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec32x8i gather<vec32x8i>(const std::int8_t* ptr, vec32x8u indices, std::uint32_t n) {
+        return vec32x8i{gather<vec32x8u>(reinterpret_cast<const std::uint8_t*>(ptr), indices, n)};
+    }
+
+    AVEL_FINL void scatter(std::int8_t* ptr, vec32x8i x, vec32x8u indices, std::uint32_t n) {
+        scatter(reinterpret_cast<std::uint8_t*>(ptr), vec32x8u{x}, indices, n);
+    }
+
+    template<std::uint32_t N = vec32x8i::width>
+    AVEL_FINL void scatter(std::int8_t* ptr, vec32x8i x, vec32x8u indices) {
+        static_assert(N <= vec32x8i::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec32x8i::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
     //=====================================================
     // General vector operations
     //=====================================================
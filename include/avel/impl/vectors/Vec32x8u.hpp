@@ -284,6 +284,39 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask32x8u m) {
+        #if defined(AVEL_AVX512VL) && defined(AVEL_AVX512BW)
+        return decay(m);
+
+        #elif defined(AVEL_AVX2)
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(decay(m)));
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask32x8u from_bits<mask32x8u>(std::uint64_t bits) {
+        #if defined(AVEL_AVX512VL) && defined(AVEL_AVX512BW)
+        return mask32x8u{static_cast<__mmask32>(bits)};
+
+        #elif defined(AVEL_AVX2)
+        // Each group of eight bytes holds one byte of bits
+        auto t0 = _mm256_set1_epi32(static_cast<std::int32_t>(bits));
+        auto t1 = _mm256_shuffle_epi8(t0, _mm256_setr_epi64x(
+            0x0000000000000000ull,
+            0x0101010101010101ull,
+            0x0202020202020202ull,
+            0x0303030303030303ull
+        ));
+
+        auto weights = _mm256_set1_epi64x(0x8040201008040201ull);
+        return mask32x8u{_mm256_cmpeq_epi8(_mm256_and_si256(t1, weights), weights)};
+
+        #endif
+    }
+
 
 
 
@@ -1344,6 +1377,132 @@ namespace avel {
         return ret;
     }
 
+    //Definition of gather/scatter delayed until now so they may rely on to_array
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec32x8u gather<vec32x8u>(const std::uint8_t* ptr, vec32x8u indices, std::uint32_t n) {
+        #if defined(AVEL_AVX2)
+        auto lo = gather<vec16x8u>(ptr, vec16x8u{_mm256_castsi256_si128(decay(indices))}, n);
+        auto hi = gather<vec16x8u>(ptr, vec16x8u{_mm256_extracti128_si256(decay(indices), 0x1)}, n - min(n, 16u));
+
+        return vec32x8u{_mm256_inserti128_si256(_mm256_castsi128_si256(decay(lo)), decay(hi), 0x1)};
+
+        #endif
+    }
+
+    AVEL_FINL void scatter(std::uint8_t* ptr, vec32x8u x, vec32x8u indices, std::uint32_t n) {
+        // No ISA offers scatters of elements narrower than 32 bits
+        auto index_array = to_array(indices);
+        auto value_array = to_array(x);
+
+        n = min(n, vec32x8u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ptr[index_array[i]] = value_array[i];
+        }
+    }
+
+    template<std::uint32_t N = vec32x8u::width>
+    AVEL_FINL void scatter(std::uint8_t* ptr, vec32x8u x, vec32x8u indices) {
+        static_assert(N <= vec32x8u::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec32x8u::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
+    //=====================================================
+    // Table lookup operations
+    //=====================================================
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 16-entry table.
+    ///
+    /// \param table Vector holding the table's entries
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 16
+    [[nodiscard]]
+    AVEL_FINL vec32x8u lookup16(vec16x8u table, vec32x8u indices) {
+        #if defined(AVEL_AVX2)
+        // Saturating addition sets the high bit of indices which are out of
+        // range without disturbing the low nibble of those which are not,
+        // causing pshufb to zero the corresponding lanes
+        auto t = _mm256_broadcastsi128_si256(decay(table));
+        auto adjusted_indices = _mm256_adds_epu8(decay(indices), _mm256_set1_epi8(0x70));
+        return vec32x8u{_mm256_shuffle_epi8(t, adjusted_indices)};
+
+        #endif
+    }
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 32-entry table.
+    ///
+    /// \param table Vector holding the table's entries
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 32
+    [[nodiscard]]
+    AVEL_FINL vec32x8u lookup32(vec32x8u table, vec32x8u indices) {
+        #if (defined(AVEL_AVX512VL) && defined(AVEL_AVX512VBMI)) || defined(AVEL_AVX10_1)
+        auto in_range = _mm256_cmplt_epu8_mask(decay(indices), _mm256_set1_epi8(32));
+        return vec32x8u{_mm256_maskz_permutexvar_epi8(in_range, decay(indices), decay(table))};
+
+        #elif defined(AVEL_AVX2)
+        auto t0 = _mm256_permute2x128_si256(decay(table), decay(table), 0x00);
+        auto t1 = _mm256_permute2x128_si256(decay(table), decay(table), 0x11);
+
+        // Subtraction wraps indices meant for the first half of the table
+        // around to large values, which saturate to have their high bit set
+        auto offset = _mm256_set1_epi8(0x70);
+        auto indices0 = _mm256_adds_epu8(decay(indices), offset);
+        auto indices1 = _mm256_adds_epu8(_mm256_sub_epi8(decay(indices), _mm256_set1_epi8(16)), offset);
+
+        auto lo = _mm256_shuffle_epi8(t0, indices0);
+        auto hi = _mm256_shuffle_epi8(t1, indices1);
+        return vec32x8u{_mm256_or_si256(lo, hi)};
+
+        #endif
+    }
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 64-entry table.
+    ///
+    /// \param table Vectors holding the table's entries, lowest entries first
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 64
+    [[nodiscard]]
+    AVEL_FINL vec32x8u lookup64(std::array<vec32x8u, 2> table, vec32x8u indices) {
+        #if (defined(AVEL_AVX512VL) && defined(AVEL_AVX512VBMI)) || defined(AVEL_AVX10_1)
+        auto in_range = _mm256_cmplt_epu8_mask(decay(indices), _mm256_set1_epi8(64));
+        auto ret = _mm256_maskz_permutex2var_epi8(in_range, decay(table[0]), decay(indices), decay(table[1]));
+        return vec32x8u{ret};
+
+        #elif defined(AVEL_AVX2)
+        auto lo = lookup32(table[0], indices);
+        auto hi = lookup32(table[1], indices - vec32x8u{32});
+        return lo | hi;
+
+        #endif
+    }
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 128-entry table.
+    ///
+    /// \param table Vectors holding the table's entries, lowest entries first
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 128
+    [[nodiscard]]
+    AVEL_FINL vec32x8u lookup128(std::array<vec32x8u, 4> table, vec32x8u indices) {
+        #if defined(AVEL_AVX2)
+        auto lo = lookup64({table[0], table[1]}, indices);
+        auto hi = lookup64({table[2], table[3]}, indices - vec32x8u{64});
+        return lo | hi;
+
+        #endif
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
@@ -330,6 +330,17 @@ namespace avel {
         return mask4x32i{insert<N>(mask4x32u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask4x32i m) {
+        return to_bits(mask4x32u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask4x32i from_bits<mask4x32i>(std::uint64_t bits) {
+        return mask4x32i{from_bits<mask4x32u>(bits)};
+    }
+
 
 
 
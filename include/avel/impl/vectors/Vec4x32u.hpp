@@ -418,6 +418,53 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask4x32u m) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return decay(m);
+
+        #elif defined(AVEL_SSE2)
+        return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(decay(m))));
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        alignas(16) static constexpr std::uint32_t weight_data[4] {
+            0x1, 0x2, 0x4, 0x8
+        };
+
+        // Narrowing each lane to a single bit with a weighted horizontal add
+        auto t0 = vandq_u32(decay(m), vld1q_u32(weight_data));
+        return vaddvq_u32(t0);
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask4x32u from_bits<mask4x32u>(std::uint64_t bits) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return mask4x32u{static_cast<__mmask8>(bits & 0xF)};
+
+        #elif defined(AVEL_SSE2)
+        auto t0 = _mm_set1_epi32(static_cast<std::int32_t>(bits));
+        auto weights = _mm_setr_epi32(0x1, 0x2, 0x4, 0x8);
+        auto t1 = _mm_cmpeq_epi32(_mm_and_si128(t0, weights), weights);
+        return mask4x32u{t1};
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        alignas(16) static constexpr std::uint32_t weight_data[4] {
+            0x1, 0x2, 0x4, 0x8
+        };
+
+        auto t0 = vdupq_n_u32(static_cast<std::uint32_t>(bits));
+        return mask4x32u{vtstq_u32(t0, vld1q_u32(weight_data))};
+
+        #endif
+    }
+
 
 
 
@@ -288,6 +288,42 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask4x64f m) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return decay(m);
+
+        #elif defined(AVEL_AVX)
+        return static_cast<std::uint32_t>(_mm256_movemask_pd(decay(m)));
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask4x64f from_bits<mask4x64f>(std::uint64_t bits) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return mask4x64f{static_cast<__mmask8>(bits & 0xF)};
+
+        #elif defined(AVEL_AVX2)
+        auto t0 = _mm256_set1_epi64x(static_cast<std::int64_t>(bits));
+        auto weights = _mm256_setr_epi64x(0x1, 0x2, 0x4, 0x8);
+        auto t1 = _mm256_cmpeq_epi64(_mm256_and_si256(t0, weights), weights);
+        return mask4x64f{_mm256_castsi256_pd(t1)};
+
+        #elif defined(AVEL_AVX)
+        // Integer comparisons used on each half since the weights would be
+        // treated as denormals by floating-point comparisons
+        auto t0 = _mm_set1_epi32(static_cast<std::int32_t>(bits));
+        auto weights_lo = _mm_setr_epi32(0x1, 0x1, 0x2, 0x2);
+        auto weights_hi = _mm_setr_epi32(0x4, 0x4, 0x8, 0x8);
+        auto lo = _mm_cmpeq_epi32(_mm_and_si128(t0, weights_lo), weights_lo);
+        auto hi = _mm_cmpeq_epi32(_mm_and_si128(t0, weights_hi), weights_hi);
+        return mask4x64f{_mm256_castsi256_pd(_mm256_setr_m128i(lo, hi))};
+
+        #endif
+    }
+
 
 
 
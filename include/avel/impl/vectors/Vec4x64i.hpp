@@ -264,6 +264,17 @@ namespace avel {
         return mask4x64i{insert<N>(mask4x64u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask4x64i m) {
+        return to_bits(mask4x64u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask4x64i from_bits<mask4x64i>(std::uint64_t bits) {
+        return mask4x64i{from_bits<mask4x64u>(bits)};
+    }
+
 
 
 
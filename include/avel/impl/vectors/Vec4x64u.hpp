@@ -290,6 +290,31 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask4x64u m) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return decay(m);
+
+        #elif defined(AVEL_AVX2)
+        return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(decay(m))));
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask4x64u from_bits<mask4x64u>(std::uint64_t bits) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return mask4x64u{static_cast<__mmask8>(bits & 0xF)};
+
+        #elif defined(AVEL_AVX2)
+        auto t0 = _mm256_set1_epi64x(static_cast<std::int64_t>(bits));
+        auto weights = _mm256_setr_epi64x(0x1, 0x2, 0x4, 0x8);
+        return mask4x64u{_mm256_cmpeq_epi64(_mm256_and_si256(t0, weights), weights)};
+
+        #endif
+    }
+
 
 
 
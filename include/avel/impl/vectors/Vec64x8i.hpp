@@ -227,6 +227,17 @@ namespace avel {
         return mask64x8i{insert<N>(mask64x8u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask64x8i m) {
+        return to_bits(mask64x8u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask64x8i from_bits<mask64x8i>(std::uint64_t bits) {
+        return mask64x8i{from_bits<mask64x8u>(bits)};
+    }
+
 
 
 
@@ -932,6 +943,24 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec64x8i gather<vec64x8i>(const std::int8_t* ptr, vec64x8u indices, std::uint32_t n) {
+        return vec64x8i{gather<vec64x8u>(reinterpret_cast<const std::uint8_t*>(ptr), indices, n)};
+    }
+
+    AVEL_FINL void scatter(std::int8_t* ptr, vec64x8i x, vec64x8u indices, std::uint32_t n) {
+        scatter(reinterpret_cast<std::uint8_t*>(ptr), vec64x8u{x}, indices, n);
+    }
+
+    template<std::uint32_t N = vec64x8i::width>
+    AVEL_FINL void scatter(std::int8_t* ptr, vec64x8i x, vec64x8u indices) {
+        static_assert(N <= vec64x8i::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec64x8i::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
@@ -219,6 +219,17 @@ namespace avel {
         return mask64x8u{__mmask64(decay(m) & ~mask) | mask};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask64x8u m) {
+        return decay(m);
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask64x8u from_bits<mask64x8u>(std::uint64_t bits) {
+        return mask64x8u{static_cast<__mmask64>(bits)};
+    }
+
 
 
 
@@ -1042,6 +1053,150 @@ namespace avel {
         return ret;
     }
 
+    //Definition of gather/scatter delayed until now so they may rely on to_array
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec64x8u gather<vec64x8u>(const std::uint8_t* ptr, vec64x8u indices, std::uint32_t n) {
+        #if defined(AVEL_AVX512BW)
+        n = min(n, vec64x8u::width);
+
+        auto q0 = gather<vec16x8u>(ptr, vec16x8u{_mm512_extracti32x4_epi32(decay(indices), 0x0)}, n);
+        auto q1 = gather<vec16x8u>(ptr, vec16x8u{_mm512_extracti32x4_epi32(decay(indices), 0x1)}, n - min(n, 16u));
+        auto q2 = gather<vec16x8u>(ptr, vec16x8u{_mm512_extracti32x4_epi32(decay(indices), 0x2)}, n - min(n, 32u));
+        auto q3 = gather<vec16x8u>(ptr, vec16x8u{_mm512_extracti32x4_epi32(decay(indices), 0x3)}, n - min(n, 48u));
+
+        auto ret = _mm512_castsi128_si512(decay(q0));
+        ret = _mm512_inserti32x4(ret, decay(q1), 0x1);
+        ret = _mm512_inserti32x4(ret, decay(q2), 0x2);
+        ret = _mm512_inserti32x4(ret, decay(q3), 0x3);
+
+        return vec64x8u{ret};
+
+        #endif
+    }
+
+    AVEL_FINL void scatter(std::uint8_t* ptr, vec64x8u x, vec64x8u indices, std::uint32_t n) {
+        // No ISA offers scatters of elements narrower than 32 bits
+        auto index_array = to_array(indices);
+        auto value_array = to_array(x);
+
+        n = min(n, vec64x8u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ptr[index_array[i]] = value_array[i];
+        }
+    }
+
+    template<std::uint32_t N = vec64x8u::width>
+    AVEL_FINL void scatter(std::uint8_t* ptr, vec64x8u x, vec64x8u indices) {
+        static_assert(N <= vec64x8u::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec64x8u::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
+    //=====================================================
+    // Table lookup operations
+    //=====================================================
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 16-entry table.
+    ///
+    /// \param table Vector holding the table's entries
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 16
+    [[nodiscard]]
+    AVEL_FINL vec64x8u lookup16(vec16x8u table, vec64x8u indices) {
+        #if defined(AVEL_AVX512BW)
+        // Saturating addition sets the high bit of indices which are out of
+        // range without disturbing the low nibble of those which are not,
+        // causing pshufb to zero the corresponding lanes
+        auto t = _mm512_broadcast_i32x4(decay(table));
+        auto adjusted_indices = _mm512_adds_epu8(decay(indices), _mm512_set1_epi8(0x70));
+        return vec64x8u{_mm512_shuffle_epi8(t, adjusted_indices)};
+
+        #endif
+    }
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 32-entry table.
+    ///
+    /// \param table Vector holding the table's entries
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 32
+    [[nodiscard]]
+    AVEL_FINL vec64x8u lookup32(vec32x8u table, vec64x8u indices) {
+        #if defined(AVEL_AVX512BW) && defined(AVEL_AVX512VBMI)
+        // Upper half of the widened table is never selected
+        auto in_range = _mm512_cmplt_epu8_mask(decay(indices), _mm512_set1_epi8(32));
+        auto t = _mm512_castsi256_si512(decay(table));
+        return vec64x8u{_mm512_maskz_permutexvar_epi8(in_range, decay(indices), t)};
+
+        #elif defined(AVEL_AVX512BW)
+        auto t0 = _mm512_broadcast_i32x4(_mm256_castsi256_si128(decay(table)));
+        auto t1 = _mm512_broadcast_i32x4(_mm256_extracti128_si256(decay(table), 0x1));
+
+        // Subtraction wraps indices meant for the first half of the table
+        // around to large values, which saturate to have their high bit set
+        auto offset = _mm512_set1_epi8(0x70);
+        auto indices0 = _mm512_adds_epu8(decay(indices), offset);
+        auto indices1 = _mm512_adds_epu8(_mm512_sub_epi8(decay(indices), _mm512_set1_epi8(16)), offset);
+
+        auto lo = _mm512_shuffle_epi8(t0, indices0);
+        auto hi = _mm512_shuffle_epi8(t1, indices1);
+        return vec64x8u{_mm512_or_si512(lo, hi)};
+
+        #endif
+    }
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 64-entry table.
+    ///
+    /// \param table Vector holding the table's entries
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 64
+    [[nodiscard]]
+    AVEL_FINL vec64x8u lookup64(vec64x8u table, vec64x8u indices) {
+        #if defined(AVEL_AVX512BW) && defined(AVEL_AVX512VBMI)
+        auto in_range = _mm512_cmplt_epu8_mask(decay(indices), _mm512_set1_epi8(64));
+        return vec64x8u{_mm512_maskz_permutexvar_epi8(in_range, decay(indices), decay(table))};
+
+        #elif defined(AVEL_AVX512BW)
+        auto t0 = vec32x8u{_mm512_castsi512_si256(decay(table))};
+        auto t1 = vec32x8u{_mm512_extracti64x4_epi64(decay(table), 0x1)};
+
+        auto lo = lookup32(t0, indices);
+        auto hi = lookup32(t1, indices - vec64x8u{32});
+        return lo | hi;
+
+        #endif
+    }
+
+    ///
+    /// For each lane, uses the value in indices to select an element from a
+    /// 128-entry table.
+    ///
+    /// \param table Vectors holding the table's entries, lowest entries first
+    /// \param indices Vector of indices into table
+    /// \return table[indices[i]] for each lane, or 0 if indices[i] >= 128
+    [[nodiscard]]
+    AVEL_FINL vec64x8u lookup128(std::array<vec64x8u, 2> table, vec64x8u indices) {
+        #if defined(AVEL_AVX512BW) && defined(AVEL_AVX512VBMI)
+        auto in_range = _knot_mask64(_mm512_movepi8_mask(decay(indices)));
+        auto ret = _mm512_maskz_permutex2var_epi8(in_range, decay(table[0]), decay(indices), decay(table[1]));
+        return vec64x8u{ret};
+
+        #elif defined(AVEL_AVX512BW)
+        auto lo = lookup64(table[0], indices);
+        auto hi = lookup64(table[1], indices - vec64x8u{64});
+        return lo | hi;
+
+        #endif
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
@@ -322,6 +322,17 @@ namespace avel {
         return mask8x16i{insert<N>(mask8x16u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask8x16i m) {
+        return to_bits(mask8x16u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask8x16i from_bits<mask8x16i>(std::uint64_t bits) {
+        return mask8x16i{from_bits<mask8x16u>(bits)};
+    }
+
 
 
 
@@ -1505,6 +1516,24 @@ namespace avel {
         return ret;
     }
 
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec8x16i gather<vec8x16i>(const std::int16_t* ptr, vec8x16u indices, std::uint32_t n) {
+        return vec8x16i{gather<vec8x16u>(reinterpret_cast<const std::uint16_t*>(ptr), indices, n)};
+    }
+
+    AVEL_FINL void scatter(std::int16_t* ptr, vec8x16i x, vec8x16u indices, std::uint32_t n) {
+        scatter(reinterpret_cast<std::uint16_t*>(ptr), vec8x16u{x}, indices, n);
+    }
+
+    template<std::uint32_t N = vec8x16i::width>
+    AVEL_FINL void scatter(std::int16_t* ptr, vec8x16i x, vec8x16u indices) {
+        static_assert(N <= vec8x16i::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec8x16i::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
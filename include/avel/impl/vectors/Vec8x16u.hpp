@@ -414,6 +414,52 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask8x16u m) {
+        #if (defined(AVEL_AVX512VL) && defined(AVEL_AVX512BW)) || defined(AVEL_AVX10_1)
+        return decay(m);
+
+        #elif defined(AVEL_SSE2)
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(decay(m), _mm_setzero_si128())));
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        alignas(16) static constexpr std::uint16_t weight_data[8] {
+            0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+        };
+
+        // Narrowing each lane to a single bit with a weighted horizontal add
+        auto t0 = vandq_u16(decay(m), vld1q_u16(weight_data));
+        return vaddvq_u16(t0);
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask8x16u from_bits<mask8x16u>(std::uint64_t bits) {
+        #if (defined(AVEL_AVX512VL) && defined(AVEL_AVX512BW)) || defined(AVEL_AVX10_1)
+        return mask8x16u{static_cast<__mmask8>(bits)};
+
+        #elif defined(AVEL_SSE2)
+        auto t0 = _mm_set1_epi16(static_cast<std::int16_t>(bits));
+        auto weights = _mm_setr_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+        return mask8x16u{_mm_cmpeq_epi16(_mm_and_si128(t0, weights), weights)};
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        alignas(16) static constexpr std::uint16_t weight_data[8] {
+            0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80
+        };
+
+        auto t0 = vdupq_n_u16(static_cast<std::uint16_t>(bits));
+        return mask8x16u{vtstq_u16(t0, vld1q_u16(weight_data))};
+
+        #endif
+    }
+
 
 
 
@@ -1597,7 +1643,7 @@ namespace avel {
     [[nodiscard]]
     AVEL_FINL vec8x16u load<vec8x16u, vec8x16u::width>(const std::uint16_t* ptr) {
         #if defined(AVEL_SSE2)
-        return vec8x16u{_mm_load_si128(reinterpret_cast<const __m128i*>(ptr))};
+        return vec8x16u{_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))};
         #endif
 
         #if defined(AVEL_NEON)
@@ -1717,7 +1763,7 @@ namespace avel {
     template<>
     AVEL_FINL void store<vec8x16u::width>(std::uint16_t* ptr, vec8x16u v) {
         #if defined(AVEL_SSE2)
-        _mm_store_si128(reinterpret_cast<__m128i*>(ptr), decay(v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), decay(v));
         #endif
 
         #if defined(AVEL_NEON)
@@ -1758,6 +1804,93 @@ namespace avel {
         return ret;
     }
 
+    //Definition of gather/scatter delayed until now so they may rely on to_array
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL vec8x16u gather<vec8x16u>(const std::uint16_t* ptr, vec8x16u indices, std::uint32_t n) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        // Elements are extracted from the aligned 32-bit words containing
+        // them so that no read extends past the page holding the element
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        auto misalignment = static_cast<std::int32_t>(address & 0x3);
+        auto base = reinterpret_cast<const void*>(address - misalignment);
+
+        auto offsets = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvtepu16_epi32(decay(indices)), 1), _mm256_set1_epi32(misalignment));
+        auto word_indices = _mm256_srli_epi32(offsets, 2);
+        auto shifts = _mm256_slli_epi32(_mm256_and_si256(offsets, _mm256_set1_epi32(0x2)), 3);
+
+        auto mask = (n >= 8) ? 0xFF : (1 << n) - 1;
+        auto words = _mm256_mmask_i32gather_epi32(_mm256_setzero_si256(), mask, word_indices, base, sizeof(std::uint32_t));
+
+        return vec8x16u{_mm256_cvtepi32_epi16(_mm256_srlv_epi32(words, shifts))};
+
+        #elif defined(AVEL_AVX2)
+        // Elements are extracted from the aligned 32-bit words containing
+        // them so that no read extends past the page holding the element
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        auto misalignment = static_cast<std::int32_t>(address & 0x3);
+        auto base = reinterpret_cast<const int*>(address - misalignment);
+
+        auto offsets = _mm256_add_epi32(_mm256_slli_epi32(_mm256_cvtepu16_epi32(decay(indices)), 1), _mm256_set1_epi32(misalignment));
+        auto word_indices = _mm256_srli_epi32(offsets, 2);
+        auto shifts = _mm256_slli_epi32(_mm256_and_si256(offsets, _mm256_set1_epi32(0x2)), 3);
+
+        auto count = static_cast<std::int32_t>(min(n, vec8x16u::width));
+        auto mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        auto words = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), base, word_indices, mask, sizeof(std::uint32_t));
+
+        auto elements = _mm256_and_si256(_mm256_srlv_epi32(words, shifts), _mm256_set1_epi32(0xFFFF));
+        auto ret = _mm_packus_epi32(_mm256_castsi256_si128(elements), _mm256_extracti128_si256(elements, 0x1));
+
+        return vec8x16u{ret};
+
+        #elif defined(AVEL_SSE2)
+        auto index_array = to_array(indices);
+
+        arr8x16u ret{};
+        n = min(n, vec8x16u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ret[i] = ptr[index_array[i]];
+        }
+
+        return vec8x16u{ret};
+
+        #endif
+
+        #if defined(AVEL_NEON)
+        auto index_array = to_array(indices);
+
+        arr8x16u ret{};
+        n = min(n, vec8x16u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ret[i] = ptr[index_array[i]];
+        }
+
+        return vec8x16u{ret};
+
+        #endif
+    }
+
+    AVEL_FINL void scatter(std::uint16_t* ptr, vec8x16u x, vec8x16u indices, std::uint32_t n) {
+        // No ISA offers scatters of elements narrower than 32 bits
+        auto index_array = to_array(indices);
+        auto value_array = to_array(x);
+
+        n = min(n, vec8x16u::width);
+        for (std::uint32_t i = 0; i < n; ++i) {
+            ptr[index_array[i]] = value_array[i];
+        }
+    }
+
+    template<std::uint32_t N = vec8x16u::width>
+    AVEL_FINL void scatter(std::uint16_t* ptr, vec8x16u x, vec8x16u indices) {
+        static_assert(N <= vec8x16u::width, "Cannot store more elements than width of vector");
+        typename std::enable_if<N <= vec8x16u::width, int>::type dummy_variable = 0;
+
+        scatter(ptr, x, indices, N);
+    }
+
     //=====================================================
     // Integer vector operations
     //=====================================================
@@ -277,6 +277,42 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask8x32f m) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return decay(m);
+
+        #elif defined(AVEL_AVX)
+        return static_cast<std::uint32_t>(_mm256_movemask_ps(decay(m)));
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask8x32f from_bits<mask8x32f>(std::uint64_t bits) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return mask8x32f{static_cast<__mmask8>(bits)};
+
+        #elif defined(AVEL_AVX2)
+        auto t0 = _mm256_set1_epi32(static_cast<std::int32_t>(bits));
+        auto weights = _mm256_setr_epi32(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+        auto t1 = _mm256_cmpeq_epi32(_mm256_and_si256(t0, weights), weights);
+        return mask8x32f{_mm256_castsi256_ps(t1)};
+
+        #elif defined(AVEL_AVX)
+        // Integer comparisons used on each half since the weights would be
+        // treated as denormals by floating-point comparisons
+        auto t0 = _mm_set1_epi32(static_cast<std::int32_t>(bits));
+        auto weights_lo = _mm_setr_epi32(0x01, 0x02, 0x04, 0x08);
+        auto weights_hi = _mm_setr_epi32(0x10, 0x20, 0x40, 0x80);
+        auto lo = _mm_cmpeq_epi32(_mm_and_si128(t0, weights_lo), weights_lo);
+        auto hi = _mm_cmpeq_epi32(_mm_and_si128(t0, weights_hi), weights_hi);
+        return mask8x32f{_mm256_castsi256_ps(_mm256_setr_m128i(lo, hi))};
+
+        #endif
+    }
+
 
 
 
@@ -263,6 +263,17 @@ namespace avel {
         return mask8x32i{insert<N>(mask8x32u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask8x32i m) {
+        return to_bits(mask8x32u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask8x32i from_bits<mask8x32i>(std::uint64_t bits) {
+        return mask8x32i{from_bits<mask8x32u>(bits)};
+    }
+
 
 
     template<>
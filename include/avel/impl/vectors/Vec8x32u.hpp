@@ -286,6 +286,31 @@ namespace avel {
         #endif
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask8x32u m) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return decay(m);
+
+        #elif defined(AVEL_AVX2)
+        return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(decay(m))));
+
+        #endif
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask8x32u from_bits<mask8x32u>(std::uint64_t bits) {
+        #if defined(AVEL_AVX512VL) || defined(AVEL_AVX10_1)
+        return mask8x32u{static_cast<__mmask8>(bits)};
+
+        #elif defined(AVEL_AVX2)
+        auto t0 = _mm256_set1_epi32(static_cast<std::int32_t>(bits));
+        auto weights = _mm256_setr_epi32(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+        return mask8x32u{_mm256_cmpeq_epi32(_mm256_and_si256(t0, weights), weights)};
+
+        #endif
+    }
+
 
 
 
@@ -211,6 +211,17 @@ namespace avel {
         return mask8x64f{__mmask8((decay(m) & ~mask) | mask)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask8x64f m) {
+        return decay(m);
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask8x64f from_bits<mask8x64f>(std::uint64_t bits) {
+        return mask8x64f{static_cast<__mmask8>(bits)};
+    }
+
 
 
 
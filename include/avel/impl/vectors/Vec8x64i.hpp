@@ -245,6 +245,17 @@ namespace avel {
         return mask8x64i{insert<N>(mask8x64u{m}, b)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask8x64i m) {
+        return to_bits(mask8x64u{m});
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask8x64i from_bits<mask8x64i>(std::uint64_t bits) {
+        return mask8x64i{from_bits<mask8x64u>(bits)};
+    }
+
 
 
 
@@ -248,6 +248,17 @@ namespace avel {
         return mask8x64u{__mmask8((decay(m) & ~mask) | mask)};
     }
 
+    [[nodiscard]]
+    AVEL_FINL std::uint64_t to_bits(mask8x64u m) {
+        return decay(m);
+    }
+
+    template<>
+    [[nodiscard]]
+    AVEL_FINL mask8x64u from_bits<mask8x64u>(std::uint64_t bits) {
+        return mask8x64u{static_cast<__mmask8>(bits)};
+    }
+
 
 
 
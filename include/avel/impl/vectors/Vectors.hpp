@@ -3,7 +3,9 @@
 
 #include <cmath>
 #include <cfloat>
+#include <cstring>
 #include <array>
+#include <atomic>
 
 #if defined(AVEL_NEON) && (__cplusplus >= 202002)
 #include <memory> //Necessary to use std::assume_aligned
@@ -97,6 +99,20 @@ namespace avel {
         return gather<V>(ptr, indices, N);
     }
 
+    //=====================================================
+    // Mask Functions
+    //=====================================================
+
+    ///
+    /// Constructs a mask whose nth lane is set if the nth bit of bits is set.
+    /// Bits at positions at or above the mask's width are ignored.
+    ///
+    /// \tparam M Mask type to construct
+    /// \param bits Bitmask to convert
+    /// \return Mask with lanes set according to bits
+    template<class M>
+    M from_bits(std::uint64_t bits);
+
     //=====================================================
     // Misc. Functions
     //=====================================================
@@ -412,6 +428,13 @@ namespace avel {
     #include "Vec32x16i.hpp"
 #endif
 
+// Functionality implemented generically on top of the above vector types
+
+#include "Scans.hpp"
+#include "Masks.hpp"
+#include "Streaming.hpp"
+#include "Hashing.hpp"
+
 
 
 /*
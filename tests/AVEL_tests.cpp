@@ -25,6 +25,16 @@
     #include "Denominator_vector_tests.hpp"
 #endif
 
+
+
+#ifndef AVEL_ENABLE_RANDOM_TESTS
+    #define AVEL_ENABLE_RANDOM_TESTS true
+#endif
+
+#if AVEL_ENABLE_RANDOM_TESTS
+    #include "Random_tests.hpp"
+#endif
+
 //=========================================================
 // GTest configurable printer
 //=========================================================
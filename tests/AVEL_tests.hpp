@@ -44,6 +44,7 @@
 #include <avel/Vector.hpp>
 #include <avel/Scalar_denominator.hpp>
 #include <avel/Vector_denominator.hpp>
+#include <avel/Random.hpp>
 
 #include "Test_utils.hpp"
 
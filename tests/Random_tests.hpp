@@ -0,0 +1,408 @@
+#ifndef AVEL_RANDOM_TESTS_HPP
+#define AVEL_RANDOM_TESTS_HPP
+
+#include <cmath>
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t random_test_draws = 1000;
+
+    //=====================================================
+    // Reference implementations
+    //=====================================================
+
+    struct Xoshiro128_plus_reference {
+        std::uint32_t s[4];
+
+        std::uint32_t operator()() {
+            std::uint32_t ret = s[0] + s[3];
+            std::uint32_t t = s[1] << 9;
+
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+
+            s[2] ^= t;
+            s[3] = (s[3] << 11) | (s[3] >> 21);
+
+            return ret;
+        }
+    };
+
+    struct Xoshiro256_plus_reference {
+        std::uint64_t s[4];
+
+        std::uint64_t operator()() {
+            std::uint64_t ret = s[0] + s[3];
+            std::uint64_t t = s[1] << 17;
+
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+
+            s[2] ^= t;
+            s[3] = (s[3] << 45) | (s[3] >> 19);
+
+            return ret;
+        }
+    };
+
+    struct Pcg32_reference {
+        std::uint64_t state;
+        std::uint64_t inc;
+
+        Pcg32_reference(std::uint64_t initstate, std::uint64_t initseq) {
+            state = 0;
+            inc = (initseq << 1) | 1;
+            (*this)();
+            state += initstate;
+            (*this)();
+        }
+
+        std::uint32_t operator()() {
+            std::uint64_t old = state;
+            state = old * 6364136223846793005ull + inc;
+            auto xorshifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+            auto rot = static_cast<std::uint32_t>(old >> 59);
+            return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+        }
+    };
+
+    inline std::array<std::uint32_t, 4> philox_reference(std::array<std::uint32_t, 4> ctr, std::array<std::uint32_t, 2> key) {
+        for (std::size_t i = 0; i < 10; ++i) {
+            std::uint64_t p0 = std::uint64_t(0xD2511F53) * ctr[0];
+            std::uint64_t p1 = std::uint64_t(0xCD9E8D57) * ctr[2];
+
+            ctr = {
+                std::uint32_t(p1 >> 32) ^ ctr[1] ^ key[0],
+                std::uint32_t(p1),
+                std::uint32_t(p0 >> 32) ^ ctr[3] ^ key[1],
+                std::uint32_t(p0)
+            };
+
+            key[0] += 0x9E3779B9;
+            key[1] += 0xBB67AE85;
+        }
+
+        return ctr;
+    }
+
+    inline std::uint64_t splitmix64_reference(std::uint64_t& state) {
+        std::uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    inline std::vector<Xoshiro128_plus_reference> xoshiro128_plus_lanes(std::uint64_t seed, std::size_t n) {
+        std::vector<Xoshiro128_plus_reference> ret(n);
+        for (auto& lane : ret) {
+            for (std::size_t j = 0; j < 4; j += 2) {
+                auto x = splitmix64_reference(seed);
+                lane.s[j + 0] = static_cast<std::uint32_t>(x);
+                lane.s[j + 1] = static_cast<std::uint32_t>(x >> 32);
+            }
+        }
+
+        return ret;
+    }
+
+    //=====================================================
+    // Known answers
+    //=====================================================
+
+    TEST(Random, Reference_known_answers) {
+        // Outputs listed by the authors of each generator
+        Pcg32_reference pcg{42, 54};
+        for (std::uint32_t x : {0xa15c02b7u, 0x7b47f409u, 0xba1d3330u, 0x83d2f293u, 0xbfa4784bu, 0xcbed606eu}) {
+            EXPECT_EQ(x, pcg());
+        }
+
+        auto zeros = philox_reference({0, 0, 0, 0}, {0, 0});
+        EXPECT_EQ((std::array<std::uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}), zeros);
+
+        auto ones = philox_reference({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff});
+        EXPECT_EQ((std::array<std::uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}), ones);
+
+        auto pi = philox_reference({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0});
+        EXPECT_EQ((std::array<std::uint32_t, 4>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}), pi);
+    }
+
+    //=====================================================
+    // Generators
+    //=====================================================
+
+    template<std::uint32_t N>
+    void test_xoshiro128_plus(std::uint64_t seed) {
+        Xoshiro128_plus<N> gen{seed};
+        auto lanes = xoshiro128_plus_lanes(seed, N);
+
+        for (std::size_t i = 0; i < random_test_draws; ++i) {
+            auto results = to_array(gen());
+            for (std::size_t j = 0; j < N; ++j) {
+                EXPECT_EQ(lanes[j](), results[j]);
+            }
+        }
+    }
+
+    template<std::uint32_t N>
+    void test_xoshiro256_plus(std::uint64_t seed) {
+        Xoshiro256_plus<N> gen{seed};
+
+        std::vector<Xoshiro256_plus_reference> lanes(N);
+        for (auto& lane : lanes) {
+            for (auto& word : lane.s) {
+                word = splitmix64_reference(seed);
+            }
+        }
+
+        for (std::size_t i = 0; i < random_test_draws; ++i) {
+            auto results = to_array(gen());
+            for (std::size_t j = 0; j < N; ++j) {
+                EXPECT_EQ(lanes[j](), results[j]);
+            }
+        }
+    }
+
+    template<std::uint32_t N>
+    void test_pcg32(std::uint64_t seed) {
+        Pcg32<N> gen{seed};
+
+        std::vector<Pcg32_reference> lanes;
+        for (std::size_t j = 0; j < N; ++j) {
+            auto initstate = splitmix64_reference(seed);
+            auto initseq = splitmix64_reference(seed);
+            lanes.emplace_back(initstate, initseq);
+        }
+
+        for (std::size_t i = 0; i < random_test_draws; ++i) {
+            auto results = to_array(gen());
+            for (std::size_t j = 0; j < N; ++j) {
+                EXPECT_EQ(lanes[j](), results[j]);
+            }
+        }
+    }
+
+    template<std::uint32_t N>
+    void test_philox(std::uint64_t seed, std::uint64_t counter) {
+        Philox4x32<N> gen{seed, counter};
+        std::array<std::uint32_t, 2> key{std::uint32_t(seed), std::uint32_t(seed >> 32)};
+
+        for (std::size_t i = 0; i < random_test_draws / 4; ++i) {
+            std::array<std::array<std::uint32_t, N>, 4> words;
+            for (auto& w : words) {
+                w = to_array(gen());
+            }
+
+            for (std::size_t j = 0; j < N; ++j) {
+                std::uint64_t c = counter + i * N + j;
+                auto expected = philox_reference({std::uint32_t(c), std::uint32_t(c >> 32), 0, 0}, key);
+
+                for (std::size_t k = 0; k < 4; ++k) {
+                    EXPECT_EQ(expected[k], words[k][j]);
+                }
+            }
+        }
+    }
+
+    TEST(Random, Xoshiro128_plus) {
+        test_xoshiro128_plus<1>(0x0123456789ABCDEFull);
+
+        #if defined(AVEL_SSE2) || defined(AVEL_NEON)
+        test_xoshiro128_plus<4>(0x0123456789ABCDEFull);
+        #endif
+
+        #if defined(AVEL_AVX2)
+        test_xoshiro128_plus<8>(0x0123456789ABCDEFull);
+        #endif
+
+        #if defined(AVEL_AVX512F)
+        test_xoshiro128_plus<16>(0x0123456789ABCDEFull);
+        #endif
+    }
+
+    TEST(Random, Xoshiro256_plus) {
+        test_xoshiro256_plus<1>(0xFEDCBA9876543210ull);
+
+        #if defined(AVEL_SSE2) || defined(AVEL_NEON)
+        test_xoshiro256_plus<2>(0xFEDCBA9876543210ull);
+        #endif
+
+        #if defined(AVEL_AVX2)
+        test_xoshiro256_plus<4>(0xFEDCBA9876543210ull);
+        #endif
+
+        #if defined(AVEL_AVX512F)
+        test_xoshiro256_plus<8>(0xFEDCBA9876543210ull);
+        #endif
+    }
+
+    TEST(Random, Pcg32) {
+        test_pcg32<1>(42);
+
+        #if defined(AVEL_SSE2) || defined(AVEL_NEON)
+        test_pcg32<4>(42);
+        #endif
+
+        #if defined(AVEL_AVX2)
+        test_pcg32<8>(42);
+        #endif
+
+        #if defined(AVEL_AVX512F)
+        test_pcg32<16>(42);
+        #endif
+    }
+
+    TEST(Random, Philox4x32) {
+        // The second counter makes the low words of some lanes wrap around
+        test_philox<1>(0xA4093822299F31D0ull, 0);
+        test_philox<1>(0xA4093822299F31D0ull, 0xFFFFFFF0ull);
+
+        #if defined(AVEL_SSE2) || defined(AVEL_NEON)
+        test_philox<4>(0xA4093822299F31D0ull, 0);
+        test_philox<4>(0xA4093822299F31D0ull, 0xFFFFFFF0ull);
+        #endif
+
+        #if defined(AVEL_AVX2)
+        test_philox<8>(0xA4093822299F31D0ull, 0);
+        test_philox<8>(0xA4093822299F31D0ull, 0xFFFFFFF0ull);
+        #endif
+
+        #if defined(AVEL_AVX512F)
+        test_philox<16>(0xA4093822299F31D0ull, 0);
+        test_philox<16>(0xA4093822299F31D0ull, 0xFFFFFFF0ull);
+        #endif
+    }
+
+    //=====================================================
+    // Distributions
+    //=====================================================
+
+    TEST(Random, Uniform_float) {
+        Xoshiro128_plus<> gen{1};
+        auto lanes = xoshiro128_plus_lanes(1, vecNx32u::width);
+
+        double sum = 0.0;
+        for (std::size_t i = 0; i < random_test_draws; ++i) {
+            auto results = to_array(uniform_float(gen));
+            for (std::size_t j = 0; j < results.size(); ++j) {
+                EXPECT_EQ(float(lanes[j]() >> 9) / 8388608.0f, results[j]);
+                EXPECT_LE(0.0f, results[j]);
+                EXPECT_LT(results[j], 1.0f);
+                sum += results[j];
+            }
+        }
+
+        EXPECT_NEAR(0.5, sum / (random_test_draws * vecNx32u::width), 0.02);
+    }
+
+    TEST(Random, Uniform_double) {
+        Xoshiro256_plus<> gen{2};
+
+        double sum = 0.0;
+        for (std::size_t i = 0; i < random_test_draws; ++i) {
+            auto results = to_array(uniform_double(gen));
+            for (auto x : results) {
+                EXPECT_LE(0.0, x);
+                EXPECT_LT(x, 1.0);
+                sum += x;
+            }
+        }
+
+        EXPECT_NEAR(0.5, sum / (random_test_draws * vecNx64u::width), 0.02);
+    }
+
+    TEST(Random, Uniform_int_small_bound) {
+        // With a bound this small, rejection has a negligible probability,
+        // so each result is the high half of a single product
+        Xoshiro128_plus<> gen{3};
+        auto lanes = xoshiro128_plus_lanes(3, vecNx32u::width);
+
+        std::vector<std::size_t> counts(10, 0);
+        for (std::size_t i = 0; i < random_test_draws; ++i) {
+            auto results = to_array(uniform_int(gen, 10));
+            for (std::size_t j = 0; j < results.size(); ++j) {
+                EXPECT_EQ(std::uint32_t((std::uint64_t(lanes[j]()) * 10) >> 32), results[j]);
+                ++counts[results[j]];
+            }
+        }
+
+        for (auto c : counts) {
+            EXPECT_NEAR(random_test_draws * vecNx32u::width / 10.0, double(c), random_test_draws * vecNx32u::width / 50.0);
+        }
+    }
+
+    TEST(Random, Uniform_int_large_bound) {
+        // Just under half of all products are rejected for this bound. The
+        // two halves of the range must still be equally likely
+        const std::uint32_t bound = 0x80000001;
+        Pcg32<> gen{4};
+
+        std::size_t low = 0;
+        for (std::size_t i = 0; i < random_test_draws; ++i) {
+            for (auto x : to_array(uniform_int(gen, bound))) {
+                EXPECT_LT(x, bound);
+                low += (x < bound / 2);
+            }
+        }
+
+        EXPECT_NEAR(0.5, double(low) / (random_test_draws * vecNx32u::width), 0.02);
+
+        for (std::size_t i = 0; i < random_test_draws; ++i) {
+            EXPECT_TRUE(all(uniform_int(gen, 1) == vecNx32u{0x00}));
+        }
+    }
+
+    TEST(Random, Normal) {
+        Philox4x32<natural_width_32f> gen{5};
+        Philox4x32<natural_width_32f> reference{5};
+        Normal_distribution<natural_width_32f> dist;
+
+        double sum = 0.0;
+        double sum_squares = 0.0;
+        const double half_pi = 1.57079632679489662;
+
+        for (std::size_t i = 0; i < random_test_draws; ++i) {
+            auto u_bits = to_array(reference());
+            auto angle_bits = to_array(reference());
+
+            auto z0 = to_array(dist(gen));
+            auto z1 = to_array(dist(gen));
+
+            for (std::size_t j = 0; j < z0.size(); ++j) {
+                double u = 1.0 - double(u_bits[j] >> 9) / 8388608.0;
+                double radius = std::sqrt(-2.0 * std::log(u));
+                double angle = (double(angle_bits[j] >> 30) + double((angle_bits[j] << 2) >> 9) / 8388608.0 - 0.5) * half_pi;
+
+                EXPECT_NEAR(radius * std::cos(angle), z0[j], 2e-5);
+                EXPECT_NEAR(radius * std::sin(angle), z1[j], 2e-5);
+
+                sum += double(z0[j]) + double(z1[j]);
+                sum_squares += double(z0[j]) * z0[j] + double(z1[j]) * z1[j];
+            }
+        }
+
+        double n = 2.0 * random_test_draws * natural_width_32f;
+        EXPECT_NEAR(0.0, sum / n, 0.05);
+        EXPECT_NEAR(1.0, sum_squares / n, 0.05);
+
+        Normal_distribution<natural_width_32f> scaled{10.0f, 2.0f};
+        Philox4x32<natural_width_32f> gen_scaled{5};
+        Philox4x32<natural_width_32f> gen_unit{5};
+        Normal_distribution<natural_width_32f> unit;
+        for (std::size_t i = 0; i < 4; ++i) {
+            auto expected = to_array(unit(gen_unit));
+            auto results = to_array(scaled(gen_scaled));
+            for (std::size_t j = 0; j < results.size(); ++j) {
+                EXPECT_NEAR(10.0f + 2.0f * expected[j], results[j], 1e-4);
+            }
+        }
+    }
+
+}
+
+#endif //AVEL_RANDOM_TESTS_HPP
@@ -0,0 +1,186 @@
+#include "../AVEL_tests.hpp"
+
+#include <vector>
+#include <numeric>
+
+#include <avel/Algorithms.hpp>
+#include <avel/Aligned_allocator.hpp>
+
+
+// Test toggles
+
+/*
+#define AVEL_ENABLE_VECTORIZED_VIEW_TESTS true
+#define AVEL_ENABLE_SCAN_TESTS true
+#define AVEL_ENABLE_REDUCE_TESTS true
+#define AVEL_ENABLE_TRANSFORM_TESTS true
+#define AVEL_ENABLE_FIND_TESTS true
+#define AVEL_ENABLE_PARTITION_TESTS true
+#define AVEL_ENABLE_SORT_TESTS true
+#define AVEL_ENABLE_SET_OPERATION_TESTS true
+#define AVEL_ENABLE_HISTOGRAM_TESTS true
+#define AVEL_ENABLE_EXTREMA_TESTS true
+#define AVEL_ENABLE_PARALLEL_TESTS true
+#define AVEL_ENABLE_ALIGNMENT_TESTS true
+#define AVEL_ENABLE_SEARCH_TESTS true
+#define AVEL_ENABLE_UNICODE_TESTS true
+#define AVEL_ENABLE_BASE64_TESTS true
+#define AVEL_ENABLE_DECIMAL_TESTS true
+#define AVEL_ENABLE_HEX_TESTS true
+#define AVEL_ENABLE_CRC_TESTS true
+#define AVEL_ENABLE_BITMAP_TESTS true
+*/
+
+
+
+#ifndef AVEL_ENABLE_VECTORIZED_VIEW_TESTS
+    #define AVEL_ENABLE_VECTORIZED_VIEW_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_SCAN_TESTS
+    #define AVEL_ENABLE_SCAN_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_REDUCE_TESTS
+    #define AVEL_ENABLE_REDUCE_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_TRANSFORM_TESTS
+    #define AVEL_ENABLE_TRANSFORM_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_FIND_TESTS
+    #define AVEL_ENABLE_FIND_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_PARTITION_TESTS
+    #define AVEL_ENABLE_PARTITION_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_SORT_TESTS
+    #define AVEL_ENABLE_SORT_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_SET_OPERATION_TESTS
+    #define AVEL_ENABLE_SET_OPERATION_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_HISTOGRAM_TESTS
+    #define AVEL_ENABLE_HISTOGRAM_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_EXTREMA_TESTS
+    #define AVEL_ENABLE_EXTREMA_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_PARALLEL_TESTS
+    #define AVEL_ENABLE_PARALLEL_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_ALIGNMENT_TESTS
+    #define AVEL_ENABLE_ALIGNMENT_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_SEARCH_TESTS
+    #define AVEL_ENABLE_SEARCH_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_UNICODE_TESTS
+    #define AVEL_ENABLE_UNICODE_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_BASE64_TESTS
+    #define AVEL_ENABLE_BASE64_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_DECIMAL_TESTS
+    #define AVEL_ENABLE_DECIMAL_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_HEX_TESTS
+    #define AVEL_ENABLE_HEX_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_CRC_TESTS
+    #define AVEL_ENABLE_CRC_TESTS true
+#endif
+
+#ifndef AVEL_ENABLE_BITMAP_TESTS
+    #define AVEL_ENABLE_BITMAP_TESTS true
+#endif
+
+#if AVEL_ENABLE_VECTORIZED_VIEW_TESTS
+    #include "Vectorized_view_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_SCAN_TESTS
+    #include "Scan_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_REDUCE_TESTS
+    #include "Reduce_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_TRANSFORM_TESTS
+    #include "Transform_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_FIND_TESTS
+    #include "Find_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_PARTITION_TESTS
+    #include "Partition_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_SORT_TESTS
+    #include "Sort_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_SET_OPERATION_TESTS
+    #include "Set_operation_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_HISTOGRAM_TESTS
+    #include "Histogram_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_EXTREMA_TESTS
+    #include "Extrema_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_PARALLEL_TESTS
+    #include "Parallel_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_ALIGNMENT_TESTS
+    #include "Alignment_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_SEARCH_TESTS
+    #include "Search_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_UNICODE_TESTS
+    #include "Unicode_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_BASE64_TESTS
+    #include "Base64_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_DECIMAL_TESTS
+    #include "Decimal_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_HEX_TESTS
+    #include "Hex_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_CRC_TESTS
+    #include "Crc_tests.hpp"
+#endif
+
+#if AVEL_ENABLE_BITMAP_TESTS
+    #include "Bitmap_tests.hpp"
+#endif
@@ -0,0 +1,103 @@
+#ifndef AVEL_ALIGNMENT_TESTS_HPP
+#define AVEL_ALIGNMENT_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t alignment_test_size = 256 + 5;
+
+    //=====================================================
+    // Peel computation
+    //=====================================================
+
+    TEST(Alignment, Peel_reaches_alignment) {
+        using vec = vecNx32f;
+
+        alignas(alignof(vec)) float data[8 * vec::width]{};
+
+        for (std::size_t offset = 0; offset < vec::width; ++offset) {
+            auto peel = avel_impl::peel<vec, alignof(float)>(data + offset, 4 * vec::width);
+
+            EXPECT_TRUE(peel.aligned);
+            EXPECT_LT(peel.head, std::size_t(vec::width));
+            EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(data + offset + peel.head) % alignof(vec));
+        }
+
+        // Views too short to be worth peeling
+        auto peel = avel_impl::peel<vec, alignof(float)>(data + 1, vec::width);
+        EXPECT_EQ(0, peel.head);
+        EXPECT_EQ(alignof(vec) <= alignof(float), peel.aligned);
+
+        // Views already known to be aligned
+        peel = avel_impl::peel<vec, alignof(vec)>(data, 1);
+        EXPECT_EQ(0, peel.head);
+        EXPECT_TRUE(peel.aligned);
+    }
+
+    //=====================================================
+    // Peeled algorithms
+    //=====================================================
+
+    template<class T>
+    void test_peeled_algorithms() {
+        using vec = Natural_width_vector<T>;
+
+        std::vector<T, Aligned_allocator<T, alignof(vec)>> data(alignment_test_size + vec::width);
+        for (auto& x : data) {
+            x = T(random32u() % 32);
+        }
+
+        // Every offset into an aligned buffer produces a different head
+        for (std::size_t offset = 0; offset < vec::width; ++offset) {
+            for (std::size_t n = 0; n < alignment_test_size; n += 1 + (n / 8)) {
+                const T* ptr = data.data() + offset;
+                Vectorized_view<const T> view{ptr, n};
+
+                T expected_sum = T(0);
+                for (std::size_t i = 0; i < n; ++i) {
+                    expected_sum = T(expected_sum + ptr[i]);
+                }
+                EXPECT_EQ(expected_sum, reduce(view));
+
+                auto expected_find = std::size_t(std::find(ptr, ptr + n, T(0)) - ptr);
+                EXPECT_EQ(expected_find, find(view, T(0)));
+
+                auto expected_count = std::size_t(std::count(ptr, ptr + n, T(7)));
+                EXPECT_EQ(expected_count, count(view, T(7)));
+
+                std::vector<T, Aligned_allocator<T, alignof(vec)>> out(n + vec::width + 1, T(99));
+                transform(view, Vectorized_view<T>{out.data() + offset, n}, [] (vec v) {
+                    return v + vec{T(1)};
+                });
+
+                for (std::size_t i = 0; i < offset; ++i) {
+                    EXPECT_EQ(T(99), out[i]);
+                }
+                for (std::size_t i = 0; i < n; ++i) {
+                    EXPECT_EQ(T(ptr[i] + 1), out[offset + i]);
+                }
+                EXPECT_EQ(T(99), out[offset + n]);
+            }
+        }
+    }
+
+    TEST(Alignment, Peeled_algorithms_8u) {
+        test_peeled_algorithms<std::uint8_t>();
+    }
+
+    TEST(Alignment, Peeled_algorithms_16i) {
+        test_peeled_algorithms<std::int16_t>();
+    }
+
+    TEST(Alignment, Peeled_algorithms_32f) {
+        test_peeled_algorithms<float>();
+    }
+
+    TEST(Alignment, Peeled_algorithms_64u) {
+        test_peeled_algorithms<std::uint64_t>();
+    }
+
+}
+
+#endif //AVEL_ALIGNMENT_TESTS_HPP
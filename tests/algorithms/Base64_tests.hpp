@@ -0,0 +1,177 @@
+#ifndef AVEL_BASE64_TESTS_HPP
+#define AVEL_BASE64_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t base64_test_size = 300;
+
+    //=====================================================
+    // Reference implementation
+    //=====================================================
+
+    inline std::string base64_encode_reference(const std::vector<std::uint8_t>& data, Base64_alphabet alphabet, bool padding) {
+        std::string digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+        digits += (alphabet == Base64_alphabet::standard) ? "+/" : "-_";
+
+        std::string ret;
+        for (std::size_t i = 0; i < data.size(); i += 3) {
+            std::uint32_t bits = std::uint32_t(data[i]) << 16;
+            std::size_t count = std::min<std::size_t>(3, data.size() - i);
+            if (count > 1) {
+                bits |= std::uint32_t(data[i + 1]) << 8;
+            }
+            if (count > 2) {
+                bits |= data[i + 2];
+            }
+
+            for (std::size_t j = 0; j < count + 1; ++j) {
+                ret += digits[(bits >> (18 - 6 * j)) & 0x3F];
+            }
+
+            if (padding) {
+                ret.append(3 - count, '=');
+            }
+        }
+
+        return ret;
+    }
+
+    inline std::string base64_encode_test(const std::vector<std::uint8_t>& data, Base64_alphabet alphabet, bool padding) {
+        std::vector<std::uint8_t> out(base64_encoded_size(data.size(), padding) + 1, 0xFF);
+        auto written = base64_encode(
+            Vectorized_view<const std::uint8_t>{data.data(), data.size()},
+            Vectorized_view<std::uint8_t>{out.data(), out.size() - 1},
+            alphabet,
+            padding
+        );
+
+        EXPECT_EQ(out.size() - 1, written);
+        EXPECT_EQ(0xFF, out.back());
+
+        return std::string(out.begin(), out.begin() + written);
+    }
+
+    inline Transcode_result base64_decode_test(const std::string& str, std::vector<std::uint8_t>& out, Base64_alphabet alphabet) {
+        Vectorized_view<const std::uint8_t> in{reinterpret_cast<const std::uint8_t*>(str.data()), str.size()};
+
+        out.assign(base64_decoded_size(in), 0);
+        return base64_decode(in, Vectorized_view<std::uint8_t>{out.data(), out.size()}, alphabet);
+    }
+
+    //=====================================================
+    // Encoding and decoding
+    //=====================================================
+
+    inline void test_base64_round_trip(Base64_alphabet alphabet, bool padding) {
+        for (std::size_t n = 0; n < base64_test_size; ++n) {
+            std::vector<std::uint8_t> data(n);
+            for (auto& x : data) {
+                x = random8u();
+            }
+
+            auto expected = base64_encode_reference(data, alphabet, padding);
+            auto encoded = base64_encode_test(data, alphabet, padding);
+            EXPECT_EQ(expected, encoded);
+
+            std::vector<std::uint8_t> decoded;
+            auto result = base64_decode_test(encoded, decoded, alphabet);
+
+            EXPECT_EQ(encoded.size(), result.read);
+            EXPECT_EQ(n, result.written);
+            EXPECT_EQ(data, decoded);
+        }
+    }
+
+    TEST(Base64, Round_trip_standard) {
+        test_base64_round_trip(Base64_alphabet::standard, true);
+    }
+
+    TEST(Base64, Round_trip_standard_unpadded) {
+        test_base64_round_trip(Base64_alphabet::standard, false);
+    }
+
+    TEST(Base64, Round_trip_url_safe) {
+        test_base64_round_trip(Base64_alphabet::url_safe, false);
+    }
+
+    TEST(Base64, Round_trip_url_safe_padded) {
+        test_base64_round_trip(Base64_alphabet::url_safe, true);
+    }
+
+    TEST(Base64, Known_values) {
+        const char* expected[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=", "Zm9vYmFy"};
+        std::string input = "foobar";
+
+        for (std::size_t n = 0; n <= input.size(); ++n) {
+            std::vector<std::uint8_t> data(input.begin(), input.begin() + n);
+            EXPECT_EQ(std::string(expected[n]), base64_encode_test(data, Base64_alphabet::standard, true));
+        }
+
+        std::vector<std::uint8_t> data{0xFB, 0xFF, 0xBF};
+        EXPECT_EQ("+/+/", base64_encode_test(data, Base64_alphabet::standard, true));
+        EXPECT_EQ("-_-_", base64_encode_test(data, Base64_alphabet::url_safe, true));
+    }
+
+    //=====================================================
+    // Invalid input
+    //=====================================================
+
+    TEST(Base64, Invalid_characters) {
+        std::vector<std::uint8_t> data(150);
+        for (auto& x : data) {
+            x = random8u();
+        }
+
+        for (auto alphabet : {Base64_alphabet::standard, Base64_alphabet::url_safe}) {
+            auto encoded = base64_encode_test(data, alphabet, true);
+
+            const std::string digits =
+                std::string("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789") +
+                ((alphabet == Base64_alphabet::standard) ? "+/" : "-_");
+
+            // Every byte value at a spread of positions within and across
+            // vector blocks
+            for (std::size_t c = 0; c < 256; ++c) {
+                bool is_valid = digits.find(char(c)) != std::string::npos;
+
+                for (std::size_t position : {std::size_t(0), std::size_t(5), std::size_t(17), std::size_t(63), std::size_t(64), std::size_t(101), std::size_t(180)}) {
+                    auto corrupted = encoded;
+                    corrupted[position] = char(c);
+
+                    std::vector<std::uint8_t> decoded;
+                    auto result = base64_decode_test(corrupted, decoded, alphabet);
+
+                    EXPECT_EQ(is_valid ? corrupted.size() : position, result.read);
+                }
+            }
+        }
+    }
+
+    TEST(Base64, Invalid_lengths_and_padding) {
+        struct Case {
+            const char* input;
+            std::size_t read;
+        };
+
+        const Case cases[] = {
+            {"Z", 0},
+            {"Zg=", 2},
+            {"Z===", 1},
+            {"====", 0},
+            {"Zm9vY", 4},
+            {"Zg==Zg==", 2},
+            {"Zm9v=", 4}
+        };
+
+        for (const auto& c : cases) {
+            std::vector<std::uint8_t> decoded;
+            auto result = base64_decode_test(c.input, decoded, Base64_alphabet::standard);
+            EXPECT_EQ(c.read, result.read) << c.input;
+        }
+    }
+
+}
+
+#endif //AVEL_BASE64_TESTS_HPP
@@ -0,0 +1,116 @@
+#ifndef AVEL_BITMAP_TESTS_HPP
+#define AVEL_BITMAP_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    //=====================================================
+    // Helpers
+    //=====================================================
+
+    inline std::uint64_t popcount_reference(const std::uint64_t* ptr, std::size_t n) {
+        std::uint64_t ret = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::uint64_t x = ptr[i]; x != 0; x &= x - 1) {
+                ++ret;
+            }
+        }
+
+        return ret;
+    }
+
+    ///
+    /// \return n random words, each with a random density of set bits, so
+    ///     that the carries through every level of the adder tree vary
+    inline std::vector<std::uint64_t> bitmap_test_data(std::size_t n) {
+        std::vector<std::uint64_t> ret(n);
+        for (auto& x : ret) {
+            switch (random8u() % 4) {
+                case 0: x = random64u() & random64u(); break;
+                case 1: x = random64u(); break;
+                case 2: x = random64u() | random64u(); break;
+                default: x = ~std::uint64_t(0); break;
+            }
+        }
+
+        return ret;
+    }
+
+    /// Sizes on either side of each of the block sizes used by the kernels
+    static const std::size_t bitmap_test_sizes[] = {
+        0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129,
+        255, 256, 257, 1000, 4096, 10007
+    };
+
+    //=====================================================
+    // Population count
+    //=====================================================
+
+    TEST(Bitmap, Popcount_random) {
+        auto data = bitmap_test_data(10007 + 3);
+
+        for (std::size_t n : bitmap_test_sizes) {
+            for (std::size_t offset = 0; offset < 4; ++offset) {
+                Vectorized_view<const std::uint64_t> view{data.data() + offset, n};
+                EXPECT_EQ(popcount_reference(data.data() + offset, n), popcount(view)) << n;
+            }
+        }
+    }
+
+    TEST(Bitmap, Popcount_all_ones) {
+        // Every sum in the adder tree carries
+        std::vector<std::uint64_t> data(5000, ~std::uint64_t(0));
+        EXPECT_EQ(64u * 5000u, popcount(Vectorized_view<const std::uint64_t>{data.data(), data.size()}));
+    }
+
+    //=====================================================
+    // Counts of bitwise operations
+    //=====================================================
+
+    TEST(Bitmap, Bitwise_counts_random) {
+        auto a = bitmap_test_data(10007 + 3);
+        auto b = bitmap_test_data(10007 + 3);
+
+        std::vector<std::uint64_t> intersection(a.size());
+        std::vector<std::uint64_t> disjunction(a.size());
+        std::vector<std::uint64_t> difference(a.size());
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            intersection[i] = a[i] & b[i];
+            disjunction[i] = a[i] | b[i];
+            difference[i] = a[i] ^ b[i];
+        }
+
+        for (std::size_t n : bitmap_test_sizes) {
+            for (std::size_t offset = 0; offset < 4; ++offset) {
+                Vectorized_view<const std::uint64_t> view_a{a.data() + offset, n};
+                Vectorized_view<const std::uint64_t> view_b{b.data() + offset, n};
+
+                EXPECT_EQ(popcount_reference(intersection.data() + offset, n), and_count(view_a, view_b)) << n;
+                EXPECT_EQ(popcount_reference(disjunction.data() + offset, n), or_count(view_a, view_b)) << n;
+                EXPECT_EQ(popcount_reference(difference.data() + offset, n), xor_count(view_a, view_b)) << n;
+            }
+        }
+    }
+
+    TEST(Bitmap, Bitwise_counts_different_sizes) {
+        auto a = bitmap_test_data(300);
+        auto b = bitmap_test_data(200);
+
+        Vectorized_view<const std::uint64_t> view_a{a.data(), a.size()};
+        Vectorized_view<const std::uint64_t> view_b{b.data(), b.size()};
+
+        std::uint64_t expected = 0;
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            expected += popcount(a[i] ^ b[i]);
+        }
+
+        EXPECT_EQ(expected, xor_count(view_a, view_b));
+        EXPECT_EQ(expected, xor_count(view_b, view_a));
+        EXPECT_EQ(0u, xor_count(view_a, view_a));
+        EXPECT_EQ(popcount(view_a), and_count(view_a, view_a));
+    }
+
+}
+
+#endif //AVEL_BITMAP_TESTS_HPP
@@ -0,0 +1,114 @@
+#ifndef AVEL_CRC_TESTS_HPP
+#define AVEL_CRC_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    //=====================================================
+    // Reference implementation
+    //=====================================================
+
+    inline std::uint32_t crc_reference(std::uint32_t polynomial, const std::uint8_t* ptr, std::size_t n, std::uint32_t crc = 0) {
+        crc = ~crc;
+        for (std::size_t i = 0; i < n; ++i) {
+            crc ^= ptr[i];
+            for (std::size_t j = 0; j < 8; ++j) {
+                crc = (crc >> 1) ^ ((crc & 1) ? polynomial : 0);
+            }
+        }
+
+        return ~crc;
+    }
+
+    inline std::vector<std::uint8_t> crc_test_data(std::size_t n) {
+        std::vector<std::uint8_t> data(n);
+        for (auto& x : data) {
+            x = random8u();
+        }
+
+        return data;
+    }
+
+    /// Sizes on either side of each of the thresholds used by the kernels
+    static const std::size_t crc_test_sizes[] = {
+        0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 63, 64, 65, 127, 128, 129, 191, 255, 256, 257,
+        511, 512, 513, 767, 768, 769, 1000, 2047, 2048, 4095, 12287, 12288, 12289, 13100, 25000
+    };
+
+    //=====================================================
+    // CRC-32C
+    //=====================================================
+
+    TEST(Crc, Crc32c_known_values) {
+        std::string check = "123456789";
+        Vectorized_view<const std::uint8_t> view{reinterpret_cast<const std::uint8_t*>(check.data()), check.size()};
+        EXPECT_EQ(0xE3069283u, crc32c(view));
+
+        std::vector<std::uint8_t> zeros(32, 0x00);
+        EXPECT_EQ(0x8A9136AAu, crc32c(Vectorized_view<const std::uint8_t>{zeros.data(), zeros.size()}));
+
+        std::vector<std::uint8_t> ones(32, 0xFF);
+        EXPECT_EQ(0x62A8AB43u, crc32c(Vectorized_view<const std::uint8_t>{ones.data(), ones.size()}));
+    }
+
+    TEST(Crc, Crc32c_random) {
+        auto data = crc_test_data(25000 + 3);
+
+        for (std::size_t n : crc_test_sizes) {
+            for (std::size_t offset = 0; offset < 4; ++offset) {
+                Vectorized_view<const std::uint8_t> view{data.data() + offset, n};
+                EXPECT_EQ(crc_reference(avel_impl::crc32c_polynomial, data.data() + offset, n), crc32c(view)) << n;
+            }
+        }
+    }
+
+    TEST(Crc, Crc32c_incremental) {
+        auto data = crc_test_data(3000);
+        auto expected = crc_reference(avel_impl::crc32c_polynomial, data.data(), data.size());
+
+        for (std::size_t split : {std::size_t(0), std::size_t(1), std::size_t(100), std::size_t(1024), std::size_t(2999), std::size_t(3000)}) {
+            auto first = crc32c(Vectorized_view<const std::uint8_t>{data.data(), split});
+            auto second = crc32c(Vectorized_view<const std::uint8_t>{data.data() + split, data.size() - split}, first);
+            EXPECT_EQ(expected, second);
+        }
+    }
+
+    //=====================================================
+    // CRC-32
+    //=====================================================
+
+    TEST(Crc, Crc32_known_values) {
+        std::string check = "123456789";
+        Vectorized_view<const std::uint8_t> view{reinterpret_cast<const std::uint8_t*>(check.data()), check.size()};
+        EXPECT_EQ(0xCBF43926u, crc32(view));
+
+        std::string fox = "The quick brown fox jumps over the lazy dog";
+        EXPECT_EQ(0x414FA339u, crc32(Vectorized_view<const std::uint8_t>{reinterpret_cast<const std::uint8_t*>(fox.data()), fox.size()}));
+    }
+
+    TEST(Crc, Crc32_random) {
+        auto data = crc_test_data(25000 + 3);
+
+        for (std::size_t n : crc_test_sizes) {
+            for (std::size_t offset = 0; offset < 4; ++offset) {
+                Vectorized_view<const std::uint8_t> view{data.data() + offset, n};
+                EXPECT_EQ(crc_reference(avel_impl::crc32_polynomial, data.data() + offset, n), crc32(view)) << n;
+            }
+        }
+    }
+
+    TEST(Crc, Crc32_incremental) {
+        auto data = crc_test_data(3000);
+        auto expected = crc_reference(avel_impl::crc32_polynomial, data.data(), data.size());
+
+        for (std::size_t split : {std::size_t(0), std::size_t(1), std::size_t(100), std::size_t(1024), std::size_t(2999), std::size_t(3000)}) {
+            auto first = crc32(Vectorized_view<const std::uint8_t>{data.data(), split});
+            auto second = crc32(Vectorized_view<const std::uint8_t>{data.data() + split, data.size() - split}, first);
+            EXPECT_EQ(expected, second);
+        }
+    }
+
+}
+
+#endif //AVEL_CRC_TESTS_HPP
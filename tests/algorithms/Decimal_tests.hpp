@@ -0,0 +1,183 @@
+#ifndef AVEL_DECIMAL_TESTS_HPP
+#define AVEL_DECIMAL_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t decimal_test_size = 300;
+
+    //=====================================================
+    // Helpers
+    //=====================================================
+
+    ///
+    /// \return Random value with a uniformly distributed number of significant
+    ///     bits, so that every digit count is exercised
+    template<class T>
+    T random_decimal_value() {
+        auto shift = random64u() % (8 * sizeof(T));
+        return static_cast<T>(random64u() >> (64 - 8 * sizeof(T) + shift));
+    }
+
+    template<class T>
+    std::string to_decimal_reference(const std::vector<T>& values, char delimiter) {
+        std::string ret;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (i != 0) {
+                ret += delimiter;
+            }
+
+            ret += std::to_string(values[i]);
+        }
+
+        return ret;
+    }
+
+    template<class T>
+    std::string to_decimal_test(const std::vector<T>& values, char delimiter) {
+        std::vector<std::uint8_t> out(decimal_size_bound<T>(values.size()) + 1, 0xFF);
+        auto written = to_decimal(
+            Vectorized_view<const T>{values.data(), values.size()},
+            Vectorized_view<std::uint8_t>{out.data(), out.size() - 1},
+            static_cast<std::uint8_t>(delimiter)
+        );
+
+        EXPECT_LE(written, out.size() - 1);
+        EXPECT_EQ(0xFF, out.back());
+
+        return std::string(out.begin(), out.begin() + written);
+    }
+
+    template<class T>
+    Transcode_result from_decimal_test(const std::string& str, std::vector<T>& out, char delimiter) {
+        Vectorized_view<const std::uint8_t> in{reinterpret_cast<const std::uint8_t*>(str.data()), str.size()};
+        return from_decimal(in, Vectorized_view<T>{out.data(), out.size()}, static_cast<std::uint8_t>(delimiter));
+    }
+
+    //=====================================================
+    // Formatting and parsing
+    //=====================================================
+
+    template<class T>
+    void test_decimal_round_trip() {
+        for (std::size_t n = 0; n < decimal_test_size; ++n) {
+            std::vector<T> values(n);
+            for (auto& x : values) {
+                x = random_decimal_value<T>();
+            }
+
+            auto expected = to_decimal_reference(values, ',');
+            auto formatted = to_decimal_test(values, ',');
+            EXPECT_EQ(expected, formatted);
+
+            std::vector<T> parsed(n);
+            auto result = from_decimal_test(formatted, parsed, ',');
+
+            EXPECT_EQ(formatted.size(), result.read);
+            EXPECT_EQ(n, result.written);
+            EXPECT_EQ(values, parsed);
+        }
+    }
+
+    TEST(Decimal, Round_trip_32u) {
+        test_decimal_round_trip<std::uint32_t>();
+    }
+
+    TEST(Decimal, Round_trip_64u) {
+        test_decimal_round_trip<std::uint64_t>();
+    }
+
+    TEST(Decimal, Format_edge_values) {
+        std::vector<std::uint32_t> values32{0, 9, 10, 99, 100, 9999, 10000, 99999999, 100000000, 999999999, 1000000000, 0xFFFFFFFF};
+        EXPECT_EQ(to_decimal_reference(values32, ' '), to_decimal_test(values32, ' '));
+
+        std::vector<std::uint64_t> values64{0, 9, 10, 99999999, 100000000, 9999999999999999, 10000000000000000, 9999999999999999999ull, 10000000000000000000ull, 0xFFFFFFFFFFFFFFFFull};
+        EXPECT_EQ(to_decimal_reference(values64, '\n'), to_decimal_test(values64, '\n'));
+    }
+
+    TEST(Decimal, Parse_field_lengths) {
+        // Fields of every length on both sides of the vector kernel's cutoff,
+        // including fields with leading zeros. Enough fields are written that
+        // all but the last are followed by sixteen readable bytes
+        for (std::size_t length = 1; length <= 24; ++length) {
+            std::string field(length, '0');
+            field.back() = '7';
+            field[0] = (length <= 20) ? '1' : '0';
+
+            std::string text;
+            for (std::size_t i = 0; i < 9; ++i) {
+                text += field + " ";
+            }
+
+            std::vector<std::uint64_t> parsed(9);
+            auto result = from_decimal_test(text, parsed, ' ');
+            EXPECT_EQ(text.size(), result.read);
+            EXPECT_EQ(9u, result.written);
+
+            for (auto x : parsed) {
+                EXPECT_EQ(std::strtoull(field.c_str(), nullptr, 10), x);
+            }
+        }
+    }
+
+    //=====================================================
+    // Invalid input
+    //=====================================================
+
+    TEST(Decimal, Invalid_input) {
+        struct Case {
+            const char* input;
+            std::size_t read;
+            std::size_t written;
+        };
+
+        const Case cases32[] = {
+            {"", 0, 0},
+            {",", 0, 0},
+            {"1,,2", 2, 1},
+            {"12a", 2, 0},
+            {"1,-2", 2, 1},
+            {"4294967295,4294967296", 11, 1},
+            {"99999999999999999999999", 0, 0},
+            {"1 2", 1, 0},
+            {"123456789012345", 0, 0}
+        };
+
+        for (const auto& c : cases32) {
+            std::vector<std::uint32_t> parsed(4);
+            auto result = from_decimal_test(c.input, parsed, ',');
+            EXPECT_EQ(c.read, result.read) << c.input;
+            EXPECT_EQ(c.written, result.written) << c.input;
+        }
+
+        const Case cases64[] = {
+            {"18446744073709551615", 20, 1},
+            {"18446744073709551616", 0, 0},
+            {"0000000000000000000018446744073709551615,", 41, 1},
+            {"1234567890123456789012", 0, 0},
+            {"12345678901234567 8", 17, 0},
+            {"123456789012345,x", 16, 1}
+        };
+
+        for (const auto& c : cases64) {
+            std::vector<std::uint64_t> parsed(4);
+            auto result = from_decimal_test(c.input, parsed, ',');
+            EXPECT_EQ(c.read, result.read) << c.input;
+            EXPECT_EQ(c.written, result.written) << c.input;
+        }
+    }
+
+    TEST(Decimal, Parse_stops_when_full) {
+        std::string text = "1,22,333,4444";
+
+        std::vector<std::uint32_t> parsed(2);
+        auto result = from_decimal_test(text, parsed, ',');
+        EXPECT_EQ(5u, result.read);
+        EXPECT_EQ(2u, result.written);
+        EXPECT_EQ(22u, parsed[1]);
+    }
+
+}
+
+#endif //AVEL_DECIMAL_TESTS_HPP
@@ -0,0 +1,127 @@
+#ifndef AVEL_EXTREMA_TESTS_HPP
+#define AVEL_EXTREMA_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t extrema_test_size = 512 + 9;
+
+    // Long enough for 8-bit lane counters to overflow several times
+    static constexpr std::size_t large_extrema_test_size = 64 * 1024 + 7;
+
+    //=====================================================
+    // Extrema
+    //=====================================================
+
+    template<class T>
+    void check_extrema(const std::vector<T>& data) {
+        Vectorized_view<const T> view{data.data(), data.size()};
+
+        auto min = argmin(view);
+        auto max = argmax(view);
+
+        if (data.empty()) {
+            EXPECT_EQ(0, min.index);
+            EXPECT_EQ(0, max.index);
+            return;
+        }
+
+        auto expected_min = std::size_t(std::min_element(data.begin(), data.end()) - data.begin());
+        auto expected_max = std::size_t(std::max_element(data.begin(), data.end()) - data.begin());
+
+        EXPECT_EQ(expected_min, min.index);
+        EXPECT_EQ(data[expected_min], min.value);
+
+        EXPECT_EQ(expected_max, max.index);
+        EXPECT_EQ(data[expected_max], max.value);
+    }
+
+    template<class T>
+    void test_extrema() {
+        for (std::size_t n = 0; n < extrema_test_size; n += 1 + (n / 8)) {
+            std::vector<T> data(n);
+            for (auto& x : data) {
+                x = random_val<T>();
+            }
+            check_extrema(data);
+
+            // A small range of values produces many ties
+            for (auto& x : data) {
+                x = T(random32u() % 8);
+            }
+            check_extrema(data);
+        }
+
+        std::vector<T> data(large_extrema_test_size);
+        for (auto& x : data) {
+            x = T(10 + random32u() % 50);
+        }
+        check_extrema(data);
+
+        // Extrema which are repeated near the start and end of the data
+        for (std::size_t i : {std::size_t(3), data.size() / 2, data.size() - 2}) {
+            data[i] = T(1);
+            data[data.size() - 1 - i] = T(100);
+        }
+        check_extrema(data);
+
+        std::fill(data.begin(), data.end(), T(5));
+        check_extrema(data);
+    }
+
+    TEST(Extrema, Argmin_argmax_8u_random) {
+        test_extrema<std::uint8_t>();
+    }
+
+    TEST(Extrema, Argmin_argmax_8i_random) {
+        test_extrema<std::int8_t>();
+    }
+
+    TEST(Extrema, Argmin_argmax_16u_random) {
+        test_extrema<std::uint16_t>();
+    }
+
+    TEST(Extrema, Argmin_argmax_16i_random) {
+        test_extrema<std::int16_t>();
+    }
+
+    TEST(Extrema, Argmin_argmax_32u_random) {
+        test_extrema<std::uint32_t>();
+    }
+
+    TEST(Extrema, Argmin_argmax_32i_random) {
+        test_extrema<std::int32_t>();
+    }
+
+    TEST(Extrema, Argmin_argmax_64u_random) {
+        test_extrema<std::uint64_t>();
+    }
+
+    TEST(Extrema, Argmin_argmax_64i_random) {
+        test_extrema<std::int64_t>();
+    }
+
+    TEST(Extrema, Argmin_argmax_32f_random) {
+        test_extrema<float>();
+    }
+
+    TEST(Extrema, Argmin_argmax_64f_random) {
+        test_extrema<double>();
+    }
+
+    TEST(Extrema, Argmin_argmax_signed_zeros) {
+        // Zeros of either sign compare equal, so the first one must be chosen
+        std::vector<float> data(100, 1.0f);
+        data[37] = -0.0f;
+        data[41] = +0.0f;
+        data[60] = -0.0f;
+
+        auto min = argmin(Vectorized_view<const float>{data.data(), data.size()});
+        EXPECT_EQ(37, min.index);
+        EXPECT_TRUE(std::signbit(min.value));
+    }
+
+}
+
+#endif //AVEL_EXTREMA_TESTS_HPP
@@ -0,0 +1,109 @@
+#ifndef AVEL_FIND_TESTS_HPP
+#define AVEL_FIND_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t find_test_size = 512 + 9;
+
+    //=====================================================
+    // Find, contains, and count
+    //=====================================================
+
+    template<class T>
+    void test_find_and_count() {
+        for (std::size_t n = 0; n < find_test_size; n += 1 + (n / 8)) {
+            // Values are drawn from a small range so that searches succeed
+            // at varying positions. Zero is included since it's the value of
+            // the padding lanes in partial loads
+            std::vector<T> data(n);
+            for (auto& x : data) {
+                x = T(random32u() % 64);
+            }
+
+            Vectorized_view<const T> view{data.data(), data.size()};
+
+            for (std::uint32_t k = 0; k < 4; ++k) {
+                T value = T(random32u() % 80);
+
+                auto it = std::find(data.begin(), data.end(), value);
+                std::size_t expected_index = it - data.begin();
+                std::size_t expected_count = std::count(data.begin(), data.end(), value);
+
+                EXPECT_EQ(expected_index, find(view, value));
+                EXPECT_EQ(expected_index != n, contains(view, value));
+                EXPECT_EQ(expected_count, count(view, value));
+            }
+        }
+    }
+
+    TEST(Find, Find_and_count_8u_random) {
+        test_find_and_count<std::uint8_t>();
+    }
+
+    TEST(Find, Find_and_count_8i_random) {
+        test_find_and_count<std::int8_t>();
+    }
+
+    TEST(Find, Find_and_count_16u_random) {
+        test_find_and_count<std::uint16_t>();
+    }
+
+    TEST(Find, Find_and_count_16i_random) {
+        test_find_and_count<std::int16_t>();
+    }
+
+    TEST(Find, Find_and_count_32u_random) {
+        test_find_and_count<std::uint32_t>();
+    }
+
+    TEST(Find, Find_and_count_32i_random) {
+        test_find_and_count<std::int32_t>();
+    }
+
+    TEST(Find, Find_and_count_64u_random) {
+        test_find_and_count<std::uint64_t>();
+    }
+
+    TEST(Find, Find_and_count_64i_random) {
+        test_find_and_count<std::int64_t>();
+    }
+
+    TEST(Find, Find_and_count_32f_random) {
+        test_find_and_count<float>();
+    }
+
+    TEST(Find, Find_and_count_64f_random) {
+        test_find_and_count<double>();
+    }
+
+    TEST(Find, Find_if_and_count_if_32u_random) {
+        for (std::size_t n = 0; n < find_test_size; n += 1 + (n / 8)) {
+            std::vector<std::uint32_t> data(n);
+            for (auto& x : data) {
+                x = random32u() % 1000;
+            }
+
+            Vectorized_view<std::uint32_t> view{data.data(), data.size()};
+
+            auto pred = [] (vecNx32u v) {
+                return (vecNx32u{990} <= v) && (v < vecNx32u{995});
+            };
+
+            auto scalar_pred = [] (std::uint32_t x) {
+                return 990 <= x && x < 995;
+            };
+
+            auto it = std::find_if(data.begin(), data.end(), scalar_pred);
+            std::size_t expected_index = it - data.begin();
+            std::size_t expected_count = std::count_if(data.begin(), data.end(), scalar_pred);
+
+            EXPECT_EQ(expected_index, find_if(view, pred));
+            EXPECT_EQ(expected_count, count_if(view, pred));
+        }
+    }
+
+}
+
+#endif //AVEL_FIND_TESTS_HPP
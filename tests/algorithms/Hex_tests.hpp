@@ -0,0 +1,133 @@
+#ifndef AVEL_HEX_TESTS_HPP
+#define AVEL_HEX_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t hex_test_size = 300;
+
+    //=====================================================
+    // Helpers
+    //=====================================================
+
+    inline std::string hex_encode_reference(const std::vector<std::uint8_t>& data, Hex_case letter_case) {
+        const char* digits = (letter_case == Hex_case::lower) ? "0123456789abcdef" : "0123456789ABCDEF";
+
+        std::string ret;
+        for (auto x : data) {
+            ret += digits[x >> 4];
+            ret += digits[x & 0x0F];
+        }
+
+        return ret;
+    }
+
+    inline std::string hex_encode_test(const std::vector<std::uint8_t>& data, Hex_case letter_case) {
+        std::vector<std::uint8_t> out(2 * data.size() + 1, 0xFF);
+        auto written = hex_encode(
+            Vectorized_view<const std::uint8_t>{data.data(), data.size()},
+            Vectorized_view<std::uint8_t>{out.data(), out.size() - 1},
+            letter_case
+        );
+
+        EXPECT_EQ(out.size() - 1, written);
+        EXPECT_EQ(0xFF, out.back());
+
+        return std::string(out.begin(), out.begin() + written);
+    }
+
+    inline Transcode_result hex_decode_test(const std::string& str, std::vector<std::uint8_t>& out) {
+        Vectorized_view<const std::uint8_t> in{reinterpret_cast<const std::uint8_t*>(str.data()), str.size()};
+
+        out.assign(str.size() / 2 + 1, 0xFF);
+        auto result = hex_decode(in, Vectorized_view<std::uint8_t>{out.data(), out.size() - 1});
+
+        EXPECT_EQ(0xFF, out.back());
+        out.resize(result.written);
+
+        return result;
+    }
+
+    //=====================================================
+    // Encoding and decoding
+    //=====================================================
+
+    inline void test_hex_round_trip(Hex_case letter_case) {
+        for (std::size_t n = 0; n < hex_test_size; ++n) {
+            std::vector<std::uint8_t> data(n);
+            for (auto& x : data) {
+                x = random8u();
+            }
+
+            auto expected = hex_encode_reference(data, letter_case);
+            auto encoded = hex_encode_test(data, letter_case);
+            EXPECT_EQ(expected, encoded);
+
+            std::vector<std::uint8_t> decoded;
+            auto result = hex_decode_test(encoded, decoded);
+
+            EXPECT_EQ(encoded.size(), result.read);
+            EXPECT_EQ(n, result.written);
+            EXPECT_EQ(data, decoded);
+        }
+    }
+
+    TEST(Hex, Round_trip_lower) {
+        test_hex_round_trip(Hex_case::lower);
+    }
+
+    TEST(Hex, Round_trip_upper) {
+        test_hex_round_trip(Hex_case::upper);
+    }
+
+    TEST(Hex, Mixed_case) {
+        std::vector<std::uint8_t> decoded;
+        auto result = hex_decode_test("aBcDeF09Ab", decoded);
+
+        EXPECT_EQ(10u, result.read);
+        EXPECT_EQ((std::vector<std::uint8_t>{0xAB, 0xCD, 0xEF, 0x09, 0xAB}), decoded);
+    }
+
+    //=====================================================
+    // Invalid input
+    //=====================================================
+
+    TEST(Hex, Invalid_characters) {
+        std::vector<std::uint8_t> data(150);
+        for (auto& x : data) {
+            x = random8u();
+        }
+
+        auto encoded = hex_encode_test(data, Hex_case::lower);
+        const std::string digits = "0123456789abcdefABCDEF";
+
+        // Every byte value at a spread of positions within and across
+        // vector blocks
+        for (std::size_t c = 0; c < 256; ++c) {
+            bool is_valid = digits.find(char(c)) != std::string::npos;
+
+            for (std::size_t position : {std::size_t(0), std::size_t(5), std::size_t(17), std::size_t(63), std::size_t(64), std::size_t(128), std::size_t(299)}) {
+                auto corrupted = encoded;
+                corrupted[position] = char(c);
+
+                std::vector<std::uint8_t> decoded;
+                auto result = hex_decode_test(corrupted, decoded);
+
+                EXPECT_EQ(is_valid ? corrupted.size() : position, result.read);
+                EXPECT_EQ(is_valid ? data.size() : position / 2, result.written);
+            }
+        }
+    }
+
+    TEST(Hex, Odd_length) {
+        std::vector<std::uint8_t> decoded;
+        auto result = hex_decode_test("12345", decoded);
+
+        EXPECT_EQ(4u, result.read);
+        EXPECT_EQ(2u, result.written);
+    }
+
+}
+
+#endif //AVEL_HEX_TESTS_HPP
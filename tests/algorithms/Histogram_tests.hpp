@@ -0,0 +1,94 @@
+#ifndef AVEL_HISTOGRAM_TESTS_HPP
+#define AVEL_HISTOGRAM_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t histogram_test_size = 1024 + 5;
+
+    //=====================================================
+    // Histograms
+    //=====================================================
+
+    template<class T>
+    void check_histogram(const std::vector<T>& data, std::size_t bins) {
+        std::vector<std::uint32_t> expected(bins, 0);
+        for (auto x : data) {
+            if (x < bins) {
+                ++expected[x];
+            }
+        }
+
+        auto h = histogram(Vectorized_view<const T>{data.data(), data.size()}, bins);
+
+        ASSERT_EQ(bins, h.size());
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(h.data()) % AVEL_L1_CACHE_LINE_SIZE);
+        for (std::size_t i = 0; i < bins; ++i) {
+            EXPECT_EQ(expected[i], h[i]);
+        }
+    }
+
+    template<class T>
+    void test_histogram(std::initializer_list<std::size_t> bin_counts) {
+        for (std::size_t n = 0; n < histogram_test_size; n += 1 + (n / 4)) {
+            std::vector<T> data(n);
+            for (auto& x : data) {
+                x = random_val<T>();
+            }
+
+            for (auto bins : bin_counts) {
+                check_histogram(data, bins);
+            }
+
+            // Long runs of a single value are the case sub-histograms exist for
+            std::fill(data.begin(), data.end(), T(3));
+            for (auto bins : bin_counts) {
+                check_histogram(data, bins);
+            }
+        }
+    }
+
+    TEST(Histogram, Histogram_8u_random) {
+        test_histogram<std::uint8_t>({0, 1, 4, 16, 255, 256, 300});
+    }
+
+    TEST(Histogram, Histogram_16u_random) {
+        test_histogram<std::uint16_t>({0, 1, 4, 100, 2048, 4096, 65535, 65536, 70000});
+    }
+
+    TEST(Histogram, Histogram_16u_mutable_view) {
+        std::vector<std::uint16_t> data(histogram_test_size);
+        for (auto& x : data) {
+            x = std::uint16_t(random32u() % 128);
+        }
+
+        std::vector<std::uint32_t> expected(100, 0);
+        for (auto x : data) {
+            if (x < 100) {
+                ++expected[x];
+            }
+        }
+
+        auto h = histogram(Vectorized_view<std::uint16_t>{data.data(), data.size()}, 100);
+
+        ASSERT_EQ(100, h.size());
+        for (std::size_t i = 0; i < h.size(); ++i) {
+            EXPECT_EQ(expected[i], h[i]);
+        }
+    }
+
+    TEST(Histogram, Histogram_16u_clustered) {
+        // Few distinct values produce many conflicting lanes per vector
+        std::vector<std::uint16_t> data(64 * 1024 + 9);
+        for (auto& x : data) {
+            x = std::uint16_t(5000 + random32u() % 4);
+        }
+
+        check_histogram(data, 8192);
+        check_histogram(data, 5002);
+    }
+
+}
+
+#endif //AVEL_HISTOGRAM_TESTS_HPP
@@ -0,0 +1,208 @@
+#ifndef AVEL_PARALLEL_TESTS_HPP
+#define AVEL_PARALLEL_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    // Large enough to be split into several chunks
+    static constexpr std::size_t parallel_test_size = 1024 * 1024 + 5;
+
+    // Thread counts which do and do not evenly divide the input
+    static const Parallel_policy parallel_test_policies[] {
+        Parallel_policy{1},
+        Parallel_policy{3},
+        Parallel_policy{4},
+        par
+    };
+
+    //=====================================================
+    // Thread pool
+    //=====================================================
+
+    TEST(Parallel, Thread_pool_runs_each_task_once) {
+        std::vector<std::atomic<std::uint32_t>> runs(1000);
+        for (auto& x : runs) {
+            x = 0;
+        }
+
+        avel_impl::thread_pool().run(4, runs.size(), [&] (std::size_t i) {
+            ++runs[i];
+        });
+
+        for (auto& x : runs) {
+            EXPECT_EQ(1, x.load());
+        }
+    }
+
+    TEST(Parallel, Thread_pool_propagates_exceptions) {
+        auto f = [] (std::size_t i) {
+            if (i == 50) {
+                throw std::runtime_error{"Task failed"};
+            }
+        };
+
+        EXPECT_THROW(avel_impl::thread_pool().run(4, 100, f), std::runtime_error);
+
+        // The pool must remain usable afterwards
+        std::atomic<std::size_t> total{0};
+        avel_impl::thread_pool().run(4, 100, [&] (std::size_t i) {
+            total += i;
+        });
+        EXPECT_EQ(4950, total.load());
+    }
+
+    TEST(Parallel, Partition_chunks_are_cache_line_aligned) {
+        std::vector<std::uint32_t> data(parallel_test_size);
+
+        // Offsetting the data forces the first chunk to absorb a partial line
+        const std::uint32_t* ptr = data.data() + 3;
+        auto parts = avel_impl::parallel_partition(Parallel_policy{4}, ptr, data.size() - 3);
+
+        ASSERT_LT(1, parts.count);
+        EXPECT_EQ(0, parts.begin(0));
+        EXPECT_EQ(data.size() - 3, parts.end(parts.count - 1));
+        for (std::size_t k = 1; k < parts.count; ++k) {
+            EXPECT_EQ(parts.end(k - 1), parts.begin(k));
+            EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(ptr + parts.begin(k)) % AVEL_L1_CACHE_LINE_SIZE);
+        }
+    }
+
+    //=====================================================
+    // Parallel algorithms
+    //=====================================================
+
+    TEST(Parallel, Transform_32u) {
+        std::vector<std::uint32_t> input(parallel_test_size);
+        for (auto& x : input) {
+            x = random32u();
+        }
+
+        for (auto policy : parallel_test_policies) {
+            std::vector<std::uint32_t> output(input.size());
+            transform(
+                policy,
+                Vectorized_view<const std::uint32_t>{input.data() + 1, input.size() - 1},
+                Vectorized_view<std::uint32_t>{output.data() + 1, output.size() - 1},
+                [] (vecNx32u v) { return v * vecNx32u{3}; }
+            );
+
+            EXPECT_EQ(0, output[0]);
+            for (std::size_t i = 1; i < input.size(); ++i) {
+                ASSERT_EQ(input[i] * 3, output[i]);
+            }
+        }
+    }
+
+    TEST(Parallel, Reduce_64i) {
+        std::vector<std::int64_t> data(parallel_test_size);
+        for (auto& x : data) {
+            x = std::int64_t(random32u()) - (1ll << 31);
+        }
+
+        auto expected = std::accumulate(data.begin(), data.end(), std::int64_t(5));
+        for (auto policy : parallel_test_policies) {
+            EXPECT_EQ(expected, reduce(policy, Vectorized_view<const std::int64_t>{data.data(), data.size()}, 5));
+        }
+    }
+
+    TEST(Parallel, Find_and_count_16u) {
+        std::vector<std::uint16_t> data(parallel_test_size);
+        for (auto& x : data) {
+            x = std::uint16_t(random32u() % 1000);
+        }
+
+        for (auto policy : parallel_test_policies) {
+            Vectorized_view<const std::uint16_t> view{data.data(), data.size()};
+
+            EXPECT_EQ(data.size(), find(policy, view, std::uint16_t(1000)));
+            EXPECT_EQ(0, count(policy, view, std::uint16_t(1000)));
+
+            // Matches are added progressively closer to the start of the data
+            for (std::size_t i : {data.size() - 1, data.size() / 2 + 1, data.size() / 3, std::size_t(0)}) {
+                data[i] = 1000;
+
+                EXPECT_EQ(i, find(policy, view, std::uint16_t(1000)));
+                EXPECT_EQ(
+                    std::size_t(std::count(data.begin(), data.end(), 1000)),
+                    count(policy, view, std::uint16_t(1000))
+                );
+            }
+
+            std::replace(data.begin(), data.end(), 1000, 999);
+        }
+    }
+
+    TEST(Parallel, Histogram_8u) {
+        std::vector<std::uint8_t> data(parallel_test_size);
+        for (auto& x : data) {
+            x = random_val<std::uint8_t>();
+        }
+
+        std::vector<std::uint32_t> expected(200, 0);
+        for (auto x : data) {
+            if (x < 200) {
+                ++expected[x];
+            }
+        }
+
+        for (auto policy : parallel_test_policies) {
+            auto h = histogram(policy, Vectorized_view<const std::uint8_t>{data.data(), data.size()}, 200);
+
+            ASSERT_EQ(200, h.size());
+            for (std::size_t i = 0; i < h.size(); ++i) {
+                EXPECT_EQ(expected[i], h[i]);
+            }
+
+            h = histogram(policy, Vectorized_view<std::uint8_t>{data.data(), data.size()}, 200);
+
+            ASSERT_EQ(200, h.size());
+            for (std::size_t i = 0; i < h.size(); ++i) {
+                EXPECT_EQ(expected[i], h[i]);
+            }
+        }
+    }
+
+    template<class T>
+    void check_parallel_sort(const std::vector<T>& data) {
+        auto expected = data;
+        std::sort(expected.begin(), expected.end());
+
+        for (auto policy : parallel_test_policies) {
+            auto sorted = data;
+            sort(policy, Vectorized_view<T>{sorted.data(), sorted.size()});
+            EXPECT_EQ(expected, sorted);
+        }
+    }
+
+    template<class T>
+    void test_parallel_sort() {
+        std::vector<T> data(parallel_test_size);
+        for (auto& x : data) {
+            x = random_val<T>();
+        }
+        check_parallel_sort(data);
+
+        // Many duplicates, and chunks whose elements all precede or follow
+        // each other, move the points at which merges are split
+        for (auto& x : data) {
+            x = T(random32u() % 16);
+        }
+        check_parallel_sort(data);
+
+        std::sort(data.begin(), data.end());
+        std::reverse(data.begin(), data.end());
+        check_parallel_sort(data);
+    }
+
+    TEST(Parallel, Sort_32u) {
+        test_parallel_sort<std::uint32_t>();
+    }
+
+    TEST(Parallel, Sort_64f) {
+        test_parallel_sort<double>();
+    }
+
+}
+
+#endif //AVEL_PARALLEL_TESTS_HPP
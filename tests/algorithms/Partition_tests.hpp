@@ -0,0 +1,142 @@
+#ifndef AVEL_PARTITION_TESTS_HPP
+#define AVEL_PARTITION_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t partition_test_size = 512 + 13;
+
+    //=====================================================
+    // Filtering
+    //=====================================================
+
+    template<class T>
+    void test_filters() {
+        using vec = Natural_width_vector<T>;
+
+        for (std::size_t n = 0; n < partition_test_size; n += 1 + (n / 8)) {
+            std::vector<T> data(n);
+            for (auto& x : data) {
+                x = T(random32u() % 100);
+            }
+
+            // Varying the threshold varies the density of selected elements
+            for (std::uint32_t threshold : {0, 10, 50, 90, 100}) {
+                const vec t{T(threshold)};
+                auto pred = [t] (vec v) {
+                    return v < t;
+                };
+
+                auto scalar_pred = [threshold] (T x) {
+                    return x < T(threshold);
+                };
+
+                std::vector<T> expected_selected;
+                std::vector<T> expected_rejected;
+                for (auto x : data) {
+                    if (scalar_pred(x)) {
+                        expected_selected.push_back(x);
+                    } else {
+                        expected_rejected.push_back(x);
+                    }
+                }
+
+                // copy_if
+                std::vector<T> out(n);
+                auto k = copy_if(
+                    Vectorized_view<const T>{data.data(), data.size()},
+                    Vectorized_view<T>{out.data(), out.size()},
+                    pred
+                );
+
+                ASSERT_EQ(expected_selected.size(), k);
+                for (std::size_t i = 0; i < k; ++i) {
+                    EXPECT_EQ(expected_selected[i], out[i]);
+                }
+
+                // copy_if in place
+                auto in_place = data;
+                k = copy_if(
+                    Vectorized_view<const T>{in_place.data(), in_place.size()},
+                    Vectorized_view<T>{in_place.data(), in_place.size()},
+                    pred
+                );
+
+                ASSERT_EQ(expected_selected.size(), k);
+                for (std::size_t i = 0; i < k; ++i) {
+                    EXPECT_EQ(expected_selected[i], in_place[i]);
+                }
+
+                // stable_partition
+                auto stable = data;
+                k = stable_partition(Vectorized_view<T>{stable.data(), stable.size()}, pred);
+
+                ASSERT_EQ(expected_selected.size(), k);
+                for (std::size_t i = 0; i < k; ++i) {
+                    EXPECT_EQ(expected_selected[i], stable[i]);
+                }
+                for (std::size_t i = k; i < n; ++i) {
+                    EXPECT_EQ(expected_rejected[i - k], stable[i]);
+                }
+
+                // partition
+                auto unstable = data;
+                k = partition(Vectorized_view<T>{unstable.data(), unstable.size()}, pred);
+
+                ASSERT_EQ(expected_selected.size(), k);
+                for (std::size_t i = 0; i < n; ++i) {
+                    EXPECT_EQ(i < k, scalar_pred(unstable[i]));
+                }
+
+                auto sorted_data = data;
+                std::sort(sorted_data.begin(), sorted_data.end());
+                std::sort(unstable.begin(), unstable.end());
+                EXPECT_EQ(sorted_data, unstable);
+            }
+        }
+    }
+
+    TEST(Partition, Filters_8u_random) {
+        test_filters<std::uint8_t>();
+    }
+
+    TEST(Partition, Filters_8i_random) {
+        test_filters<std::int8_t>();
+    }
+
+    TEST(Partition, Filters_16u_random) {
+        test_filters<std::uint16_t>();
+    }
+
+    TEST(Partition, Filters_16i_random) {
+        test_filters<std::int16_t>();
+    }
+
+    TEST(Partition, Filters_32u_random) {
+        test_filters<std::uint32_t>();
+    }
+
+    TEST(Partition, Filters_32i_random) {
+        test_filters<std::int32_t>();
+    }
+
+    TEST(Partition, Filters_64u_random) {
+        test_filters<std::uint64_t>();
+    }
+
+    TEST(Partition, Filters_64i_random) {
+        test_filters<std::int64_t>();
+    }
+
+    TEST(Partition, Filters_32f_random) {
+        test_filters<float>();
+    }
+
+    TEST(Partition, Filters_64f_random) {
+        test_filters<double>();
+    }
+
+}
+
+#endif //AVEL_PARTITION_TESTS_HPP
@@ -0,0 +1,62 @@
+#ifndef AVEL_REDUCE_TESTS_HPP
+#define AVEL_REDUCE_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t reduce_test_size = 512 + 3;
+
+    //=====================================================
+    // Reductions
+    //=====================================================
+
+    template<class T>
+    void test_reduce() {
+        for (std::size_t n = 0; n < reduce_test_size; n += 1 + (n / 8)) {
+            std::vector<T> data(n);
+            for (auto& x : data) {
+                // Small values keep floating-point sums exact
+                x = T(random32u() % 16);
+            }
+
+            T expected = T(7);
+            for (auto x : data) {
+                expected = T(expected + x);
+            }
+
+            EXPECT_EQ(expected, reduce(Vectorized_view<const T>{data.data(), data.size()}, T(7)));
+        }
+    }
+
+    TEST(Reduce, Reduce_8u_random) {
+        test_reduce<std::uint8_t>();
+    }
+
+    TEST(Reduce, Reduce_16i_random) {
+        test_reduce<std::int16_t>();
+    }
+
+    TEST(Reduce, Reduce_32u_random) {
+        test_reduce<std::uint32_t>();
+    }
+
+    TEST(Reduce, Reduce_32i_random) {
+        test_reduce<std::int32_t>();
+    }
+
+    TEST(Reduce, Reduce_64u_random) {
+        test_reduce<std::uint64_t>();
+    }
+
+    TEST(Reduce, Reduce_32f_random) {
+        test_reduce<float>();
+    }
+
+    TEST(Reduce, Reduce_64f_random) {
+        test_reduce<double>();
+    }
+
+}
+
+#endif //AVEL_REDUCE_TESTS_HPP
@@ -0,0 +1,214 @@
+#ifndef AVEL_SCAN_TESTS_HPP
+#define AVEL_SCAN_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t scan_test_size = 1024 + 7;
+
+    template<class T>
+    T random_scan_input(std::true_type) {
+        return random_val<T>();
+    }
+
+    template<class T>
+    T random_scan_input(std::false_type) {
+        // Small integers keep every partial sum exact regardless of the
+        // order in which it's accumulated
+        return static_cast<T>(random32u() % 16);
+    }
+
+    template<class T>
+    T random_scan_input() {
+        return random_scan_input<T>(std::is_integral<T>{});
+    }
+
+    template<class T>
+    void test_inclusive_scan() {
+        for (std::size_t n = 0; n < scan_test_size; n += 1 + (n / 8)) {
+            std::vector<T> inputs(n);
+            for (auto& x : inputs) {
+                x = random_scan_input<T>();
+            }
+
+            std::vector<T> outputs(n);
+
+            T init = random_scan_input<T>();
+            auto total = inclusive_scan(
+                Vectorized_view<const T>{inputs.data(), inputs.size()},
+                Vectorized_view<T>{outputs.data(), outputs.size()},
+                init
+            );
+
+            T sum = init;
+            for (std::size_t i = 0; i < n; ++i) {
+                sum = static_cast<T>(sum + inputs[i]);
+                EXPECT_EQ(sum, outputs[i]);
+            }
+
+            EXPECT_EQ(sum, total);
+        }
+    }
+
+    template<class T>
+    void test_exclusive_scan() {
+        for (std::size_t n = 0; n < scan_test_size; n += 1 + (n / 8)) {
+            std::vector<T> inputs(n);
+            for (auto& x : inputs) {
+                x = random_scan_input<T>();
+            }
+
+            std::vector<T> outputs(n);
+
+            T init = random_scan_input<T>();
+            auto total = exclusive_scan(
+                Vectorized_view<const T>{inputs.data(), inputs.size()},
+                Vectorized_view<T>{outputs.data(), outputs.size()},
+                init
+            );
+
+            T sum = init;
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(sum, outputs[i]);
+                sum = static_cast<T>(sum + inputs[i]);
+            }
+
+            EXPECT_EQ(sum, total);
+        }
+    }
+
+    //=====================================================
+    // Inclusive scan
+    //=====================================================
+
+    TEST(Scan, Inclusive_scan_32u_random) {
+        for (std::size_t n = 0; n < scan_test_size; n += 1 + (n / 8)) {
+            std::vector<std::uint32_t> inputs(n);
+            for (auto& x : inputs) {
+                x = random32u();
+            }
+
+            std::vector<std::uint32_t> outputs(n);
+
+            auto init = random32u();
+            auto total = inclusive_scan(
+                Vectorized_view<const std::uint32_t>{inputs.data(), inputs.size()},
+                Vectorized_view<std::uint32_t>{outputs.data(), outputs.size()},
+                init
+            );
+
+            std::uint32_t sum = init;
+            for (std::size_t i = 0; i < n; ++i) {
+                sum += inputs[i];
+                EXPECT_EQ(sum, outputs[i]);
+            }
+
+            EXPECT_EQ(sum, total);
+        }
+    }
+
+    TEST(Scan, Inclusive_scan_8u_random) {
+        test_inclusive_scan<std::uint8_t>();
+    }
+
+    TEST(Scan, Inclusive_scan_64u_random) {
+        test_inclusive_scan<std::uint64_t>();
+    }
+
+    TEST(Scan, Inclusive_scan_32f_random) {
+        test_inclusive_scan<float>();
+    }
+
+    TEST(Scan, Inclusive_scan_32u_in_place) {
+        std::vector<std::uint32_t> data(scan_test_size);
+        for (auto& x : data) {
+            x = random32u();
+        }
+
+        auto expected = data;
+        std::partial_sum(expected.begin(), expected.end(), expected.begin());
+
+        inclusive_scan(
+            Vectorized_view<const std::uint32_t>{data.data(), data.size()},
+            Vectorized_view<std::uint32_t>{data.data(), data.size()}
+        );
+
+        EXPECT_EQ(expected, data);
+    }
+
+    TEST(Scan, Inclusive_scan_32u_in_place_single_view) {
+        std::vector<std::uint32_t> data(scan_test_size);
+        for (auto& x : data) {
+            x = random32u();
+        }
+
+        auto expected = data;
+        std::partial_sum(expected.begin(), expected.end(), expected.begin());
+
+        Vectorized_view<std::uint32_t> view{data.data(), data.size()};
+        auto total = inclusive_scan(view, view);
+
+        EXPECT_EQ(expected, data);
+        EXPECT_EQ(expected.back(), total);
+    }
+
+    //=====================================================
+    // Exclusive scan
+    //=====================================================
+
+    TEST(Scan, Exclusive_scan_32u_random) {
+        for (std::size_t n = 0; n < scan_test_size; n += 1 + (n / 8)) {
+            std::vector<std::uint32_t> inputs(n);
+            for (auto& x : inputs) {
+                x = random32u();
+            }
+
+            std::vector<std::uint32_t> outputs(n);
+
+            auto init = random32u();
+            auto total = exclusive_scan(
+                Vectorized_view<const std::uint32_t>{inputs.data(), inputs.size()},
+                Vectorized_view<std::uint32_t>{outputs.data(), outputs.size()},
+                init
+            );
+
+            std::uint32_t sum = init;
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(sum, outputs[i]);
+                sum += inputs[i];
+            }
+
+            EXPECT_EQ(sum, total);
+        }
+    }
+
+    TEST(Scan, Exclusive_scan_8u_random) {
+        test_exclusive_scan<std::uint8_t>();
+    }
+
+    TEST(Scan, Exclusive_scan_64u_random) {
+        test_exclusive_scan<std::uint64_t>();
+    }
+
+    TEST(Scan, Exclusive_scan_32f_random) {
+        test_exclusive_scan<float>();
+    }
+
+    TEST(Scan, Exclusive_scan_32u_record_offsets) {
+        std::vector<std::uint32_t> lengths{3, 0, 5, 1, 1, 8, 2, 0, 4};
+        std::vector<std::uint32_t> offsets(lengths.size());
+
+        auto total = exclusive_scan(
+            Vectorized_view<const std::uint32_t>{lengths.data(), lengths.size()},
+            Vectorized_view<std::uint32_t>{offsets.data(), offsets.size()}
+        );
+
+        std::vector<std::uint32_t> expected{0, 3, 3, 8, 9, 10, 18, 20, 20};
+        EXPECT_EQ(expected, offsets);
+        EXPECT_EQ(24u, total);
+    }
+
+}
+
+#endif //AVEL_SCAN_TESTS_HPP
@@ -0,0 +1,231 @@
+#ifndef AVEL_SEARCH_TESTS_HPP
+#define AVEL_SEARCH_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t search_test_size = 2048 + 11;
+
+    static constexpr std::size_t search_test_queries = 64;
+
+    //=====================================================
+    // Sorted data generation
+    //=====================================================
+
+    ///
+    /// \return Sorted vector of n elements drawn from a small range of values
+    ///     so that duplicates are common
+    template<class T>
+    std::vector<T> sorted_search_data(std::size_t n) {
+        std::vector<T> ret(n);
+        for (auto& x : ret) {
+            x = T(int(random32u() % 200) - 100);
+        }
+        std::sort(ret.begin(), ret.end());
+        return ret;
+    }
+
+    template<class T>
+    T search_key() {
+        return T(int(random32u() % 220) - 110);
+    }
+
+    //=====================================================
+    // K-ary search
+    //=====================================================
+
+    template<class T>
+    void test_kary_search() {
+        for (std::size_t n = 0; n < search_test_size; n += 1 + (n / 4)) {
+            auto data = sorted_search_data<T>(n);
+            Vectorized_view<const T> view{data.data(), data.size()};
+
+            for (std::size_t i = 0; i < search_test_queries; ++i) {
+                T key = search_key<T>();
+
+                auto expected_lower = std::size_t(std::lower_bound(data.begin(), data.end(), key) - data.begin());
+                auto expected_upper = std::size_t(std::upper_bound(data.begin(), data.end(), key) - data.begin());
+
+                EXPECT_EQ(expected_lower, avel::lower_bound(view, key));
+                EXPECT_EQ(expected_upper, avel::upper_bound(view, key));
+            }
+
+            if (n != 0) {
+                EXPECT_EQ(0, avel::lower_bound(view, data.front()));
+                EXPECT_EQ(n, avel::upper_bound(view, data.back()));
+            }
+        }
+    }
+
+    TEST(Search, Kary_search_8u) {
+        test_kary_search<std::uint8_t>();
+    }
+
+    TEST(Search, Kary_search_8i) {
+        test_kary_search<std::int8_t>();
+    }
+
+    TEST(Search, Kary_search_16u) {
+        test_kary_search<std::uint16_t>();
+    }
+
+    TEST(Search, Kary_search_16i) {
+        test_kary_search<std::int16_t>();
+    }
+
+    TEST(Search, Kary_search_32u) {
+        test_kary_search<std::uint32_t>();
+    }
+
+    TEST(Search, Kary_search_32i) {
+        test_kary_search<std::int32_t>();
+    }
+
+    TEST(Search, Kary_search_64u) {
+        test_kary_search<std::uint64_t>();
+    }
+
+    TEST(Search, Kary_search_64i) {
+        test_kary_search<std::int64_t>();
+    }
+
+    TEST(Search, Kary_search_32f) {
+        test_kary_search<float>();
+    }
+
+    TEST(Search, Kary_search_64f) {
+        test_kary_search<double>();
+    }
+
+    //=====================================================
+    // Batched search
+    //=====================================================
+
+    template<class T>
+    void test_batch_search() {
+        using vec = Natural_width_vector<T>;
+
+        for (std::size_t n = 0; n < search_test_size; n += 1 + (n / 4)) {
+            auto data = sorted_search_data<T>(n);
+            Vectorized_view<const T> view{data.data(), data.size()};
+
+            for (std::size_t i = 0; i < search_test_queries; ++i) {
+                std::array<T, vec::width> keys;
+                for (auto& k : keys) {
+                    k = search_key<T>();
+                }
+
+                auto lower = to_array(avel::lower_bound(view, load<vec>(keys.data())));
+                auto upper = to_array(avel::upper_bound(view, load<vec>(keys.data())));
+
+                for (std::size_t j = 0; j < vec::width; ++j) {
+                    auto expected_lower = std::lower_bound(data.begin(), data.end(), keys[j]) - data.begin();
+                    auto expected_upper = std::upper_bound(data.begin(), data.end(), keys[j]) - data.begin();
+
+                    EXPECT_EQ(expected_lower, lower[j]);
+                    EXPECT_EQ(expected_upper, upper[j]);
+                }
+            }
+        }
+    }
+
+    TEST(Search, Batch_search_32u) {
+        test_batch_search<std::uint32_t>();
+    }
+
+    TEST(Search, Batch_search_32i) {
+        test_batch_search<std::int32_t>();
+    }
+
+    TEST(Search, Batch_search_64u) {
+        test_batch_search<std::uint64_t>();
+    }
+
+    TEST(Search, Batch_search_64i) {
+        test_batch_search<std::int64_t>();
+    }
+
+    TEST(Search, Batch_search_32f) {
+        test_batch_search<float>();
+    }
+
+    TEST(Search, Batch_search_64f) {
+        test_batch_search<double>();
+    }
+
+    //=====================================================
+    // B-tree layout
+    //=====================================================
+
+    template<class T>
+    void test_btree_layout() {
+        for (std::size_t n = 0; n < search_test_size; n += 1 + (n / 4)) {
+            auto data = sorted_search_data<T>(n);
+            Btree_layout<T> tree{Vectorized_view<const T>{data.data(), data.size()}};
+
+            EXPECT_EQ(n, tree.size());
+
+            std::vector<T> queries(search_test_queries + 3);
+            for (auto& q : queries) {
+                q = search_key<T>();
+            }
+
+            std::vector<std::size_t> lower(queries.size());
+            std::vector<std::size_t> upper(queries.size());
+            tree.lower_bound(Vectorized_view<const T>{queries.data(), queries.size()}, lower.data());
+            tree.upper_bound(Vectorized_view<const T>{queries.data(), queries.size()}, upper.data());
+
+            for (std::size_t i = 0; i < queries.size(); ++i) {
+                auto expected_lower = std::size_t(std::lower_bound(data.begin(), data.end(), queries[i]) - data.begin());
+                auto expected_upper = std::size_t(std::upper_bound(data.begin(), data.end(), queries[i]) - data.begin());
+
+                EXPECT_EQ(expected_lower, tree.lower_bound(queries[i]));
+                EXPECT_EQ(expected_upper, tree.upper_bound(queries[i]));
+
+                EXPECT_EQ(expected_lower, lower[i]);
+                EXPECT_EQ(expected_upper, upper[i]);
+            }
+        }
+    }
+
+    TEST(Search, Btree_layout_8u) {
+        test_btree_layout<std::uint8_t>();
+    }
+
+    TEST(Search, Btree_layout_16i) {
+        test_btree_layout<std::int16_t>();
+    }
+
+    TEST(Search, Btree_layout_32u) {
+        test_btree_layout<std::uint32_t>();
+    }
+
+    TEST(Search, Btree_layout_64i) {
+        test_btree_layout<std::int64_t>();
+    }
+
+    TEST(Search, Btree_layout_32f) {
+        test_btree_layout<float>();
+    }
+
+    TEST(Search, Btree_layout_64f) {
+        test_btree_layout<double>();
+    }
+
+    TEST(Search, Btree_layout_extreme_keys) {
+        // Keys equal to the padding value must not be confused with padding
+        std::vector<std::uint32_t> data(100, 5);
+        data.insert(data.end(), 37, std::numeric_limits<std::uint32_t>::max());
+
+        Btree_layout<std::uint32_t> tree{Vectorized_view<const std::uint32_t>{data.data(), data.size()}};
+
+        EXPECT_EQ(100, tree.lower_bound(std::numeric_limits<std::uint32_t>::max()));
+        EXPECT_EQ(137, tree.upper_bound(std::numeric_limits<std::uint32_t>::max()));
+        EXPECT_EQ(0, tree.lower_bound(0));
+        EXPECT_EQ(100, tree.upper_bound(5));
+    }
+
+}
+
+#endif //AVEL_SEARCH_TESTS_HPP
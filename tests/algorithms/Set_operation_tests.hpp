@@ -0,0 +1,140 @@
+#ifndef AVEL_SET_OPERATION_TESTS_HPP
+#define AVEL_SET_OPERATION_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t set_operation_test_size = 256 + 7;
+
+    //=====================================================
+    // Set operations
+    //=====================================================
+
+    template<class T>
+    std::vector<T> random_sorted_set(std::size_t n, std::uint32_t range) {
+        std::vector<T> ret(n);
+        for (auto& x : ret) {
+            x = T(random32u() % range);
+        }
+
+        std::sort(ret.begin(), ret.end());
+        ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+        return ret;
+    }
+
+    template<class T>
+    std::vector<T> random_full_range_set(std::size_t n) {
+        std::vector<T> ret(n);
+        for (auto& x : ret) {
+            x = random_val<T>();
+        }
+
+        std::sort(ret.begin(), ret.end());
+        ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+        return ret;
+    }
+
+    template<class T>
+    void check_set_operations(const std::vector<T>& a, const std::vector<T>& b) {
+        Vectorized_view<const T> va{a.data(), a.size()};
+        Vectorized_view<const T> vb{b.data(), b.size()};
+
+        std::vector<T> expected;
+        std::vector<T> out(a.size() + b.size());
+        Vectorized_view<T> vo{out.data(), out.size()};
+
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        auto k = set_intersection(va, vb, vo.first(std::min(a.size(), b.size())));
+        ASSERT_EQ(expected.size(), k);
+        for (std::size_t i = 0; i < k; ++i) {
+            EXPECT_EQ(expected[i], out[i]);
+        }
+
+        expected.clear();
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        k = set_union(va, vb, vo);
+        ASSERT_EQ(expected.size(), k);
+        for (std::size_t i = 0; i < k; ++i) {
+            EXPECT_EQ(expected[i], out[i]);
+        }
+
+        expected.clear();
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        k = set_difference(va, vb, vo.first(a.size()));
+        ASSERT_EQ(expected.size(), k);
+        for (std::size_t i = 0; i < k; ++i) {
+            EXPECT_EQ(expected[i], out[i]);
+        }
+    }
+
+    template<class T>
+    void test_set_operations() {
+        for (std::size_t n = 0; n < set_operation_test_size; n += 1 + (n / 8)) {
+            for (std::size_t m : {std::size_t(0), std::size_t(3), n / 2, n, 2 * n + 5}) {
+                // Small ranges produce many common elements
+                for (std::uint32_t range : {64u, 1024u, 1u << 30}) {
+                    auto a = random_sorted_set<T>(n, range);
+                    auto b = random_sorted_set<T>(m, range);
+
+                    check_set_operations(a, b);
+                    check_set_operations(b, a);
+                }
+            }
+        }
+
+        // Values drawn from the whole range of the type
+        for (std::size_t n = 0; n < set_operation_test_size; n += 1 + (n / 8)) {
+            auto a = random_full_range_set<T>(n);
+            auto b = random_full_range_set<T>(n);
+
+            check_set_operations(a, b);
+            check_set_operations(b, a);
+        }
+
+        // The smallest element of one set is the complement of the smallest
+        // element of the other
+        for (std::size_t n : {1, 4, 16, 32, 64, 128}) {
+            std::vector<T> a(n);
+            std::vector<T> b(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                a[i] = T(~T(0xFF) + T(i));
+                b[i] = T(T(0xFF) + T(i));
+            }
+
+            std::sort(a.begin(), a.end());
+            std::sort(b.begin(), b.end());
+
+            check_set_operations(a, b);
+            check_set_operations(b, a);
+        }
+
+        // Sizes which differ enough to take the galloping path
+        for (std::size_t n : {1, 5, 40, 100}) {
+            auto a = random_sorted_set<T>(n, 1u << 16);
+            auto b = random_sorted_set<T>(64 * 1024, 1u << 16);
+
+            check_set_operations(a, b);
+            check_set_operations(b, a);
+        }
+    }
+
+    TEST(Set_operations, Set_operations_32u_random) {
+        test_set_operations<std::uint32_t>();
+    }
+
+    TEST(Set_operations, Set_operations_32i_random) {
+        test_set_operations<std::int32_t>();
+    }
+
+    TEST(Set_operations, Set_operations_64u_random) {
+        test_set_operations<std::uint64_t>();
+    }
+
+    TEST(Set_operations, Set_operations_64i_random) {
+        test_set_operations<std::int64_t>();
+    }
+
+}
+
+#endif //AVEL_SET_OPERATION_TESTS_HPP
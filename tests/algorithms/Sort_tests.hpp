@@ -0,0 +1,197 @@
+#ifndef AVEL_SORT_TESTS_HPP
+#define AVEL_SORT_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t sort_test_size = 512 + 11;
+
+    // Large enough to be partitioned several times before being merge sorted
+    static constexpr std::size_t large_sort_test_size = 80 * 1024 + 3;
+
+    //=====================================================
+    // Key sorting
+    //=====================================================
+
+    template<class T>
+    void check_sort(std::vector<T> data) {
+        auto expected = data;
+        std::sort(expected.begin(), expected.end());
+
+        sort(Vectorized_view<T>{data.data(), data.size()});
+
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            EXPECT_EQ(expected[i], data[i]);
+        }
+    }
+
+    template<class T>
+    void test_sort() {
+        for (std::size_t n = 0; n < sort_test_size; n += 1 + (n / 8)) {
+            std::vector<T> data(n);
+            for (auto& x : data) {
+                x = random_val<T>();
+            }
+
+            check_sort(data);
+        }
+
+        std::vector<T> data(large_sort_test_size);
+        for (auto& x : data) {
+            x = random_val<T>();
+        }
+        check_sort(data);
+
+        // Many duplicates exercise the handling of keys equal to the pivot
+        for (auto& x : data) {
+            x = T(random32u() % 16);
+        }
+        check_sort(data);
+
+        std::sort(data.begin(), data.end());
+        std::reverse(data.begin(), data.end());
+        check_sort(data);
+
+        std::fill(data.begin(), data.end(), T(7));
+        check_sort(data);
+    }
+
+    TEST(Sort, Sort_32u_random) {
+        test_sort<std::uint32_t>();
+    }
+
+    TEST(Sort, Sort_32i_random) {
+        test_sort<std::int32_t>();
+    }
+
+    TEST(Sort, Sort_64u_random) {
+        test_sort<std::uint64_t>();
+    }
+
+    TEST(Sort, Sort_64i_random) {
+        test_sort<std::int64_t>();
+    }
+
+    TEST(Sort, Sort_32f_random) {
+        test_sort<float>();
+    }
+
+    TEST(Sort, Sort_64f_random) {
+        test_sort<double>();
+    }
+
+    //=====================================================
+    // Merging
+    //=====================================================
+
+    template<class T>
+    void test_merge_ranges() {
+        for (std::size_t na = 0; na < 70; na += 1 + (na / 4)) {
+            for (std::size_t nb = 0; nb < 70; nb += 1 + (nb / 4)) {
+                std::vector<T> a(na);
+                std::vector<T> b(nb);
+                for (auto& x : a) {
+                    x = T(random32u() % 32);
+                }
+                for (auto& x : b) {
+                    x = T(random32u() % 32);
+                }
+
+                std::sort(a.begin(), a.end());
+                std::sort(b.begin(), b.end());
+
+                std::vector<T> expected(na + nb);
+                std::merge(a.begin(), a.end(), b.begin(), b.end(), expected.begin());
+
+                std::vector<T> merged(na + nb);
+                avel_impl::merge_ranges(a.data(), na, b.data(), nb, merged.data());
+
+                EXPECT_EQ(expected, merged) << na << ", " << nb;
+            }
+        }
+    }
+
+    TEST(Sort, Merge_ranges_32u) {
+        test_merge_ranges<std::uint32_t>();
+    }
+
+    TEST(Sort, Merge_ranges_64f) {
+        test_merge_ranges<double>();
+    }
+
+    //=====================================================
+    // Key-value sorting
+    //=====================================================
+
+    template<class K, class P>
+    void check_sort_pairs(std::vector<K> keys) {
+        const auto original = keys;
+
+        std::vector<P> values(keys.size());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            values[i] = P(i);
+        }
+
+        sort(Vectorized_view<K>{keys.data(), keys.size()}, Vectorized_view<P>{values.data(), values.size()});
+
+        EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+        // Each payload must still accompany the key it started with
+        std::vector<bool> seen(keys.size(), false);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            auto j = static_cast<std::size_t>(values[i]);
+            ASSERT_LT(j, keys.size());
+            EXPECT_FALSE(seen[j]);
+            seen[j] = true;
+
+            EXPECT_EQ(original[j], keys[i]);
+        }
+    }
+
+    template<class K, class P>
+    void test_sort_pairs() {
+        for (std::size_t n = 0; n < sort_test_size; n += 1 + (n / 8)) {
+            std::vector<K> keys(n);
+            for (auto& x : keys) {
+                x = K(random32u() % 64);
+            }
+
+            check_sort_pairs<K, P>(keys);
+        }
+
+        std::vector<K> keys(large_sort_test_size);
+        for (auto& x : keys) {
+            x = random_val<K>();
+        }
+        check_sort_pairs<K, P>(keys);
+
+        for (auto& x : keys) {
+            x = K(random32u() % 16);
+        }
+        check_sort_pairs<K, P>(keys);
+    }
+
+    TEST(Sort, Sort_pairs_32u_32u_random) {
+        test_sort_pairs<std::uint32_t, std::uint32_t>();
+    }
+
+    TEST(Sort, Sort_pairs_32i_32u_random) {
+        test_sort_pairs<std::int32_t, std::uint32_t>();
+    }
+
+    TEST(Sort, Sort_pairs_32f_32i_random) {
+        test_sort_pairs<float, std::int32_t>();
+    }
+
+    TEST(Sort, Sort_pairs_64u_64u_random) {
+        test_sort_pairs<std::uint64_t, std::uint64_t>();
+    }
+
+    TEST(Sort, Sort_pairs_64f_64u_random) {
+        test_sort_pairs<double, std::uint64_t>();
+    }
+
+}
+
+#endif //AVEL_SORT_TESTS_HPP
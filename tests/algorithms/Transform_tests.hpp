@@ -0,0 +1,208 @@
+#ifndef AVEL_TRANSFORM_TESTS_HPP
+#define AVEL_TRANSFORM_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t transform_test_size = 512 + 3;
+
+    //=====================================================
+    // Unary transform
+    //=====================================================
+
+    TEST(Transform, Unary_8u_random) {
+        for (std::size_t n = 0; n < transform_test_size; n += 1 + (n / 8)) {
+            std::vector<std::uint8_t> inputs(n);
+            for (auto& x : inputs) {
+                x = random8u();
+            }
+
+            // Sentinel past the end of the output checks that the tail is
+            // not written past the end of the view
+            std::vector<std::uint8_t> outputs(n + 1, 0xAB);
+
+            transform(
+                Vectorized_view<const std::uint8_t>{inputs.data(), inputs.size()},
+                Vectorized_view<std::uint8_t>{outputs.data(), n},
+                [] (vecNx8u v) {
+                    return clamp(v, vecNx8u{16}, vecNx8u{200});
+                }
+            );
+
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(std::min<std::uint8_t>(std::max<std::uint8_t>(inputs[i], 16), 200), outputs[i]);
+            }
+            EXPECT_EQ(0xAB, outputs[n]);
+        }
+    }
+
+    TEST(Transform, Unary_32u_to_32i_random) {
+        for (std::size_t n = 0; n < transform_test_size; n += 1 + (n / 8)) {
+            std::vector<std::uint32_t> inputs(n);
+            for (auto& x : inputs) {
+                x = random32u();
+            }
+
+            std::vector<std::int32_t> outputs(n);
+
+            transform(
+                Vectorized_view<const std::uint32_t>{inputs.data(), inputs.size()},
+                Vectorized_view<std::int32_t>{outputs.data(), outputs.size()},
+                [] (vecNx32u v) {
+                    return vecNx32i{v >> 1} - vecNx32i{0x1000};
+                }
+            );
+
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(std::int32_t(inputs[i] >> 1) - 0x1000, outputs[i]);
+            }
+        }
+    }
+
+    TEST(Transform, Unary_in_place_unroll_random) {
+        for (std::size_t n = 0; n < transform_test_size; n += 1 + (n / 8)) {
+            std::vector<std::uint64_t> data(n);
+            for (auto& x : data) {
+                x = random64u();
+            }
+            auto expected = data;
+            for (auto& x : expected) {
+                x = x * 3 + 1;
+            }
+
+            auto f = [] (vecNx64u v) {
+                return v * vecNx64u{3} + vecNx64u{1};
+            };
+
+            Vectorized_view<std::uint64_t> view{data.data(), data.size()};
+            transform<3>(view, view, f);
+
+            EXPECT_EQ(expected, data);
+        }
+    }
+
+    //=====================================================
+    // Binary transform
+    //=====================================================
+
+    TEST(Transform, Binary_16i_random) {
+        for (std::size_t n = 0; n < transform_test_size; n += 1 + (n / 8)) {
+            std::vector<std::int16_t> inputs0(n);
+            std::vector<std::int16_t> inputs1(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                inputs0[i] = random16u();
+                inputs1[i] = random16u();
+            }
+
+            std::vector<std::int16_t> outputs(n + 1, 0x1234);
+
+            transform<1>(
+                Vectorized_view<const std::int16_t>{inputs0.data(), inputs0.size()},
+                Vectorized_view<const std::int16_t>{inputs1.data(), inputs1.size()},
+                Vectorized_view<std::int16_t>{outputs.data(), n},
+                [] (vecNx16i x, vecNx16i y) {
+                    return max(x, y) - (x ^ y);
+                }
+            );
+
+            for (std::size_t i = 0; i < n; ++i) {
+                std::int16_t expected = std::max(inputs0[i], inputs1[i]) - (inputs0[i] ^ inputs1[i]);
+                EXPECT_EQ(expected, outputs[i]);
+            }
+            EXPECT_EQ(0x1234, outputs[n]);
+        }
+    }
+
+    TEST(Transform, Binary_64f_random) {
+        for (std::size_t n = 0; n < transform_test_size; n += 1 + (n / 8)) {
+            std::vector<double> inputs0(n);
+            std::vector<double> inputs1(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                inputs0[i] = double(random32u()) / 7.0;
+                inputs1[i] = double(random32u()) / 3.0;
+            }
+
+            std::vector<double> outputs(n);
+
+            transform(
+                Vectorized_view<const double>{inputs0.data(), inputs0.size()},
+                Vectorized_view<const double>{inputs1.data(), inputs1.size()},
+                Vectorized_view<double>{outputs.data(), outputs.size()},
+                [] (vecNx64f x, vecNx64f y) {
+                    return x * y + x;
+                }
+            );
+
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(inputs0[i] * inputs1[i] + inputs0[i], outputs[i]);
+            }
+        }
+    }
+
+    //=====================================================
+    // Streaming transform
+    //=====================================================
+
+    // Large enough for the output to be written with non-temporal stores
+    static constexpr std::size_t stream_transform_test_size = AVEL_STREAMING_THRESHOLD / sizeof(std::uint32_t) + 13;
+
+    TEST(Transform, Stream_unary_32u_random) {
+        std::vector<std::uint32_t> inputs(stream_transform_test_size);
+        for (auto& x : inputs) {
+            x = random32u();
+        }
+
+        // Offsets leave the output misaligned so that leading elements must
+        // be written with ordinary stores
+        for (std::size_t offset : {0, 1, 3}) {
+            std::vector<std::uint32_t> outputs(inputs.size() + 1, 0xABABABAB);
+            const std::size_t n = inputs.size() - offset;
+
+            stream_transform(
+                Vectorized_view<const std::uint32_t>{inputs.data(), n},
+                Vectorized_view<std::uint32_t>{outputs.data() + offset, n},
+                [] (vecNx32u v) {
+                    return (v ^ vecNx32u{0x5555}) + vecNx32u{7};
+                }
+            );
+
+            for (std::size_t i = 0; i < offset; ++i) {
+                EXPECT_EQ(0xABABABAB, outputs[i]);
+            }
+            for (std::size_t i = 0; i < n; ++i) {
+                ASSERT_EQ((inputs[i] ^ 0x5555) + 7, outputs[i + offset]);
+            }
+            EXPECT_EQ(0xABABABAB, outputs[n + offset]);
+        }
+    }
+
+    TEST(Transform, Stream_binary_32f_random) {
+        for (std::size_t n : {std::size_t(100), stream_transform_test_size}) {
+            std::vector<float> inputs0(n);
+            std::vector<float> inputs1(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                inputs0[i] = float(random32u() % 1024);
+                inputs1[i] = float(random32u() % 1024);
+            }
+
+            std::vector<float> outputs(n);
+
+            stream_transform(
+                Vectorized_view<const float>{inputs0.data(), n - 1},
+                Vectorized_view<const float>{inputs1.data(), n - 1},
+                Vectorized_view<float>{outputs.data() + 1, n - 1},
+                [] (vecNx32f x, vecNx32f y) {
+                    return x * y;
+                }
+            );
+
+            for (std::size_t i = 0; i + 1 < n; ++i) {
+                ASSERT_EQ(inputs0[i] * inputs1[i], outputs[i + 1]);
+            }
+        }
+    }
+
+}
+
+#endif //AVEL_TRANSFORM_TESTS_HPP
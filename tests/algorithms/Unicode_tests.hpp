@@ -0,0 +1,299 @@
+#ifndef AVEL_UNICODE_TESTS_HPP
+#define AVEL_UNICODE_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t unicode_test_iterations = 512;
+
+    static constexpr std::size_t unicode_test_max_code_points = 300;
+
+    //=====================================================
+    // Reference implementation
+    //=====================================================
+
+    inline void encode_utf8_reference(std::uint32_t c, std::vector<std::uint8_t>& out) {
+        if (c < 0x80) {
+            out.push_back(std::uint8_t(c));
+        } else if (c < 0x800) {
+            out.push_back(std::uint8_t(0xC0 | (c >> 6)));
+            out.push_back(std::uint8_t(0x80 | (c & 0x3F)));
+        } else if (c < 0x10000) {
+            out.push_back(std::uint8_t(0xE0 | (c >> 12)));
+            out.push_back(std::uint8_t(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back(std::uint8_t(0x80 | (c & 0x3F)));
+        } else {
+            out.push_back(std::uint8_t(0xF0 | (c >> 18)));
+            out.push_back(std::uint8_t(0x80 | ((c >> 12) & 0x3F)));
+            out.push_back(std::uint8_t(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back(std::uint8_t(0x80 | (c & 0x3F)));
+        }
+    }
+
+    inline void encode_utf16_reference(std::uint32_t c, std::vector<std::uint16_t>& out) {
+        if (c < 0x10000) {
+            out.push_back(std::uint16_t(c));
+        } else {
+            out.push_back(std::uint16_t(0xD800 + ((c - 0x10000) >> 10)));
+            out.push_back(std::uint16_t(0xDC00 + ((c - 0x10000) & 0x3FF)));
+        }
+    }
+
+    ///
+    /// Validates UTF-8 by attempting to re-encode each decoded code point
+    ///
+    /// \return Offset of first invalid sequence, or data.size()
+    inline std::size_t validate_utf8_reference(const std::vector<std::uint8_t>& data) {
+        std::size_t i = 0;
+        while (i < data.size()) {
+            std::uint8_t b = data[i];
+
+            std::size_t length = 0;
+            std::uint32_t c = 0;
+            if (b < 0x80) {
+                length = 1;
+                c = b;
+            } else if ((b & 0xE0) == 0xC0) {
+                length = 2;
+                c = b & 0x1F;
+            } else if ((b & 0xF0) == 0xE0) {
+                length = 3;
+                c = b & 0x0F;
+            } else if ((b & 0xF8) == 0xF0) {
+                length = 4;
+                c = b & 0x07;
+            } else {
+                return i;
+            }
+
+            if (i + length > data.size()) {
+                return i;
+            }
+
+            for (std::size_t j = 1; j < length; ++j) {
+                if ((data[i + j] & 0xC0) != 0x80) {
+                    return i;
+                }
+                c = (c << 6) | (data[i + j] & 0x3F);
+            }
+
+            std::vector<std::uint8_t> encoded;
+            bool is_surrogate = (0xD800 <= c && c <= 0xDFFF);
+            if (c > 0x10FFFF || is_surrogate) {
+                return i;
+            }
+
+            encode_utf8_reference(c, encoded);
+            if (encoded.size() != length) {
+                return i;
+            }
+
+            i += length;
+        }
+
+        return data.size();
+    }
+
+    ///
+    /// \return Random code point, weighted so that encodings of every length
+    ///     are common
+    inline std::uint32_t random_code_point() {
+        switch (random32u() % 6) {
+            case 0:
+            case 1: return random32u() % 0x80;
+            case 2: return 0x80 + random32u() % (0x800 - 0x80);
+            case 3: {
+                std::uint32_t c = 0x800 + random32u() % (0x10000 - 0x800 - 0x800);
+                return (c >= 0xD800) ? c + 0x800 : c;
+            }
+            default: return 0x10000 + random32u() % (0x110000 - 0x10000);
+        }
+    }
+
+    inline std::vector<std::uint32_t> random_code_points() {
+        std::vector<std::uint32_t> ret(random32u() % unicode_test_max_code_points);
+
+        // Mostly ASCII text exercises the ASCII fast paths
+        bool mostly_ascii = random32u() % 2;
+        for (auto& c : ret) {
+            c = (mostly_ascii && random32u() % 16) ? random32u() % 0x80 : random_code_point();
+        }
+
+        return ret;
+    }
+
+    //=====================================================
+    // Validation
+    //=====================================================
+
+    TEST(Unicode, Validate_utf8_valid) {
+        for (std::size_t iteration = 0; iteration < unicode_test_iterations; ++iteration) {
+            std::vector<std::uint8_t> data;
+            for (auto c : random_code_points()) {
+                encode_utf8_reference(c, data);
+            }
+
+            EXPECT_EQ(data.size(), validate_utf8(Vectorized_view<const std::uint8_t>{data.data(), data.size()}));
+        }
+    }
+
+    TEST(Unicode, Validate_utf8_corrupted) {
+        for (std::size_t iteration = 0; iteration < 4 * unicode_test_iterations; ++iteration) {
+            std::vector<std::uint8_t> data;
+            for (auto c : random_code_points()) {
+                encode_utf8_reference(c, data);
+            }
+
+            if (data.empty()) {
+                continue;
+            }
+
+            switch (random32u() % 3) {
+                case 0:
+                    // Random byte
+                    data[random32u() % data.size()] = random8u();
+                    break;
+                case 1:
+                    // Truncation
+                    data.resize(random32u() % data.size());
+                    break;
+                case 2:
+                    // Byte likely to start an invalid sequence
+                    static const std::uint8_t bad_bytes[] = {0x80, 0xBF, 0xC0, 0xC1, 0xE0, 0xED, 0xF0, 0xF4, 0xF5, 0xFF};
+                    data[random32u() % data.size()] = bad_bytes[random32u() % sizeof(bad_bytes)];
+                    break;
+            }
+
+            auto expected = validate_utf8_reference(data);
+            EXPECT_EQ(expected, validate_utf8(Vectorized_view<const std::uint8_t>{data.data(), data.size()}));
+        }
+    }
+
+    TEST(Unicode, Validate_utf8_edge_cases) {
+        struct Case {
+            std::vector<std::uint8_t> bytes;
+            std::size_t expected;
+        };
+
+        const Case cases[] = {
+            {{}, 0},
+            {{0xC2, 0x80}, 2},
+            {{0xC1, 0xBF}, 0},
+            {{0xE0, 0x9F, 0xBF}, 0},
+            {{0xE0, 0xA0, 0x80}, 3},
+            {{0xED, 0x9F, 0xBF}, 3},
+            {{0xED, 0xA0, 0x80}, 0},
+            {{0xF0, 0x8F, 0xBF, 0xBF}, 0},
+            {{0xF4, 0x8F, 0xBF, 0xBF}, 4},
+            {{0xF4, 0x90, 0x80, 0x80}, 0},
+            {{0x41, 0xE2, 0x82}, 1},
+            {{0x41, 0x80}, 1}
+        };
+
+        for (const auto& c : cases) {
+            // Place each case after a long run of ASCII so that it falls
+            // within and across vector blocks at every offset
+            for (std::size_t prefix = 0; prefix < 130; ++prefix) {
+                std::vector<std::uint8_t> data(prefix, 'a');
+                data.insert(data.end(), c.bytes.begin(), c.bytes.end());
+
+                EXPECT_EQ(prefix + c.expected, validate_utf8(Vectorized_view<const std::uint8_t>{data.data(), data.size()}));
+            }
+        }
+    }
+
+    //=====================================================
+    // Transcoding
+    //=====================================================
+
+    TEST(Unicode, Utf8_to_utf16_random) {
+        for (std::size_t iteration = 0; iteration < unicode_test_iterations; ++iteration) {
+            std::vector<std::uint8_t> utf8;
+            std::vector<std::uint16_t> expected;
+            for (auto c : random_code_points()) {
+                encode_utf8_reference(c, utf8);
+                encode_utf16_reference(c, expected);
+            }
+
+            Vectorized_view<const std::uint8_t> in{utf8.data(), utf8.size()};
+            EXPECT_EQ(expected.size(), utf16_length_from_utf8(in));
+
+            std::vector<std::uint16_t> out(expected.size() + 1, 0xFFFF);
+            auto result = utf8_to_utf16(in, Vectorized_view<std::uint16_t>{out.data(), expected.size()});
+
+            EXPECT_EQ(utf8.size(), result.read);
+            EXPECT_EQ(expected.size(), result.written);
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+            EXPECT_EQ(0xFFFF, out.back());
+        }
+    }
+
+    TEST(Unicode, Utf8_to_utf16_invalid) {
+        for (std::size_t iteration = 0; iteration < unicode_test_iterations; ++iteration) {
+            std::vector<std::uint8_t> utf8;
+            for (auto c : random_code_points()) {
+                encode_utf8_reference(c, utf8);
+            }
+
+            if (utf8.empty()) {
+                continue;
+            }
+
+            utf8[random32u() % utf8.size()] = 0xFF;
+            auto first_invalid = validate_utf8_reference(utf8);
+
+            std::vector<std::uint16_t> out(utf8.size());
+            auto result = utf8_to_utf16(
+                Vectorized_view<const std::uint8_t>{utf8.data(), utf8.size()},
+                Vectorized_view<std::uint16_t>{out.data(), out.size()}
+            );
+
+            EXPECT_EQ(first_invalid, result.read);
+        }
+    }
+
+    TEST(Unicode, Utf16_to_utf8_random) {
+        for (std::size_t iteration = 0; iteration < unicode_test_iterations; ++iteration) {
+            std::vector<std::uint16_t> utf16;
+            std::vector<std::uint8_t> expected;
+            for (auto c : random_code_points()) {
+                encode_utf16_reference(c, utf16);
+                encode_utf8_reference(c, expected);
+            }
+
+            Vectorized_view<const std::uint16_t> in{utf16.data(), utf16.size()};
+            EXPECT_EQ(expected.size(), utf8_length_from_utf16(in));
+
+            std::vector<std::uint8_t> out(expected.size() + 1, 0xFF);
+            auto result = utf16_to_utf8(in, Vectorized_view<std::uint8_t>{out.data(), expected.size()});
+
+            EXPECT_EQ(utf16.size(), result.read);
+            EXPECT_EQ(expected.size(), result.written);
+            EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+            EXPECT_EQ(0xFF, out.back());
+        }
+    }
+
+    TEST(Unicode, Utf16_to_utf8_unpaired_surrogates) {
+        for (std::uint16_t surrogate : {std::uint16_t(0xD800), std::uint16_t(0xDBFF), std::uint16_t(0xDC00), std::uint16_t(0xDFFF)}) {
+            for (std::size_t prefix = 0; prefix < 70; ++prefix) {
+                std::vector<std::uint16_t> utf16(prefix, 'a');
+                utf16.push_back(surrogate);
+                utf16.push_back('b');
+
+                std::vector<std::uint8_t> out(4 * utf16.size());
+                auto result = utf16_to_utf8(
+                    Vectorized_view<const std::uint16_t>{utf16.data(), utf16.size()},
+                    Vectorized_view<std::uint8_t>{out.data(), out.size()}
+                );
+
+                EXPECT_EQ(prefix, result.read);
+                EXPECT_EQ(prefix, result.written);
+            }
+        }
+    }
+
+}
+
+#endif //AVEL_UNICODE_TESTS_HPP
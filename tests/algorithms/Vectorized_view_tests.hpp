@@ -0,0 +1,195 @@
+#ifndef AVEL_VECTORIZED_VIEW_TESTS_HPP
+#define AVEL_VECTORIZED_VIEW_TESTS_HPP
+
+namespace avel_tests {
+
+    using namespace avel;
+
+    static constexpr std::size_t view_test_size = 256 + 5;
+
+    //=====================================================
+    // Chunk access
+    //=====================================================
+
+    template<class T>
+    void test_view_chunks() {
+        using view_type = Vectorized_view<T>;
+        using vec = typename view_type::vector_type;
+        constexpr std::size_t width = view_type::chunk_width;
+
+        for (std::size_t n = 0; n < view_test_size; n += 1 + (n / 16)) {
+            // Padding past the end of the view ensures that partial chunks
+            // don't write past the end
+            std::vector<T> data(n + width);
+            for (auto& x : data) {
+                x = random_val<T>();
+            }
+            auto original = data;
+
+            view_type view{data.data(), n};
+
+            EXPECT_EQ((n + width - 1) / width, view.chunk_count());
+            EXPECT_EQ(n / width, view.full_chunk_count());
+
+            for (std::size_t i = 0; i < view.chunk_count(); ++i) {
+                auto chunk = view.load_chunk(i);
+                auto elements = to_array(chunk);
+                auto count = view.chunk_size(i);
+
+                EXPECT_EQ(std::min(n - i * width, width), count);
+
+                for (std::size_t j = 0; j < width; ++j) {
+                    if (j < count) {
+                        EXPECT_EQ(original[i * width + j], elements[j]);
+                    } else {
+                        EXPECT_EQ(T(0), elements[j]);
+                    }
+                }
+
+                view.store_chunk(i, vec{T(0)});
+            }
+
+            for (std::size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(T(0), data[i]);
+            }
+
+            for (std::size_t i = n; i < data.size(); ++i) {
+                EXPECT_EQ(original[i], data[i]);
+            }
+        }
+    }
+
+    TEST(Vectorized_view, Chunks_8u_random) {
+        test_view_chunks<std::uint8_t>();
+    }
+
+    TEST(Vectorized_view, Chunks_8i_random) {
+        test_view_chunks<std::int8_t>();
+    }
+
+    TEST(Vectorized_view, Chunks_16u_random) {
+        test_view_chunks<std::uint16_t>();
+    }
+
+    TEST(Vectorized_view, Chunks_16i_random) {
+        test_view_chunks<std::int16_t>();
+    }
+
+    TEST(Vectorized_view, Chunks_32u_random) {
+        test_view_chunks<std::uint32_t>();
+    }
+
+    TEST(Vectorized_view, Chunks_32i_random) {
+        test_view_chunks<std::int32_t>();
+    }
+
+    TEST(Vectorized_view, Chunks_64u_random) {
+        test_view_chunks<std::uint64_t>();
+    }
+
+    TEST(Vectorized_view, Chunks_64i_random) {
+        test_view_chunks<std::int64_t>();
+    }
+
+    TEST(Vectorized_view, Chunks_32f_random) {
+        test_view_chunks<float>();
+    }
+
+    TEST(Vectorized_view, Chunks_64f_random) {
+        test_view_chunks<double>();
+    }
+
+    TEST(Vectorized_view, Aligned_chunks_32u_random) {
+        using view_type = Vectorized_view<std::uint32_t, Dynamic_extent, alignof(vecNx32u)>;
+
+        std::vector<std::uint32_t, Aligned_allocator<std::uint32_t, alignof(vecNx32u)>> storage(view_test_size);
+        auto* ptr = storage.data();
+        for (std::size_t i = 0; i < view_test_size; ++i) {
+            ptr[i] = random32u();
+        }
+
+        view_type view{ptr, view_test_size};
+        view.transform_chunks([] (vecNx32u v) {
+            return v + vecNx32u{1};
+        });
+
+        std::uint64_t sum = 0;
+        Vectorized_view<const std::uint32_t, Dynamic_extent, alignof(vecNx32u)> const_view{view};
+        const_view.for_each_chunk([&] (vecNx32u v, std::uint32_t count) {
+            auto elements = to_array(v);
+            for (std::uint32_t i = 0; i < count; ++i) {
+                sum += elements[i];
+            }
+        });
+
+        std::uint64_t expected = 0;
+        for (std::size_t i = 0; i < view_test_size; ++i) {
+            expected += ptr[i];
+        }
+
+        EXPECT_EQ(expected, sum);
+    }
+
+    TEST(Vectorized_view, Chunks_alignment) {
+        using line_view = Vectorized_view<std::uint32_t, Dynamic_extent, AVEL_L1_CACHE_LINE_SIZE>;
+        using vector_view = Vectorized_view<std::uint32_t, Dynamic_extent, alignof(vecNx32u)>;
+        using element_view = Vectorized_view<std::uint32_t>;
+
+        // Chunks only begin at multiples of the vector size
+        constexpr std::size_t vector_size = sizeof(vecNx32u);
+        constexpr std::size_t line_alignment = (AVEL_L1_CACHE_LINE_SIZE < vector_size) ? AVEL_L1_CACHE_LINE_SIZE : vector_size;
+        EXPECT_EQ(line_alignment, decltype(std::declval<line_view>().chunks(1, 1))::alignment);
+        EXPECT_EQ(alignof(vecNx32u), decltype(std::declval<vector_view>().chunks(1, 1))::alignment);
+        EXPECT_EQ(alignof(std::uint32_t), decltype(std::declval<element_view>().chunks(1, 1))::alignment);
+
+        std::vector<std::uint32_t, Aligned_allocator<std::uint32_t, AVEL_L1_CACHE_LINE_SIZE>> storage(view_test_size);
+        line_view view{storage.data(), storage.size()};
+        for (std::size_t i = 0; i < view.chunk_count(); ++i) {
+            auto c = view.chunks(i, 1);
+            EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(c.data()) % decltype(c)::alignment);
+        }
+    }
+
+    //=====================================================
+    // Subviews
+    //=====================================================
+
+    TEST(Vectorized_view, Subviews) {
+        std::vector<std::int16_t> data(100);
+        std::iota(data.begin(), data.end(), 0);
+
+        Vectorized_view16i view{data.data(), data.size()};
+
+        auto f = view.first(10);
+        EXPECT_EQ(10, f.size());
+        EXPECT_EQ(data.data(), f.data());
+
+        auto f4 = view.first<4>();
+        EXPECT_EQ(4, f4.size());
+        EXPECT_EQ(data.data(), f4.data());
+
+        auto l = view.last(7);
+        EXPECT_EQ(7, l.size());
+        EXPECT_EQ(93, l[0]);
+
+        auto s = view.subview(20, 30);
+        EXPECT_EQ(30, s.size());
+        EXPECT_EQ(20, s[0]);
+        EXPECT_EQ(49, s[29]);
+
+        auto r = view.subview(90);
+        EXPECT_EQ(10, r.size());
+        EXPECT_EQ(90, r[0]);
+
+        constexpr std::size_t width = Vectorized_view16i::chunk_width;
+        auto c = view.chunks(1, 2);
+        EXPECT_EQ(std::min<std::size_t>(2 * width, data.size() - width), c.size());
+        EXPECT_EQ(std::int16_t(width), c[0]);
+
+        auto past_end = view.chunks(view.chunk_count(), 1);
+        EXPECT_TRUE(past_end.empty());
+    }
+
+}
+
+#endif //AVEL_VECTORIZED_VIEW_TESTS_HPP
@@ -326,6 +326,12 @@ namespace avel_tests {
         }
     }
 
+    TEST(Scalar32u, Fmix_known_values) {
+        EXPECT_EQ(std::uint32_t{0u}, fmix(std::uint32_t{0u}));
+        EXPECT_EQ(std::uint32_t{0x514e28b7u}, fmix(std::uint32_t{1u}));
+        EXPECT_EQ(std::uint32_t{0x0de5c6a9u}, fmix(std::uint32_t{0xdeadbeefu}));
+    }
+
 }
 
 #endif //AVEL_SCALAR32U_TESTS_HPP
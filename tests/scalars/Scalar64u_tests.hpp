@@ -40,6 +40,12 @@ namespace avel_tests {
         }
     }
 
+    TEST(Scalar64u, Fmix_known_values) {
+        EXPECT_EQ(std::uint64_t{0ull}, fmix(std::uint64_t{0ull}));
+        EXPECT_EQ(std::uint64_t{0xb456bcfc34c2cb2cull}, fmix(std::uint64_t{1ull}));
+        EXPECT_EQ(std::uint64_t{0x87cbfbfe89022ceaull}, fmix(std::uint64_t{0x0123456789abcdefull}));
+    }
+
 }
 
 #endif //AVEL_SCALAR64U_TESTS_HPP
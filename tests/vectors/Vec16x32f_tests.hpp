@@ -457,6 +457,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask16x32f, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr16xb>();
+            mask16x32f v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask16x32f, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr16xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask16x32f>(bits);
+
+            EXPECT_TRUE(results == mask16x32f{expected});
+        }
+    }
+
+    TEST(Mask16x32f, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr16xb>();
+            mask16x32f v{inputs};
+
+            arr16xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask16x32f, Find_first_edge_cases) {
+        EXPECT_EQ(16, find_first(mask16x32f{false}));
+        EXPECT_EQ(0, find_first(mask16x32f{true}));
+    }
+
+    TEST(Mask16x32f, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr16xb>();
+            mask16x32f v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask16x32f, Find_last_edge_cases) {
+        EXPECT_EQ(16, find_last(mask16x32f{false}));
+        EXPECT_EQ(mask16x32f::width - 1, find_last(mask16x32f{true}));
+    }
+
+    TEST(Mask16x32f, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr16xb>();
+            mask16x32f v{inputs};
+
+            std::uint32_t expected = mask16x32f::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec16x32f tests
     //=========================================================================
@@ -1602,6 +1689,29 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec16x32f, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr16x32f>();
+
+            vec16x32f v{inputs};
+
+            alignas(alignof(vec16x32f)) vec16x32f::scalar arr[vec16x32f::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec16x32f::width));
+        }
+    }
+
+    TEST(Vec16x32f, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec16x32f)) auto inputs = random_array<arr16x32f>();
+
+            auto v = stream_load<vec16x32f>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec16x32f::width));
+        }
+    }
+
     TEST(Vec16x32f, Scatter_n_random) {
         static constexpr std::size_t test_data_size = 16 * 1024;
         static constexpr std::size_t block_size = test_data_size / vec16x32f::width;
@@ -2661,6 +2771,54 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec16x32f, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            arr16x32f inputs{};
+            for (auto& x : inputs) {
+                x = static_cast<vec16x32f::scalar>(random8u() % 64);
+            }
+
+            vec16x32f v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr16x32f expected{};
+            vec16x32f::scalar sum = 0.0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = sum;
+            }
+
+            EXPECT_TRUE(all(results == vec16x32f{expected}));
+        }
+    }
+
+    TEST(Vec16x32f, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            arr16x32f inputs{};
+            for (auto& x : inputs) {
+                x = static_cast<vec16x32f::scalar>(random8u() % 64);
+            }
+
+            vec16x32f v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr16x32f expected{};
+            vec16x32f::scalar sum = 0.0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = sum;
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec16x32f{expected}));
+        }
+    }
+
 }
 
 #endif //AVEL_VEC16X32F_TESTS_HPP
@@ -427,6 +427,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask1x64u, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1xb>();
+            mask1x64u v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask1x64u, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr1xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask1x64u>(bits);
+
+            EXPECT_TRUE(results == mask1x64u{expected});
+        }
+    }
+
+    TEST(Mask1x64u, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1xb>();
+            mask1x64u v{inputs};
+
+            arr1xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask1x64u, Find_first_edge_cases) {
+        EXPECT_EQ(1, find_first(mask1x64u{false}));
+        EXPECT_EQ(0, find_first(mask1x64u{true}));
+    }
+
+    TEST(Mask1x64u, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1xb>();
+            mask1x64u v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask1x64u, Find_last_edge_cases) {
+        EXPECT_EQ(1, find_last(mask1x64u{false}));
+        EXPECT_EQ(mask1x64u::width - 1, find_last(mask1x64u{true}));
+    }
+
+    TEST(Mask1x64u, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1xb>();
+            mask1x64u v{inputs};
+
+            std::uint32_t expected = mask1x64u::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec1x64u tests
     //=========================================================================
@@ -2117,6 +2204,29 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec1x64u, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1x64u>();
+
+            vec1x64u v{inputs};
+
+            alignas(alignof(vec1x64u)) vec1x64u::scalar arr[vec1x64u::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec1x64u::width));
+        }
+    }
+
+    TEST(Vec1x64u, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec1x64u)) auto inputs = random_array<arr1x64u>();
+
+            auto v = stream_load<vec1x64u>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec1x64u::width));
+        }
+    }
+
 
     TEST(Vec1x64u, Scatter_n_random) {
         static constexpr std::size_t test_data_size = 16 * 1024;
@@ -2505,6 +2615,69 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec1x64u, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1x64u>();
+
+            vec1x64u v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr1x64u expected{};
+            std::make_unsigned<vec1x64u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = static_cast<vec1x64u::scalar>(sum);
+            }
+
+            EXPECT_TRUE(all(results == vec1x64u{expected}));
+        }
+    }
+
+    TEST(Vec1x64u, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1x64u>();
+
+            vec1x64u v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr1x64u expected{};
+            std::make_unsigned<vec1x64u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = static_cast<vec1x64u::scalar>(sum);
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec1x64u{expected}));
+        }
+    }
+
+    //=====================================================
+    // Hashing
+    //=====================================================
+
+    TEST(Vec1x64u, Fmix_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1x64u>();
+
+            vec1x64u v{inputs};
+
+            auto results = fmix(v);
+
+            arr1x64u expected{};
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = fmix(inputs[j]);
+            }
+
+            EXPECT_TRUE(all(results == vec1x64u{expected}));
+        }
+    }
+
 }
 
 #endif
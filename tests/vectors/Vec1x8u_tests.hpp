@@ -427,6 +427,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask1x8u, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1xb>();
+            mask1x8u v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask1x8u, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr1xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask1x8u>(bits);
+
+            EXPECT_TRUE(results == mask1x8u{expected});
+        }
+    }
+
+    TEST(Mask1x8u, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1xb>();
+            mask1x8u v{inputs};
+
+            arr1xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask1x8u, Find_first_edge_cases) {
+        EXPECT_EQ(1, find_first(mask1x8u{false}));
+        EXPECT_EQ(0, find_first(mask1x8u{true}));
+    }
+
+    TEST(Mask1x8u, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1xb>();
+            mask1x8u v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask1x8u, Find_last_edge_cases) {
+        EXPECT_EQ(1, find_last(mask1x8u{false}));
+        EXPECT_EQ(mask1x8u::width - 1, find_last(mask1x8u{true}));
+    }
+
+    TEST(Mask1x8u, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1xb>();
+            mask1x8u v{inputs};
+
+            std::uint32_t expected = mask1x8u::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec1x8u tests
     //=========================================================================
@@ -1770,6 +1857,70 @@ namespace avel_tests {
 
 
 
+    TEST(Vec1x8u, Gather_n_random) {
+        static constexpr std::size_t test_data_size = 256;
+
+        // Padding allows gathers to be performed from misaligned addresses
+        std::vector<vec1x8u::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec1x8u::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr1x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec1x8u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec1x8u>(index_array.data());
+
+            for (std::size_t j = 0; j <= vec1x8u::width; ++j) {
+                auto results = gather<vec1x8u>(base, indices, j);
+
+                auto loaded_data = to_array(results);
+                for (std::size_t k = 0; k < vec1x8u::width; k++) {
+                    if (k < j) {
+                        EXPECT_EQ(base[index_array[k]], loaded_data[k]);
+                    } else {
+                        EXPECT_EQ(0x0, loaded_data[k]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec1x8u, Gather_random) {
+        static constexpr std::size_t test_data_size = 256;
+
+        std::vector<vec1x8u::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec1x8u::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr1x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec1x8u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec1x8u>(index_array.data());
+
+            auto results = gather<vec1x8u>(base, indices);
+
+            arr1x8u expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = base[index_array[j]];
+            }
+
+            EXPECT_TRUE(all(results == vec1x8u{expected}));
+            EXPECT_TRUE(all(results == gather<vec1x8u>(base, indices, vec1x8u::width)));
+        }
+    }
+
     TEST(Vec1x8u, Store_n) {
         for (std::size_t i = 0; i < iterations; ++i) {
             auto inputs = random_array<arr1x8u>();
@@ -1840,7 +1991,88 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec1x8u, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1x8u>();
+
+            vec1x8u v{inputs};
+
+            alignas(alignof(vec1x8u)) vec1x8u::scalar arr[vec1x8u::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec1x8u::width));
+        }
+    }
+
+    TEST(Vec1x8u, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec1x8u)) auto inputs = random_array<arr1x8u>();
+
+            auto v = stream_load<vec1x8u>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec1x8u::width));
+        }
+    }
+
+
+
+    TEST(Vec1x8u, Scatter_n_random) {
+        static constexpr std::size_t test_data_size = 256;
+        static constexpr std::size_t block_size = test_data_size / vec1x8u::width;
+
+        std::vector<vec1x8u::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr1x8u>();
+
+            vec1x8u input0{input_array0};
+
+            arr1x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec1x8u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec1x8u indices{index_array};
+
+            for (std::size_t j = 0; j <= vec1x8u::width; ++j) {
+                std::fill(test_data.begin(), test_data.end(), 0x00);
+                scatter(test_data.data(), input0, indices, j);
+
+                for (std::size_t k = 0; k < input_array0.size(); ++k) {
+                    if (k < j) {
+                        EXPECT_EQ(input_array0[k], test_data[index_array[k]]);
+                    } else {
+                        EXPECT_EQ(0x00, test_data[index_array[k]]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec1x8u, Scatter_random) {
+        static constexpr std::size_t test_data_size = 256;
+        static constexpr std::size_t block_size = test_data_size / vec1x8u::width;
+
+        std::vector<vec1x8u::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr1x8u>();
+
+            vec1x8u input0{input_array0};
 
+            arr1x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec1x8u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec1x8u indices{index_array};
+
+            scatter(test_data.data(), input0, indices);
+            EXPECT_TRUE(compare_stored_data(test_data.data(), input0, indices, vec1x8u::width));
+        }
+    }
 
     TEST(Vec1x8u, To_array_random) {
         for (std::size_t i = 0; i < iterations; ++i) {
@@ -2172,6 +2404,48 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec1x8u, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1x8u>();
+
+            vec1x8u v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr1x8u expected{};
+            std::make_unsigned<vec1x8u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = static_cast<vec1x8u::scalar>(sum);
+            }
+
+            EXPECT_TRUE(all(results == vec1x8u{expected}));
+        }
+    }
+
+    TEST(Vec1x8u, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr1x8u>();
+
+            vec1x8u v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr1x8u expected{};
+            std::make_unsigned<vec1x8u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = static_cast<vec1x8u::scalar>(sum);
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec1x8u{expected}));
+        }
+    }
+
 }
 
 #endif
@@ -429,6 +429,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask2x64f, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2xb>();
+            mask2x64f v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask2x64f, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr2xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask2x64f>(bits);
+
+            EXPECT_TRUE(results == mask2x64f{expected});
+        }
+    }
+
+    TEST(Mask2x64f, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2xb>();
+            mask2x64f v{inputs};
+
+            arr2xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask2x64f, Find_first_edge_cases) {
+        EXPECT_EQ(2, find_first(mask2x64f{false}));
+        EXPECT_EQ(0, find_first(mask2x64f{true}));
+    }
+
+    TEST(Mask2x64f, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2xb>();
+            mask2x64f v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask2x64f, Find_last_edge_cases) {
+        EXPECT_EQ(2, find_last(mask2x64f{false}));
+        EXPECT_EQ(mask2x64f::width - 1, find_last(mask2x64f{true}));
+    }
+
+    TEST(Mask2x64f, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2xb>();
+            mask2x64f v{inputs};
+
+            std::uint32_t expected = mask2x64f::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec2x64f tests
     //=========================================================================
@@ -1476,6 +1563,29 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec2x64f, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2x64f>();
+
+            vec2x64f v{inputs};
+
+            alignas(alignof(vec2x64f)) vec2x64f::scalar arr[vec2x64f::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec2x64f::width));
+        }
+    }
+
+    TEST(Vec2x64f, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec2x64f)) auto inputs = random_array<arr2x64f>();
+
+            auto v = stream_load<vec2x64f>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec2x64f::width));
+        }
+    }
+
     TEST(Vec2x64f, Scatter_n_random) {
         static constexpr std::size_t test_data_size = 16 * 1024;
         static constexpr std::size_t block_size = test_data_size / vec2x64f::width;
@@ -2521,6 +2631,54 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec2x64f, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            arr2x64f inputs{};
+            for (auto& x : inputs) {
+                x = static_cast<vec2x64f::scalar>(random8u() % 64);
+            }
+
+            vec2x64f v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr2x64f expected{};
+            vec2x64f::scalar sum = 0.0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = sum;
+            }
+
+            EXPECT_TRUE(all(results == vec2x64f{expected}));
+        }
+    }
+
+    TEST(Vec2x64f, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            arr2x64f inputs{};
+            for (auto& x : inputs) {
+                x = static_cast<vec2x64f::scalar>(random8u() % 64);
+            }
+
+            vec2x64f v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr2x64f expected{};
+            vec2x64f::scalar sum = 0.0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = sum;
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec2x64f{expected}));
+        }
+    }
+
 }
 
 #endif //AVEL_VEC2X64F_TESTS_HPP
@@ -429,6 +429,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask2x64i, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2xb>();
+            mask2x64i v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask2x64i, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr2xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask2x64i>(bits);
+
+            EXPECT_TRUE(results == mask2x64i{expected});
+        }
+    }
+
+    TEST(Mask2x64i, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2xb>();
+            mask2x64i v{inputs};
+
+            arr2xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask2x64i, Find_first_edge_cases) {
+        EXPECT_EQ(2, find_first(mask2x64i{false}));
+        EXPECT_EQ(0, find_first(mask2x64i{true}));
+    }
+
+    TEST(Mask2x64i, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2xb>();
+            mask2x64i v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask2x64i, Find_last_edge_cases) {
+        EXPECT_EQ(2, find_last(mask2x64i{false}));
+        EXPECT_EQ(mask2x64i::width - 1, find_last(mask2x64i{true}));
+    }
+
+    TEST(Mask2x64i, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2xb>();
+            mask2x64i v{inputs};
+
+            std::uint32_t expected = mask2x64i::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec2x64i tests
     //=========================================================================
@@ -567,6 +654,19 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec2x64i, Less_than_comparison_equal_high_halves) {
+        // Elements which differ only in their low halves, where the low halves
+        // differ in their most significant bit
+        arr2x64i inputs0{std::int64_t(0x0000000100000001ll), std::int64_t(0xffffffff80000000ll)};
+        arr2x64i inputs1{std::int64_t(0x0000000180000000ll), std::int64_t(0xffffffff00000001ll)};
+
+        vec2x64i v0{inputs0};
+        vec2x64i v1{inputs1};
+
+        EXPECT_EQ(v0 < v1, (mask2x64i{arr2xb{true, false}}));
+        EXPECT_EQ(v1 < v0, (mask2x64i{arr2xb{false, true}}));
+    }
+
     TEST(Vec2x64i, Less_than_or_equal_comparison_random) {
         for (std::size_t i = 0; i < iterations; ++i) {
             auto inputs0 = random_array<arr2x64i>();
@@ -2175,6 +2275,29 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec2x64i, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2x64i>();
+
+            vec2x64i v{inputs};
+
+            alignas(alignof(vec2x64i)) vec2x64i::scalar arr[vec2x64i::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec2x64i::width));
+        }
+    }
+
+    TEST(Vec2x64i, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec2x64i)) auto inputs = random_array<arr2x64i>();
+
+            auto v = stream_load<vec2x64i>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec2x64i::width));
+        }
+    }
+
     TEST(Vec2x64i, Scatter_n_random) {
         static constexpr std::size_t test_data_size = 16 * 1024;
         static constexpr std::size_t block_size = test_data_size / vec2x64i::width;
@@ -2506,6 +2629,48 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec2x64i, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2x64i>();
+
+            vec2x64i v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr2x64i expected{};
+            std::make_unsigned<vec2x64i::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = static_cast<vec2x64i::scalar>(sum);
+            }
+
+            EXPECT_TRUE(all(results == vec2x64i{expected}));
+        }
+    }
+
+    TEST(Vec2x64i, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr2x64i>();
+
+            vec2x64i v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr2x64i expected{};
+            std::make_unsigned<vec2x64i::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = static_cast<vec2x64i::scalar>(sum);
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec2x64i{expected}));
+        }
+    }
+
 }
 
 #endif
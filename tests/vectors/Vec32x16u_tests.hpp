@@ -489,6 +489,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask32x16u, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32xb>();
+            mask32x16u v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask32x16u, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr32xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask32x16u>(bits);
+
+            EXPECT_TRUE(results == mask32x16u{expected});
+        }
+    }
+
+    TEST(Mask32x16u, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32xb>();
+            mask32x16u v{inputs};
+
+            arr32xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask32x16u, Find_first_edge_cases) {
+        EXPECT_EQ(32, find_first(mask32x16u{false}));
+        EXPECT_EQ(0, find_first(mask32x16u{true}));
+    }
+
+    TEST(Mask32x16u, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32xb>();
+            mask32x16u v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask32x16u, Find_last_edge_cases) {
+        EXPECT_EQ(32, find_last(mask32x16u{false}));
+        EXPECT_EQ(mask32x16u::width - 1, find_last(mask32x16u{true}));
+    }
+
+    TEST(Mask32x16u, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32xb>();
+            mask32x16u v{inputs};
+
+            std::uint32_t expected = mask32x16u::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec32x16u tests
     //=========================================================================
@@ -1988,6 +2075,70 @@ namespace avel_tests {
 
 
 
+    TEST(Vec32x16u, Gather_n_random) {
+        static constexpr std::size_t test_data_size = 16 * 1024;
+
+        // Padding allows gathers to be performed from misaligned addresses
+        std::vector<vec32x16u::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec32x16u::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr32x16u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec32x16u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec32x16u>(index_array.data());
+
+            for (std::size_t j = 0; j <= vec32x16u::width; ++j) {
+                auto results = gather<vec32x16u>(base, indices, j);
+
+                auto loaded_data = to_array(results);
+                for (std::size_t k = 0; k < vec32x16u::width; k++) {
+                    if (k < j) {
+                        EXPECT_EQ(base[index_array[k]], loaded_data[k]);
+                    } else {
+                        EXPECT_EQ(0x0, loaded_data[k]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec32x16u, Gather_random) {
+        static constexpr std::size_t test_data_size = 16 * 1024;
+
+        std::vector<vec32x16u::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec32x16u::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr32x16u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec32x16u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec32x16u>(index_array.data());
+
+            auto results = gather<vec32x16u>(base, indices);
+
+            arr32x16u expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = base[index_array[j]];
+            }
+
+            EXPECT_TRUE(all(results == vec32x16u{expected}));
+            EXPECT_TRUE(all(results == gather<vec32x16u>(base, indices, vec32x16u::width)));
+        }
+    }
+
     TEST(Vec32x16u, Store_n) {
         for (std::size_t i = 0; i < iterations; ++i) {
             auto inputs = random_array<arr32x16u>();
@@ -2120,7 +2271,88 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec32x16u, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32x16u>();
+
+            vec32x16u v{inputs};
+
+            alignas(alignof(vec32x16u)) vec32x16u::scalar arr[vec32x16u::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec32x16u::width));
+        }
+    }
+
+    TEST(Vec32x16u, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec32x16u)) auto inputs = random_array<arr32x16u>();
+
+            auto v = stream_load<vec32x16u>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec32x16u::width));
+        }
+    }
+
+
+
+    TEST(Vec32x16u, Scatter_n_random) {
+        static constexpr std::size_t test_data_size = 16 * 1024;
+        static constexpr std::size_t block_size = test_data_size / vec32x16u::width;
+
+        std::vector<vec32x16u::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr32x16u>();
+
+            vec32x16u input0{input_array0};
+
+            arr32x16u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec32x16u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec32x16u indices{index_array};
+
+            for (std::size_t j = 0; j <= vec32x16u::width; ++j) {
+                std::fill(test_data.begin(), test_data.end(), 0x00);
+                scatter(test_data.data(), input0, indices, j);
+
+                for (std::size_t k = 0; k < input_array0.size(); ++k) {
+                    if (k < j) {
+                        EXPECT_EQ(input_array0[k], test_data[index_array[k]]);
+                    } else {
+                        EXPECT_EQ(0x00, test_data[index_array[k]]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec32x16u, Scatter_random) {
+        static constexpr std::size_t test_data_size = 16 * 1024;
+        static constexpr std::size_t block_size = test_data_size / vec32x16u::width;
+
+        std::vector<vec32x16u::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr32x16u>();
+
+            vec32x16u input0{input_array0};
 
+            arr32x16u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec32x16u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec32x16u indices{index_array};
+
+            scatter(test_data.data(), input0, indices);
+            EXPECT_TRUE(compare_stored_data(test_data.data(), input0, indices, vec32x16u::width));
+        }
+    }
 
     TEST(Vec32x16u, To_array_random) {
         for (std::size_t i = 0; i < iterations; ++i) {
@@ -2452,6 +2684,48 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec32x16u, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32x16u>();
+
+            vec32x16u v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr32x16u expected{};
+            std::make_unsigned<vec32x16u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = static_cast<vec32x16u::scalar>(sum);
+            }
+
+            EXPECT_TRUE(all(results == vec32x16u{expected}));
+        }
+    }
+
+    TEST(Vec32x16u, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32x16u>();
+
+            vec32x16u v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr32x16u expected{};
+            std::make_unsigned<vec32x16u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = static_cast<vec32x16u::scalar>(sum);
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec32x16u{expected}));
+        }
+    }
+
 }
 
 #endif
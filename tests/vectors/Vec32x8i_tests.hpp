@@ -489,6 +489,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask32x8i, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32xb>();
+            mask32x8i v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask32x8i, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr32xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask32x8i>(bits);
+
+            EXPECT_TRUE(results == mask32x8i{expected});
+        }
+    }
+
+    TEST(Mask32x8i, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32xb>();
+            mask32x8i v{inputs};
+
+            arr32xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask32x8i, Find_first_edge_cases) {
+        EXPECT_EQ(32, find_first(mask32x8i{false}));
+        EXPECT_EQ(0, find_first(mask32x8i{true}));
+    }
+
+    TEST(Mask32x8i, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32xb>();
+            mask32x8i v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask32x8i, Find_last_edge_cases) {
+        EXPECT_EQ(32, find_last(mask32x8i{false}));
+        EXPECT_EQ(mask32x8i::width - 1, find_last(mask32x8i{true}));
+    }
+
+    TEST(Mask32x8i, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32xb>();
+            mask32x8i v{inputs};
+
+            std::uint32_t expected = mask32x8i::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec32x8i tests
     //=========================================================================
@@ -2005,6 +2092,70 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec32x8i, Gather_n_random) {
+        static constexpr std::size_t test_data_size = 256;
+
+        // Padding allows gathers to be performed from misaligned addresses
+        std::vector<vec32x8i::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec32x8i::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr32x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec32x8u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec32x8u>(index_array.data());
+
+            for (std::size_t j = 0; j <= vec32x8i::width; ++j) {
+                auto results = gather<vec32x8i>(base, indices, j);
+
+                auto loaded_data = to_array(results);
+                for (std::size_t k = 0; k < vec32x8i::width; k++) {
+                    if (k < j) {
+                        EXPECT_EQ(base[index_array[k]], loaded_data[k]);
+                    } else {
+                        EXPECT_EQ(0x0, loaded_data[k]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec32x8i, Gather_random) {
+        static constexpr std::size_t test_data_size = 256;
+
+        std::vector<vec32x8i::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec32x8i::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr32x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec32x8u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec32x8u>(index_array.data());
+
+            auto results = gather<vec32x8i>(base, indices);
+
+            arr32x8i expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = base[index_array[j]];
+            }
+
+            EXPECT_TRUE(all(results == vec32x8i{expected}));
+            EXPECT_TRUE(all(results == gather<vec32x8i>(base, indices, vec32x8i::width)));
+        }
+    }
+
     TEST(Vec32x8i, Store_n) {
         for (std::size_t i = 0; i < iterations; ++i) {
             auto inputs = random_array<arr32x8i>();
@@ -2137,6 +2288,87 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec32x8i, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32x8i>();
+
+            vec32x8i v{inputs};
+
+            alignas(alignof(vec32x8i)) vec32x8i::scalar arr[vec32x8i::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec32x8i::width));
+        }
+    }
+
+    TEST(Vec32x8i, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec32x8i)) auto inputs = random_array<arr32x8i>();
+
+            auto v = stream_load<vec32x8i>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec32x8i::width));
+        }
+    }
+
+    TEST(Vec32x8i, Scatter_n_random) {
+        static constexpr std::size_t test_data_size = 256;
+        static constexpr std::size_t block_size = test_data_size / vec32x8i::width;
+
+        std::vector<vec32x8i::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr32x8i>();
+
+            vec32x8i input0{input_array0};
+
+            arr32x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec32x8u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec32x8u indices{index_array};
+
+            for (std::size_t j = 0; j <= vec32x8i::width; ++j) {
+                std::fill(test_data.begin(), test_data.end(), 0x00);
+                scatter(test_data.data(), input0, indices, j);
+
+                for (std::size_t k = 0; k < input_array0.size(); ++k) {
+                    if (k < j) {
+                        EXPECT_EQ(input_array0[k], test_data[index_array[k]]);
+                    } else {
+                        EXPECT_EQ(0x00, test_data[index_array[k]]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec32x8i, Scatter_random) {
+        static constexpr std::size_t test_data_size = 256;
+        static constexpr std::size_t block_size = test_data_size / vec32x8i::width;
+
+        std::vector<vec32x8i::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr32x8i>();
+
+            vec32x8i input0{input_array0};
+
+            arr32x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec32x8u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec32x8u indices{index_array};
+
+            scatter(test_data.data(), input0, indices);
+            EXPECT_TRUE(compare_stored_data(test_data.data(), input0, indices, vec32x8i::width));
+        }
+    }
+
     TEST(Vec32x8i, To_array_random) {
         for (std::size_t i = 0; i < iterations; ++i) {
             auto inputs = random_array<arr32x8i>();
@@ -2411,6 +2643,48 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec32x8i, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32x8i>();
+
+            vec32x8i v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr32x8i expected{};
+            std::make_unsigned<vec32x8i::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = static_cast<vec32x8i::scalar>(sum);
+            }
+
+            EXPECT_TRUE(all(results == vec32x8i{expected}));
+        }
+    }
+
+    TEST(Vec32x8i, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr32x8i>();
+
+            vec32x8i v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr32x8i expected{};
+            std::make_unsigned<vec32x8i::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = static_cast<vec32x8i::scalar>(sum);
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec32x8i{expected}));
+        }
+    }
+
 }
 
 #endif
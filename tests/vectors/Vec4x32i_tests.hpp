@@ -433,6 +433,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask4x32i, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4xb>();
+            mask4x32i v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask4x32i, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr4xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask4x32i>(bits);
+
+            EXPECT_TRUE(results == mask4x32i{expected});
+        }
+    }
+
+    TEST(Mask4x32i, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4xb>();
+            mask4x32i v{inputs};
+
+            arr4xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask4x32i, Find_first_edge_cases) {
+        EXPECT_EQ(4, find_first(mask4x32i{false}));
+        EXPECT_EQ(0, find_first(mask4x32i{true}));
+    }
+
+    TEST(Mask4x32i, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4xb>();
+            mask4x32i v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask4x32i, Find_last_edge_cases) {
+        EXPECT_EQ(4, find_last(mask4x32i{false}));
+        EXPECT_EQ(mask4x32i::width - 1, find_last(mask4x32i{true}));
+    }
+
+    TEST(Mask4x32i, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4xb>();
+            mask4x32i v{inputs};
+
+            std::uint32_t expected = mask4x32i::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec4x32i tests
     //=========================================================================
@@ -2065,6 +2152,29 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec4x32i, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4x32i>();
+
+            vec4x32i v{inputs};
+
+            alignas(alignof(vec4x32i)) vec4x32i::scalar arr[vec4x32i::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec4x32i::width));
+        }
+    }
+
+    TEST(Vec4x32i, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec4x32i)) auto inputs = random_array<arr4x32i>();
+
+            auto v = stream_load<vec4x32i>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec4x32i::width));
+        }
+    }
+
     TEST(Vec4x32i, Scatter_n_random) {
         static constexpr std::size_t test_data_size = 16 * 1024;
         static constexpr std::size_t block_size = test_data_size / vec4x32i::width;
@@ -2398,6 +2508,48 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec4x32i, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4x32i>();
+
+            vec4x32i v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr4x32i expected{};
+            std::make_unsigned<vec4x32i::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = static_cast<vec4x32i::scalar>(sum);
+            }
+
+            EXPECT_TRUE(all(results == vec4x32i{expected}));
+        }
+    }
+
+    TEST(Vec4x32i, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4x32i>();
+
+            vec4x32i v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr4x32i expected{};
+            std::make_unsigned<vec4x32i::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = static_cast<vec4x32i::scalar>(sum);
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec4x32i{expected}));
+        }
+    }
+
 }
 
 #endif
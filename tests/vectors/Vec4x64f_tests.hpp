@@ -433,6 +433,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask4x64f, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4xb>();
+            mask4x64f v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask4x64f, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr4xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask4x64f>(bits);
+
+            EXPECT_TRUE(results == mask4x64f{expected});
+        }
+    }
+
+    TEST(Mask4x64f, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4xb>();
+            mask4x64f v{inputs};
+
+            arr4xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask4x64f, Find_first_edge_cases) {
+        EXPECT_EQ(4, find_first(mask4x64f{false}));
+        EXPECT_EQ(0, find_first(mask4x64f{true}));
+    }
+
+    TEST(Mask4x64f, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4xb>();
+            mask4x64f v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask4x64f, Find_last_edge_cases) {
+        EXPECT_EQ(4, find_last(mask4x64f{false}));
+        EXPECT_EQ(mask4x64f::width - 1, find_last(mask4x64f{true}));
+    }
+
+    TEST(Mask4x64f, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4xb>();
+            mask4x64f v{inputs};
+
+            std::uint32_t expected = mask4x64f::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec4x64f tests
     //=========================================================================
@@ -1494,6 +1581,29 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec4x64f, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr4x64f>();
+
+            vec4x64f v{inputs};
+
+            alignas(alignof(vec4x64f)) vec4x64f::scalar arr[vec4x64f::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec4x64f::width));
+        }
+    }
+
+    TEST(Vec4x64f, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec4x64f)) auto inputs = random_array<arr4x64f>();
+
+            auto v = stream_load<vec4x64f>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec4x64f::width));
+        }
+    }
+
     TEST(Vec4x64f, Scatter_n_random) {
         static constexpr std::size_t test_data_size = 16 * 1024;
         static constexpr std::size_t block_size = test_data_size / vec4x64f::width;
@@ -2541,6 +2651,54 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec4x64f, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            arr4x64f inputs{};
+            for (auto& x : inputs) {
+                x = static_cast<vec4x64f::scalar>(random8u() % 64);
+            }
+
+            vec4x64f v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr4x64f expected{};
+            vec4x64f::scalar sum = 0.0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = sum;
+            }
+
+            EXPECT_TRUE(all(results == vec4x64f{expected}));
+        }
+    }
+
+    TEST(Vec4x64f, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            arr4x64f inputs{};
+            for (auto& x : inputs) {
+                x = static_cast<vec4x64f::scalar>(random8u() % 64);
+            }
+
+            vec4x64f v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr4x64f expected{};
+            vec4x64f::scalar sum = 0.0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = sum;
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec4x64f{expected}));
+        }
+    }
+
 }
 
 #endif //AVEL_VEC4X64F_TESTS_HPP
@@ -553,6 +553,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask64x8u, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr64xb>();
+            mask64x8u v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask64x8u, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr64xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask64x8u>(bits);
+
+            EXPECT_TRUE(results == mask64x8u{expected});
+        }
+    }
+
+    TEST(Mask64x8u, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr64xb>();
+            mask64x8u v{inputs};
+
+            arr64xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask64x8u, Find_first_edge_cases) {
+        EXPECT_EQ(64, find_first(mask64x8u{false}));
+        EXPECT_EQ(0, find_first(mask64x8u{true}));
+    }
+
+    TEST(Mask64x8u, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr64xb>();
+            mask64x8u v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask64x8u, Find_last_edge_cases) {
+        EXPECT_EQ(64, find_last(mask64x8u{false}));
+        EXPECT_EQ(mask64x8u::width - 1, find_last(mask64x8u{true}));
+    }
+
+    TEST(Mask64x8u, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr64xb>();
+            mask64x8u v{inputs};
+
+            std::uint32_t expected = mask64x8u::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec64x8u tests
     //=========================================================================
@@ -2148,6 +2235,70 @@ namespace avel_tests {
 
 
 
+    TEST(Vec64x8u, Gather_n_random) {
+        static constexpr std::size_t test_data_size = 256;
+
+        // Padding allows gathers to be performed from misaligned addresses
+        std::vector<vec64x8u::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec64x8u::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr64x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec64x8u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec64x8u>(index_array.data());
+
+            for (std::size_t j = 0; j <= vec64x8u::width; ++j) {
+                auto results = gather<vec64x8u>(base, indices, j);
+
+                auto loaded_data = to_array(results);
+                for (std::size_t k = 0; k < vec64x8u::width; k++) {
+                    if (k < j) {
+                        EXPECT_EQ(base[index_array[k]], loaded_data[k]);
+                    } else {
+                        EXPECT_EQ(0x0, loaded_data[k]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec64x8u, Gather_random) {
+        static constexpr std::size_t test_data_size = 256;
+
+        std::vector<vec64x8u::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec64x8u::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr64x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec64x8u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec64x8u>(index_array.data());
+
+            auto results = gather<vec64x8u>(base, indices);
+
+            arr64x8u expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = base[index_array[j]];
+            }
+
+            EXPECT_TRUE(all(results == vec64x8u{expected}));
+            EXPECT_TRUE(all(results == gather<vec64x8u>(base, indices, vec64x8u::width)));
+        }
+    }
+
     TEST(Vec64x8u, Store_n) {
         for (std::size_t i = 0; i < iterations; ++i) {
             auto inputs = random_array<arr64x8u>();
@@ -2344,7 +2495,88 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec64x8u, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr64x8u>();
+
+            vec64x8u v{inputs};
+
+            alignas(alignof(vec64x8u)) vec64x8u::scalar arr[vec64x8u::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec64x8u::width));
+        }
+    }
+
+    TEST(Vec64x8u, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec64x8u)) auto inputs = random_array<arr64x8u>();
+
+            auto v = stream_load<vec64x8u>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec64x8u::width));
+        }
+    }
+
+
+
+    TEST(Vec64x8u, Scatter_n_random) {
+        static constexpr std::size_t test_data_size = 256;
+        static constexpr std::size_t block_size = test_data_size / vec64x8u::width;
+
+        std::vector<vec64x8u::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr64x8u>();
+
+            vec64x8u input0{input_array0};
+
+            arr64x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec64x8u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec64x8u indices{index_array};
+
+            for (std::size_t j = 0; j <= vec64x8u::width; ++j) {
+                std::fill(test_data.begin(), test_data.end(), 0x00);
+                scatter(test_data.data(), input0, indices, j);
+
+                for (std::size_t k = 0; k < input_array0.size(); ++k) {
+                    if (k < j) {
+                        EXPECT_EQ(input_array0[k], test_data[index_array[k]]);
+                    } else {
+                        EXPECT_EQ(0x00, test_data[index_array[k]]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec64x8u, Scatter_random) {
+        static constexpr std::size_t test_data_size = 256;
+        static constexpr std::size_t block_size = test_data_size / vec64x8u::width;
+
+        std::vector<vec64x8u::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr64x8u>();
+
+            vec64x8u input0{input_array0};
+
+            arr64x8u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec64x8u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec64x8u indices{index_array};
 
+            scatter(test_data.data(), input0, indices);
+            EXPECT_TRUE(compare_stored_data(test_data.data(), input0, indices, vec64x8u::width));
+        }
+    }
 
     TEST(Vec64x8u, To_array_random) {
         for (std::size_t i = 0; i < iterations; ++i) {
@@ -2676,6 +2908,143 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec64x8u, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr64x8u>();
+
+            vec64x8u v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr64x8u expected{};
+            std::make_unsigned<vec64x8u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = static_cast<vec64x8u::scalar>(sum);
+            }
+
+            EXPECT_TRUE(all(results == vec64x8u{expected}));
+        }
+    }
+
+    TEST(Vec64x8u, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr64x8u>();
+
+            vec64x8u v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr64x8u expected{};
+            std::make_unsigned<vec64x8u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = static_cast<vec64x8u::scalar>(sum);
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec64x8u{expected}));
+        }
+    }
+
+    //=====================================================
+    // Table lookup operations
+    //=====================================================
+
+    TEST(Vec64x8u, Lookup16_random) {
+        std::array<std::uint8_t, 16> table_data{};
+        for (auto& x : table_data) {
+            x = random8u();
+        }
+
+        auto table = load<vec16x8u>(table_data.data());
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto indices = random_array<arr64x8u>();
+
+            auto results = lookup16(table, vec64x8u{indices});
+
+            arr64x8u expected{};
+            for (std::size_t j = 0; j < indices.size(); ++j) {
+                expected[j] = (indices[j] < 16) ? table_data[indices[j]] : 0x00;
+            }
+
+            EXPECT_TRUE(all(results == vec64x8u{expected}));
+        }
+    }
+
+    TEST(Vec64x8u, Lookup32_random) {
+        std::array<std::uint8_t, 32> table_data{};
+        for (auto& x : table_data) {
+            x = random8u();
+        }
+
+        auto table = load<vec32x8u>(table_data.data());
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto indices = random_array<arr64x8u>();
+
+            auto results = lookup32(table, vec64x8u{indices});
+
+            arr64x8u expected{};
+            for (std::size_t j = 0; j < indices.size(); ++j) {
+                expected[j] = (indices[j] < 32) ? table_data[indices[j]] : 0x00;
+            }
+
+            EXPECT_TRUE(all(results == vec64x8u{expected}));
+        }
+    }
+
+    TEST(Vec64x8u, Lookup64_random) {
+        std::array<std::uint8_t, 64> table_data{};
+        for (auto& x : table_data) {
+            x = random8u();
+        }
+
+        auto table = load<vec64x8u>(table_data.data());
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto indices = random_array<arr64x8u>();
+
+            auto results = lookup64(table, vec64x8u{indices});
+
+            arr64x8u expected{};
+            for (std::size_t j = 0; j < indices.size(); ++j) {
+                expected[j] = (indices[j] < 64) ? table_data[indices[j]] : 0x00;
+            }
+
+            EXPECT_TRUE(all(results == vec64x8u{expected}));
+        }
+    }
+
+    TEST(Vec64x8u, Lookup128_random) {
+        std::array<std::uint8_t, 128> table_data{};
+        for (auto& x : table_data) {
+            x = random8u();
+        }
+
+        std::array<vec64x8u, 2> table{{
+            load<vec64x8u>(table_data.data() + 0),
+            load<vec64x8u>(table_data.data() + 64)
+        }};
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto indices = random_array<arr64x8u>();
+
+            auto results = lookup128(table, vec64x8u{indices});
+
+            arr64x8u expected{};
+            for (std::size_t j = 0; j < indices.size(); ++j) {
+                expected[j] = (indices[j] < 128) ? table_data[indices[j]] : 0x00;
+            }
+
+            EXPECT_TRUE(all(results == vec64x8u{expected}));
+        }
+    }
+
 }
 
 #endif
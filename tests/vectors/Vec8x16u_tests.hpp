@@ -441,6 +441,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask8x16u, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x16u v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask8x16u, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr8xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask8x16u>(bits);
+
+            EXPECT_TRUE(results == mask8x16u{expected});
+        }
+    }
+
+    TEST(Mask8x16u, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x16u v{inputs};
+
+            arr8xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask8x16u, Find_first_edge_cases) {
+        EXPECT_EQ(8, find_first(mask8x16u{false}));
+        EXPECT_EQ(0, find_first(mask8x16u{true}));
+    }
+
+    TEST(Mask8x16u, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x16u v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask8x16u, Find_last_edge_cases) {
+        EXPECT_EQ(8, find_last(mask8x16u{false}));
+        EXPECT_EQ(mask8x16u::width - 1, find_last(mask8x16u{true}));
+    }
+
+    TEST(Mask8x16u, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x16u v{inputs};
+
+            std::uint32_t expected = mask8x16u::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec8x16u tests
     //=========================================================================
@@ -1844,6 +1931,70 @@ namespace avel_tests {
 
 
 
+    TEST(Vec8x16u, Gather_n_random) {
+        static constexpr std::size_t test_data_size = 16 * 1024;
+
+        // Padding allows gathers to be performed from misaligned addresses
+        std::vector<vec8x16u::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec8x16u::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr8x16u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec8x16u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec8x16u>(index_array.data());
+
+            for (std::size_t j = 0; j <= vec8x16u::width; ++j) {
+                auto results = gather<vec8x16u>(base, indices, j);
+
+                auto loaded_data = to_array(results);
+                for (std::size_t k = 0; k < vec8x16u::width; k++) {
+                    if (k < j) {
+                        EXPECT_EQ(base[index_array[k]], loaded_data[k]);
+                    } else {
+                        EXPECT_EQ(0x0, loaded_data[k]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec8x16u, Gather_random) {
+        static constexpr std::size_t test_data_size = 16 * 1024;
+
+        std::vector<vec8x16u::scalar> test_data{};
+        test_data.resize(test_data_size + 3);
+        for (auto& x : test_data) {
+            x = random_val<vec8x16u::scalar>();
+        }
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto* base = test_data.data() + (i % 4);
+
+            arr8x16u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = random_val<vec8x16u::scalar>() % test_data_size;
+            }
+            auto indices = load<vec8x16u>(index_array.data());
+
+            auto results = gather<vec8x16u>(base, indices);
+
+            arr8x16u expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = base[index_array[j]];
+            }
+
+            EXPECT_TRUE(all(results == vec8x16u{expected}));
+            EXPECT_TRUE(all(results == gather<vec8x16u>(base, indices, vec8x16u::width)));
+        }
+    }
+
     TEST(Vec8x16u, Store_n) {
         for (std::size_t i = 0; i < iterations; ++i) {
             auto inputs = random_array<arr8x16u>();
@@ -1928,7 +2079,88 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec8x16u, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8x16u>();
+
+            vec8x16u v{inputs};
+
+            alignas(alignof(vec8x16u)) vec8x16u::scalar arr[vec8x16u::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec8x16u::width));
+        }
+    }
+
+    TEST(Vec8x16u, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec8x16u)) auto inputs = random_array<arr8x16u>();
+
+            auto v = stream_load<vec8x16u>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec8x16u::width));
+        }
+    }
+
+
+
+    TEST(Vec8x16u, Scatter_n_random) {
+        static constexpr std::size_t test_data_size = 16 * 1024;
+        static constexpr std::size_t block_size = test_data_size / vec8x16u::width;
+
+        std::vector<vec8x16u::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr8x16u>();
+
+            vec8x16u input0{input_array0};
+
+            arr8x16u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec8x16u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec8x16u indices{index_array};
+
+            for (std::size_t j = 0; j <= vec8x16u::width; ++j) {
+                std::fill(test_data.begin(), test_data.end(), 0x00);
+                scatter(test_data.data(), input0, indices, j);
+
+                for (std::size_t k = 0; k < input_array0.size(); ++k) {
+                    if (k < j) {
+                        EXPECT_EQ(input_array0[k], test_data[index_array[k]]);
+                    } else {
+                        EXPECT_EQ(0x00, test_data[index_array[k]]);
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Vec8x16u, Scatter_random) {
+        static constexpr std::size_t test_data_size = 16 * 1024;
+        static constexpr std::size_t block_size = test_data_size / vec8x16u::width;
+
+        std::vector<vec8x16u::scalar> test_data{};
+        test_data.resize(test_data_size);
+
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto input_array0 = random_array<arr8x16u>();
+
+            vec8x16u input0{input_array0};
 
+            arr8x16u index_array{};
+            for (std::size_t j = 0; j < index_array.size(); ++j) {
+                index_array[j] = (random_val<vec8x16u::scalar>() % block_size) + (j * block_size);
+            }
+
+            vec8x16u indices{index_array};
+
+            scatter(test_data.data(), input0, indices);
+            EXPECT_TRUE(compare_stored_data(test_data.data(), input0, indices, vec8x16u::width));
+        }
+    }
 
     TEST(Vec8x16u, To_array_random) {
         for (std::size_t i = 0; i < iterations; ++i) {
@@ -2260,6 +2492,48 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec8x16u, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8x16u>();
+
+            vec8x16u v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr8x16u expected{};
+            std::make_unsigned<vec8x16u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = static_cast<vec8x16u::scalar>(sum);
+            }
+
+            EXPECT_TRUE(all(results == vec8x16u{expected}));
+        }
+    }
+
+    TEST(Vec8x16u, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8x16u>();
+
+            vec8x16u v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr8x16u expected{};
+            std::make_unsigned<vec8x16u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = static_cast<vec8x16u::scalar>(sum);
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec8x16u{expected}));
+        }
+    }
+
 }
 
 #endif
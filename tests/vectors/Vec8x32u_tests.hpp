@@ -441,6 +441,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask8x32u, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x32u v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask8x32u, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr8xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask8x32u>(bits);
+
+            EXPECT_TRUE(results == mask8x32u{expected});
+        }
+    }
+
+    TEST(Mask8x32u, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x32u v{inputs};
+
+            arr8xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask8x32u, Find_first_edge_cases) {
+        EXPECT_EQ(8, find_first(mask8x32u{false}));
+        EXPECT_EQ(0, find_first(mask8x32u{true}));
+    }
+
+    TEST(Mask8x32u, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x32u v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask8x32u, Find_last_edge_cases) {
+        EXPECT_EQ(8, find_last(mask8x32u{false}));
+        EXPECT_EQ(mask8x32u::width - 1, find_last(mask8x32u{true}));
+    }
+
+    TEST(Mask8x32u, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x32u v{inputs};
+
+            std::uint32_t expected = mask8x32u::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec8x32u tests
     //=========================================================================
@@ -2052,6 +2139,29 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec8x32u, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8x32u>();
+
+            vec8x32u v{inputs};
+
+            alignas(alignof(vec8x32u)) vec8x32u::scalar arr[vec8x32u::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec8x32u::width));
+        }
+    }
+
+    TEST(Vec8x32u, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec8x32u)) auto inputs = random_array<arr8x32u>();
+
+            auto v = stream_load<vec8x32u>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec8x32u::width));
+        }
+    }
+
 
     TEST(Vec8x32u, Scatter_n_random) {
         static constexpr std::size_t test_data_size = 16 * 1024;
@@ -2447,6 +2557,69 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec8x32u, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8x32u>();
+
+            vec8x32u v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr8x32u expected{};
+            std::make_unsigned<vec8x32u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = static_cast<vec8x32u::scalar>(sum);
+            }
+
+            EXPECT_TRUE(all(results == vec8x32u{expected}));
+        }
+    }
+
+    TEST(Vec8x32u, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8x32u>();
+
+            vec8x32u v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr8x32u expected{};
+            std::make_unsigned<vec8x32u::scalar>::type sum = 0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = static_cast<vec8x32u::scalar>(sum);
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec8x32u{expected}));
+        }
+    }
+
+    //=====================================================
+    // Hashing
+    //=====================================================
+
+    TEST(Vec8x32u, Fmix_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8x32u>();
+
+            vec8x32u v{inputs};
+
+            auto results = fmix(v);
+
+            arr8x32u expected{};
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = fmix(inputs[j]);
+            }
+
+            EXPECT_TRUE(all(results == vec8x32u{expected}));
+        }
+    }
+
 }
 
 #endif
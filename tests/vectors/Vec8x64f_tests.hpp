@@ -441,6 +441,93 @@ namespace avel_tests {
         }
     }
 
+    TEST(Mask8x64f, To_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x64f v{inputs};
+
+            std::uint64_t expected = 0x00;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected |= std::uint64_t(inputs[j]) << j;
+            }
+
+            EXPECT_EQ(expected, to_bits(v));
+        }
+    }
+
+    TEST(Mask8x64f, From_bits_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto bits = random64u();
+
+            arr8xb expected{};
+            for (std::size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = (bits >> j) & 0x1;
+            }
+
+            auto results = from_bits<mask8x64f>(bits);
+
+            EXPECT_TRUE(results == mask8x64f{expected});
+        }
+    }
+
+    TEST(Mask8x64f, For_each_set_lane_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x64f v{inputs};
+
+            arr8xb results{};
+            std::uint32_t previous = 0;
+            std::uint32_t visited = 0;
+            for_each_set_lane(v, [&] (std::uint32_t lane) {
+                EXPECT_TRUE(visited == 0 || previous < lane);
+                results[lane] = true;
+                previous = lane;
+                ++visited;
+            });
+
+            EXPECT_EQ(inputs, results);
+            EXPECT_EQ(count(v), visited);
+        }
+    }
+
+    TEST(Mask8x64f, Find_first_edge_cases) {
+        EXPECT_EQ(8, find_first(mask8x64f{false}));
+        EXPECT_EQ(0, find_first(mask8x64f{true}));
+    }
+
+    TEST(Mask8x64f, Find_first_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x64f v{inputs};
+
+            auto it = std::find(inputs.begin(), inputs.end(), true);
+            std::uint32_t expected = it - inputs.begin();
+
+            EXPECT_EQ(expected, find_first(v));
+        }
+    }
+
+    TEST(Mask8x64f, Find_last_edge_cases) {
+        EXPECT_EQ(8, find_last(mask8x64f{false}));
+        EXPECT_EQ(mask8x64f::width - 1, find_last(mask8x64f{true}));
+    }
+
+    TEST(Mask8x64f, Find_last_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8xb>();
+            mask8x64f v{inputs};
+
+            std::uint32_t expected = mask8x64f::width;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                if (inputs[j]) {
+                    expected = j;
+                }
+            }
+
+            EXPECT_EQ(expected, find_last(v));
+        }
+    }
+
     //=========================================================================
     // Vec8x64f tests
     //=========================================================================
@@ -1530,6 +1617,29 @@ namespace avel_tests {
         }
     }
 
+    TEST(Vec8x64f, Stream_store_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            auto inputs = random_array<arr8x64f>();
+
+            vec8x64f v{inputs};
+
+            alignas(alignof(vec8x64f)) vec8x64f::scalar arr[vec8x64f::width]{};
+
+            stream_store(arr, v);
+            stream_fence();
+            EXPECT_TRUE(compare_stored_data(arr, v, vec8x64f::width));
+        }
+    }
+
+    TEST(Vec8x64f, Stream_load_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            alignas(alignof(vec8x64f)) auto inputs = random_array<arr8x64f>();
+
+            auto v = stream_load<vec8x64f>(inputs.data());
+            EXPECT_TRUE(compare_stored_data(inputs.data(), v, vec8x64f::width));
+        }
+    }
+
     TEST(Vec8x64f, Scatter_n_random) {
         static constexpr std::size_t test_data_size = 16 * 1024;
         static constexpr std::size_t block_size = test_data_size / vec8x64f::width;
@@ -2581,6 +2691,54 @@ namespace avel_tests {
         }
     }
 
+    //=====================================================
+    // Scans
+    //=====================================================
+
+    TEST(Vec8x64f, Inclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            arr8x64f inputs{};
+            for (auto& x : inputs) {
+                x = static_cast<vec8x64f::scalar>(random8u() % 64);
+            }
+
+            vec8x64f v{inputs};
+
+            auto results = inclusive_scan(v);
+
+            arr8x64f expected{};
+            vec8x64f::scalar sum = 0.0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                sum += inputs[j];
+                expected[j] = sum;
+            }
+
+            EXPECT_TRUE(all(results == vec8x64f{expected}));
+        }
+    }
+
+    TEST(Vec8x64f, Exclusive_scan_random) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            arr8x64f inputs{};
+            for (auto& x : inputs) {
+                x = static_cast<vec8x64f::scalar>(random8u() % 64);
+            }
+
+            vec8x64f v{inputs};
+
+            auto results = exclusive_scan(v);
+
+            arr8x64f expected{};
+            vec8x64f::scalar sum = 0.0;
+            for (std::size_t j = 0; j < inputs.size(); ++j) {
+                expected[j] = sum;
+                sum += inputs[j];
+            }
+
+            EXPECT_TRUE(all(results == vec8x64f{expected}));
+        }
+    }
+
 }
 
 #endif //AVEL_VEC8X64F_TESTS_HPP